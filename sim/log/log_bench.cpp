@@ -0,0 +1,132 @@
+// Host benchmark for the sample log. Runs the real SampleLog against the
+// directory-backed LittleFS stand-in: appends records until the log holds
+// a few megabytes and has started trimming, then exports it as CSV the way
+// the /log.csv endpoint does, and checks that what comes back is complete.
+//
+//   log_bench [-d dir] [-r records]
+//
+//   -d  host directory standing in for the data partition (default sim_fs)
+//   -r  records to append (default: enough to fill LOG_MAX_BYTES one and a half times)
+//
+// Times are for this host's filesystem, not the device's flash; they show
+// what the batching and the export path cost relative to each other.
+
+#include <Arduino.h>
+#include <LittleFS.h>
+#include <chrono>
+#include <string>
+#include "sample_log.h"
+
+typedef std::chrono::steady_clock Clock;
+
+static double secondsSince(Clock::time_point start) {
+  return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+static void clearLog(const std::string& root) {
+  std::string dir = root + "/log";
+  DIR* d = opendir(dir.c_str());
+  if (!d) {
+    return;
+  }
+  struct dirent* entry;
+  while ((entry = readdir(d)) != nullptr) {
+    if (entry->d_name[0] != '.') {
+      unlink((dir + "/" + entry->d_name).c_str());
+    }
+  }
+  closedir(d);
+}
+
+int main(int argc, char** argv) {
+  const char* root = "sim_fs";
+  long records = (long)(LOG_MAX_BYTES * 3 / 2 / LOG_FRAME_BYTES);
+
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "-d") == 0 && i + 1 < argc) {
+      root = argv[++i];
+    } else if (strcmp(argv[i], "-r") == 0 && i + 1 < argc) {
+      records = max(1L, atol(argv[++i]));
+    } else {
+      fprintf(stderr, "usage: %s [-d dir] [-r records]\n", argv[0]);
+      return 2;
+    }
+  }
+
+  LittleFS.setRoot(root);
+  clearLog(root);
+
+  SampleLog log;
+  if (!log.begin()) {
+    fprintf(stderr, "log did not start\n");
+    return 1;
+  }
+
+  // Append: a slow discharge with some load noise, one record per simulated minute
+  BatteryData data;
+  data.data_valid = true;
+  Clock::time_point start = Clock::now();
+  for (long i = 0; i < records; i++) {
+    data.voltage = 13.2f - (i % 10000) * 0.0001f;
+    data.current = -3.0f - (i % 7) * 0.25f;
+    data.soc = 100.0f - (i % 10000) * 0.009f;
+    data.consumed_ah = -(i % 10000) * 0.01f;
+    log.append(data);
+  }
+  log.flush();
+  double appendSeconds = secondsSince(start);
+
+  printf("append: %ld records in %.3f s, %.0f records/s, %u batch writes, %u bytes on flash\n",
+         records, appendSeconds, records / appendSeconds, log.getFlushCount(), log.getBytesOnFlash());
+
+  // Export through the same chunked path as the web server, to a file
+  std::string csvPath = std::string(root) + "/samples.csv";
+  FILE* csv = fopen(csvPath.c_str(), "wb");
+  if (!csv) {
+    fprintf(stderr, "cannot write %s\n", csvPath.c_str());
+    return 1;
+  }
+
+  start = Clock::now();
+  char chunk[LOG_EXPORT_CHUNK_BYTES];
+  size_t used = strlen(LOG_CSV_HEADER);
+  memcpy(chunk, LOG_CSV_HEADER, used);
+  uint64_t csvBytes = 0;
+  long exported = 0;
+  bool ordered = true;
+  uint32_t firstSeq = 0;
+  uint32_t lastSeq = 0;
+
+  SampleLog::Reader reader(log);
+  LogRecord record;
+  while (reader.next(record)) {
+    if (exported == 0) {
+      firstSeq = record.seq;
+    } else if (record.seq != lastSeq + 1) {
+      ordered = false;
+    }
+    lastSeq = record.seq;
+    exported++;
+
+    if (used + LOG_CSV_LINE_MAX > sizeof(chunk)) {
+      fwrite(chunk, 1, used, csv);
+      csvBytes += used;
+      used = 0;
+    }
+    used += logFormatCsv(record, chunk + used);
+  }
+  fwrite(chunk, 1, used, csv);
+  csvBytes += used;
+  fclose(csv);
+  double exportSeconds = secondsSince(start);
+
+  double logMb = log.getBytesOnFlash() / 1048576.0;
+  printf("export: %ld records, %.2f MB log -> %.2f MB CSV in %.3f s, %.1f MB/s of log read\n",
+         exported, logMb, csvBytes / 1048576.0, exportSeconds, logMb / exportSeconds);
+
+  // Trimming drops whole segments from the front; what is left must be the newest records, in order
+  bool ok = ordered && exported > 0 && lastSeq == (uint32_t)(records - 1) &&
+            exported == (long)(log.getBytesOnFlash() / LOG_FRAME_BYTES) && reader.getSkippedBytes() == 0;
+  printf("check: seq %u..%u, %s\n", firstSeq, lastSeq, ok ? "ok" : "FAILED");
+  return ok ? 0 : 1;
+}
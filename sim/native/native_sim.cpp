@@ -0,0 +1,381 @@
+// Runs the whole firmware on the host: setup() and loop() from main.cpp with
+// the real VictronBLE, Display, ConfigServer, history and sample log, over a
+// simulated day on the virtual clock. Advertisements, button presses and web
+// requests arrive as background events while the main loop blocks, and the
+// panel holds BUSY for as long as a real refresh takes, so refresh counts,
+// wakeups and per-stage timings come out as they would on the device.
+//
+//   native_sim [-v] [-d hours] [-k mac:key]... [-b seconds:holdMs]... [-w path@seconds]... [-f dir] [capture]
+//
+// capture is a /capture.bin download or a serial log with "CAP" lines
+// (ADV_CAPTURE), replayed from its first packet; without one a synthetic
+// SmartShunt runs for the whole day.
+//   -v  print the firmware's serial output
+//   -d  simulated time (default 24 hours)
+//   -k  device MAC and key, stored as the configuration (default: config.h)
+//   -b  press the button at a time for a duration; replaces the default script
+//   -w  request a path from the config portal (served while it is running)
+//   -f  directory standing in for the LittleFS partition (default sim_fs)
+//
+// Stage timings are host CPU time in ESP32 clock units; compare builds and
+// stages with each other, not with the device.
+
+#include <Arduino.h>
+#include <LittleFS.h>
+#include <WebServer.h>
+#include <Preferences.h>
+#include <climits>
+#include <chrono>
+#include <string>
+#include <vector>
+#include "esp_sleep.h"
+#include "victron_ble.h"
+#include "display.h"
+#include "config_server.h"
+#include "main_events.h"
+#include "pipeline_metrics.h"
+#include "energy_meter.h"
+#include "deferred_log.h"
+#include "config.h"
+#include "sim_panel.h"
+#include "capture_source.h"
+
+#define SIM_DEFAULT_HOURS 24
+#define SIM_FIRST_ADV_MS 500            // Radio up shortly after boot
+#define SIM_FULL_REFRESH_MS 2000        // Panel BUSY per full refresh
+#define SIM_PARTIAL_REFRESH_MS 500      // And per partial refresh
+
+// From main.cpp
+extern VictronBLE* victronBLE;
+extern Display* display;
+extern ConfigServer* configServer;
+extern volatile int eventHead;
+extern volatile int eventTail;
+void setup();
+void loop();
+void processButtonEvents();
+
+struct ButtonPress {
+  unsigned long atMs;
+  unsigned long holdMs;
+};
+
+struct WebRequest {
+  unsigned long atMs;
+  std::string path;
+};
+
+// Host time of one piece of main-loop work
+struct HostTiming {
+  uint32_t calls;
+  double totalUs;
+  double maxUs;
+
+  void add(double us) {
+    calls++;
+    totalUs += us;
+    if (us > maxUs) maxUs = us;
+  }
+};
+
+// ---- Background events ----
+
+static std::vector<CapturedAdvertisement> advs;
+static std::vector<ButtonPress> presses;
+static std::vector<WebRequest> requests;
+static size_t nextAdv = 0;
+static size_t nextPress = 0;
+static bool buttonDown = false;
+static size_t nextRequest = 0;
+static unsigned long advOffsetMs = 0;
+static unsigned long endMs = 0;
+
+static uint32_t advsDelivered = 0;
+static double backgroundUs = 0;         // Host time in background work, kept out of the loop timings
+
+static double hostNowUs() {
+  using namespace std::chrono;
+  return duration_cast<nanoseconds>(steady_clock::now().time_since_epoch()).count() / 1000.0;
+}
+
+static unsigned long advTime(size_t i) {
+  return advs[i].header.timeMs + advOffsetMs;
+}
+
+static unsigned long nextButtonEdge() {
+  if (nextPress >= presses.size()) {
+    return ULONG_MAX;
+  }
+  const ButtonPress& press = presses[nextPress];
+  return buttonDown ? press.atMs + press.holdMs : press.atMs;
+}
+
+static unsigned long nextEventTime() {
+  unsigned long next = ULONG_MAX;
+  if (nextAdv < advs.size()) {
+    next = advTime(nextAdv);
+  }
+  next = min(next, nextButtonEdge());
+  if (nextRequest < requests.size()) {
+    next = min(next, requests[nextRequest].atMs);
+  }
+  return next;
+}
+
+// The scan callback and the decode task, back to back
+static void deliverAdvertisement(const CapturedAdvertisement& adv) {
+  advsDelivered++;
+  if (!victronBLE) {
+    return; // Not scanning (config mode, no configuration)
+  }
+  std::string data("\xE1\x02", 2);
+  data.append((const char*)adv.payload, adv.length);
+  NimBLEAdvertisedDevice device(adv.header.mac, data, adv.header.rssi);
+  victronBLE->handleAdvertisement(&device);
+  victronBLE->processPendingAdvertisements();
+}
+
+static void runDueEvents() {
+  unsigned long now = millis();
+  while (nextAdv < advs.size() && advTime(nextAdv) <= now) {
+    deliverAdvertisement(advs[nextAdv++]);
+  }
+  while (nextButtonEdge() <= now) {
+    buttonDown = !buttonDown;
+    simSetPin(CONFIG_BUTTON_PIN, buttonDown ? LOW : HIGH);
+    if (!buttonDown) {
+      nextPress++;
+    }
+  }
+  while (nextRequest < requests.size() && requests[nextRequest].atMs <= now) {
+    WebServer::simQueueRequest(requests[nextRequest++].path.c_str());
+  }
+}
+
+static void runBackground(unsigned long untilMs) {
+  double start = hostNowUs();
+  unsigned long next = min(min(untilMs, endMs), nextEventTime());
+  if (next > millis()) {
+    simSetMillis(next);
+  }
+  runDueEvents();
+  DeferredLog::drain();  // The log task's turn
+  backgroundUs += hostNowUs() - start;
+}
+
+// ---- Report ----
+
+static HostTiming loopTiming;
+static HostTiming buttonTiming;
+static HostTiming buttonWithEvents;
+static double simStartUs = 0;
+
+static void printTiming(const char* name, const HostTiming& timing) {
+  printf("%-28s %8u calls, avg %7.2f us, max %8.1f us\n", name, timing.calls,
+         timing.calls ? timing.totalUs / timing.calls : 0.0, timing.maxUs);
+}
+
+static void report() {
+  DeferredLog::drain();
+  unsigned long now = millis();
+  SimPanel& panel = SimPanel::instance();
+  printf("\nSimulated %.2f h in %.1f s of host time\n", now / 3600000.0, (hostNowUs() - simStartUs) / 1e6);
+  printf("Advertisements: %u delivered of %zu\n", advsDelivered, advs.size());
+
+  printf("Display: %u full + %u partial refreshes, %.0f s BUSY (%.2f%% of the time)\n",
+         panel.fullRefreshes, panel.partialRefreshes, panel.busyMs / 1000.0,
+         now ? panel.busyMs * 100.0 / now : 0.0);
+  if (display) {
+    RefreshStats refresh;
+    display->getRefreshStats(refresh);
+    printf("Refresh scheduler: %u changes coalesced, ghosting budget %u partials / %u pixels\n",
+           refresh.coalescedChanges, refresh.ghost.partialRefreshes, refresh.ghost.flippedPixels);
+  }
+
+  uint32_t wakeups = MainEvents::getEventWakeups() + MainEvents::getDeadlineWakeups();
+  printf("Main loop: %u wakeups (%u by events, %u by deadlines), %.1f per hour\n", wakeups,
+         MainEvents::getEventWakeups(), MainEvents::getDeadlineWakeups(),
+         now ? wakeups * 3600000.0 / now : 0.0);
+  printTiming("loop()", loopTiming);
+  printTiming("processButtonEvents()", buttonTiming);
+  printTiming("  with events queued", buttonWithEvents);
+
+  const SimHttpStats& http = WebServer::simStats();
+  if (http.requests > 0) {
+    printf("Config portal: %u requests served (%u not found), %zu response bytes\n", http.requests,
+           http.notFound, http.responseBytes);
+  }
+
+  printf("Stage CPU time, host:\n");
+  bool quiet = !Serial.enabled;
+  Serial.enabled = true;
+  PipelineMetrics::print();
+  EnergyMeter::print();
+  Serial.enabled = !quiet;
+  fflush(stdout);
+}
+
+static void onDeepSleep() {
+  printf("\nDeep sleep entered at %.2f h\n", millis() / 3600000.0);
+  report();
+}
+
+// ---- Setup ----
+
+static bool parsePress(const char* arg, ButtonPress& press) {
+  char* end;
+  double seconds = strtod(arg, &end);
+  if (end == arg || *end != ':') {
+    return false;
+  }
+  press.atMs = (unsigned long)(seconds * 1000);
+  press.holdMs = strtoul(end + 1, &end, 10);
+  return *end == '\0' && press.holdMs > 0;
+}
+
+static bool parseRequest(const char* arg, WebRequest& request) {
+  const char* at = strrchr(arg, '@');
+  if (!at || arg[0] != '/') {
+    return false;
+  }
+  request.path.assign(arg, at - arg);
+  request.atMs = (unsigned long)(strtod(at + 1, nullptr) * 1000);
+  return true;
+}
+
+// A view change each way, then a config portal session that times out with
+// two requests made while it is up
+static void defaultScript() {
+  const ButtonPress script[] = {
+    {4 * 3600000UL, 200},
+    {4 * 3600000UL + 30000, 200},
+    {8 * 3600000UL, 7000},
+  };
+  presses.assign(script, script + sizeof(script) / sizeof(script[0]));
+  WebRequest status = {8 * 3600000UL + 60000, "/status"};
+  WebRequest metrics = {8 * 3600000UL + 90000, "/metrics"};
+  requests.push_back(status);
+  requests.push_back(metrics);
+}
+
+static void storeConfig(const std::vector<DeviceKey>& keys) {
+  Preferences prefs;
+  prefs.begin("device-config", false);
+  prefs.clear();
+  prefs.putUChar("count", keys.size());
+  for (size_t i = 0; i < keys.size(); i++) {
+    char name[8];
+    snprintf(name, sizeof(name), "mac%u", (unsigned)i);
+    prefs.putString(name, keys[i].mac);
+    snprintf(name, sizeof(name), "key%u", (unsigned)i);
+    prefs.putString(name, keys[i].key);
+  }
+}
+
+static bool pressEarlier(const ButtonPress& a, const ButtonPress& b) {
+  return a.atMs < b.atMs;
+}
+
+static bool requestEarlier(const WebRequest& a, const WebRequest& b) {
+  return a.atMs < b.atMs;
+}
+
+int main(int argc, char** argv) {
+  const char* capturePath = nullptr;
+  const char* fsRoot = "sim_fs";
+  double hours = SIM_DEFAULT_HOURS;
+  bool scripted = false;
+  std::vector<DeviceKey> keys;
+
+  for (int i = 1; i < argc; i++) {
+    DeviceKey key;
+    ButtonPress press;
+    WebRequest request;
+    if (strcmp(argv[i], "-v") == 0) {
+      Serial.enabled = true;
+    } else if (strcmp(argv[i], "-d") == 0 && i + 1 < argc) {
+      hours = strtod(argv[++i], nullptr);
+    } else if (strcmp(argv[i], "-k") == 0 && i + 1 < argc && parseDeviceKey(argv[i + 1], key)) {
+      keys.push_back(key);
+      i++;
+    } else if (strcmp(argv[i], "-b") == 0 && i + 1 < argc && parsePress(argv[i + 1], press)) {
+      presses.push_back(press);
+      scripted = true;
+      i++;
+    } else if (strcmp(argv[i], "-w") == 0 && i + 1 < argc && parseRequest(argv[i + 1], request)) {
+      requests.push_back(request);
+      scripted = true;
+      i++;
+    } else if (strcmp(argv[i], "-f") == 0 && i + 1 < argc) {
+      fsRoot = argv[++i];
+    } else if (argv[i][0] != '-' && !capturePath) {
+      capturePath = argv[i];
+    } else {
+      fprintf(stderr, "usage: %s [-v] [-d hours] [-k mac:key]... [-b seconds:holdMs]... "
+                      "[-w path@seconds]... [-f dir] [capture]\n", argv[0]);
+      return 2;
+    }
+  }
+  endMs = (unsigned long)(hours * 3600000.0);
+  if (!scripted) {
+    defaultScript();
+  }
+  std::sort(presses.begin(), presses.end(), pressEarlier);
+  std::sort(requests.begin(), requests.end(), requestEarlier);
+
+  if (!keys.empty()) {
+    storeConfig(keys);
+  } else {
+    DeviceKey key;
+    strcpy(key.mac, INSTANT_READOUT_MAC_ADDRESS);
+    strcpy(key.key, INSTANT_READOUT_ENCRYPTION_KEY);
+    keys.push_back(key);
+  }
+
+  if (capturePath) {
+    uint32_t skippedBytes = 0;
+    if (!loadCapture(capturePath, advs, skippedBytes)) {
+      fprintf(stderr, "cannot read %s\n", capturePath);
+      return 2;
+    }
+    if (skippedBytes > 0) {
+      printf("%u damaged bytes skipped\n", skippedBytes);
+    }
+    if (!advs.empty()) {
+      advOffsetMs = SIM_FIRST_ADV_MS - advs.front().header.timeMs;
+    }
+  } else {
+    synthesizeCapture(keys[0], endMs / 1000, advs);
+    advOffsetMs = SIM_FIRST_ADV_MS;
+  }
+
+  LittleFS.setRoot(fsRoot);
+  SimPanel::instance().fullRefreshMs = SIM_FULL_REFRESH_MS;
+  SimPanel::instance().partialRefreshMs = SIM_PARTIAL_REFRESH_MS;
+  simSetBackgroundHook(runBackground);
+  simSetDeepSleepHook(onDeepSleep);
+  simStartUs = hostNowUs();
+
+  setup();
+
+  while (millis() < endMs) {
+    // loop() starts with processButtonEvents(); running it first times it on
+    // its own and leaves loop() an empty queue, which is otherwise the same
+    bool queued = eventHead != eventTail;
+    double background = backgroundUs;
+    double start = hostNowUs();
+    processButtonEvents();
+    double buttonsDone = hostNowUs();
+    buttonTiming.add(buttonsDone - start - (backgroundUs - background));
+    if (queued) {
+      buttonWithEvents.add(buttonsDone - start - (backgroundUs - background));
+    }
+
+    background = backgroundUs;
+    loop();
+    loopTiming.add(hostNowUs() - buttonsDone - (backgroundUs - background));
+  }
+
+  report();
+  return 0;
+}
@@ -0,0 +1,279 @@
+// Host check for the compile-time record fields in victron_record.h. Every
+// BitField<Offset, Width, Signed> that fits in a long SmartShunt record is
+// read from random records, and from records holding its "not available"
+// sentinel, and compared with the bit-by-bit loop the decoder used before:
+// the same availability and the same value. Then both ways are timed on the
+// eight SmartShunt fields. Exits 1 on any mismatch.
+//
+//   bitfield_check [-r records] [-n iterations]
+//
+//   -r  random records per field (default 64)
+//   -n  records decoded by each timed run (default 20000000)
+//
+// Times are this host's; the ESP32 runs both slower but in about the same
+// ratio, as neither way touches more than the bytes of one record.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <chrono>
+#include <vector>
+#include "victron_record.h"
+
+typedef std::chrono::steady_clock Clock;
+
+#define RECORD_BYTES SmartShuntRecord::LONG_RECORD_LENGTH
+#define RECORD_BITS (RECORD_BYTES * 8)
+#define MAX_REPORTED 10               // Mismatches printed before the rest are only counted
+#define TIMED_RECORDS 256             // Distinct records cycled through by the timed runs
+
+typedef uint8_t Record[RECORD_BYTES];
+
+static volatile uint32_t sink;        // Keeps the timed loops from being optimised away
+
+static std::vector<uint8_t> records;  // Random records, RECORD_BYTES each
+static unsigned long fieldsChecked = 0;
+static unsigned long readsChecked = 0;
+static unsigned long mismatches = 0;
+
+// ---- The decoder's original field extraction ----
+
+// As it was in victron_ble.cpp, with unsigned shifts so a 32-bit field is defined
+static uint32_t extractBits(const uint8_t* data, int startBit, int numBits) {
+  uint32_t result = 0;
+  int currentBit = startBit;
+
+  for (int i = 0; i < numBits; i++) {
+    int byteIndex = currentBit / 8;
+    int bitIndex = currentBit % 8;
+
+    if (data[byteIndex] & (1 << bitIndex)) {
+      result |= (1u << i);
+    }
+    currentBit++;
+  }
+
+  return result;
+}
+
+static int32_t signExtend(uint32_t value, int bits) {
+  if (bits < 32 && (value & (1u << (bits - 1)))) {
+    return value | (0xFFFFFFFFu << bits);
+  }
+  return value;
+}
+
+static void writeBits(uint8_t* data, int startBit, int numBits, uint32_t value) {
+  for (int i = 0; i < numBits; i++) {
+    int bit = startBit + i;
+    if (value & (1u << i)) {
+      data[bit / 8] |= 1 << (bit % 8);
+    } else {
+      data[bit / 8] &= ~(1 << (bit % 8));
+    }
+  }
+}
+
+// ---- Every offset, width and signedness ----
+
+// The sentinels follow the records': all ones unsigned, the largest positive value signed
+template <uint8_t Width, bool Signed>
+struct Sentinel {
+  static const uint32_t mask = Width == 32 ? 0xFFFFFFFFu : ((1u << (Width % 32)) - 1u);
+  static const uint32_t value = Signed ? mask >> 1 : mask;
+};
+
+typedef bool (*ReadField)(const uint8_t* data, int32_t& value);
+
+template <uint16_t Offset, uint8_t Width, bool Signed>
+static bool readField(const uint8_t* data, int32_t& value) {
+  return BitField<Offset, Width, Signed, Sentinel<Width, Signed>::value>::read(data, value);
+}
+
+static void checkRead(unsigned offset, unsigned width, bool isSigned, uint32_t sentinel, ReadField read,
+                      const uint8_t* data) {
+  uint32_t raw = extractBits(data, offset, width);
+  bool expectedAvailable = raw != sentinel;
+  int32_t expected = isSigned ? signExtend(raw, width) : (int32_t)raw;
+
+  int32_t value = 0;
+  bool available = read(data, value);
+  readsChecked++;
+  if (available == expectedAvailable && (!available || value == expected)) {
+    return;
+  }
+  if (mismatches++ < MAX_REPORTED) {
+    printf("MISMATCH offset %3u width %2u %-8s: loop %s %ld, BitField %s %ld\n", offset, width,
+           isSigned ? "signed" : "unsigned", expectedAvailable ? "value" : "n/a", (long)expected,
+           available ? "value" : "n/a", (long)value);
+  }
+}
+
+static void checkField(unsigned offset, unsigned width, bool isSigned, uint32_t sentinel, ReadField read) {
+  for (size_t i = 0; i < records.size(); i += RECORD_BYTES) {
+    checkRead(offset, width, isSigned, sentinel, read, &records[i]);
+  }
+
+  // The sentinel, and the values either side of it, around random neighbours
+  const uint32_t values[] = {sentinel, sentinel - 1, sentinel + 1, 0};
+  for (size_t v = 0; v < sizeof(values) / sizeof(values[0]); v++) {
+    Record record;
+    memcpy(record, &records[0], RECORD_BYTES);
+    writeBits(record, offset, width, values[v]);
+    checkRead(offset, width, isSigned, sentinel, read, record);
+  }
+  fieldsChecked++;
+}
+
+// The templates only pick the BitField; the comparison itself is shared
+template <uint16_t Offset, uint8_t Width>
+static void checkBoth() {
+  checkField(Offset, Width, false, Sentinel<Width, false>::value, readField<Offset, Width, false>);
+  checkField(Offset, Width, true, Sentinel<Width, true>::value, readField<Offset, Width, true>);
+}
+
+// Widths at one offset, up to the end of the record
+template <uint16_t Offset, uint8_t Width>
+struct CheckWidths {
+  static void run() {
+    checkBoth<Offset, Width>();
+    CheckWidths<Offset, Width + 1>::run();
+  }
+};
+
+template <uint16_t Offset>
+struct CheckWidths<Offset, 33> {
+  static void run() {}
+};
+
+template <uint16_t Offset, bool Fits = (Offset + 32 <= RECORD_BITS)>
+struct CheckOffsets {
+  static void run() {
+    CheckWidths<Offset, 1>::run();
+    CheckOffsets<Offset + 1>::run();
+  }
+};
+
+// The last 31 offsets take only the widths that end inside the record
+template <uint16_t Offset, uint8_t Width, bool Fits = (Offset + Width <= RECORD_BITS)>
+struct CheckTailWidths {
+  static void run() {
+    checkBoth<Offset, Width>();
+    CheckTailWidths<Offset, Width + 1>::run();
+  }
+};
+
+template <uint16_t Offset, uint8_t Width>
+struct CheckTailWidths<Offset, Width, false> {
+  static void run() {}
+};
+
+template <uint16_t Offset>
+struct CheckOffsets<Offset, false> {
+  static void run() {
+    CheckTailWidths<Offset, 1>::run();
+    CheckOffsets<Offset + 1>::run();
+  }
+};
+
+template <>
+struct CheckOffsets<RECORD_BITS, false> {
+  static void run() {}
+};
+
+// ---- Timing on the SmartShunt fields ----
+
+// The fields parseSmartShuntData() reads, summed so nothing is skipped
+static uint32_t decodeWithLoop(const uint8_t* data) {
+  uint32_t sum = 0;
+  uint32_t raw = extractBits(data, 0, 16);
+  if (raw != 0xFFFF) sum += raw;
+  raw = extractBits(data, 16, 16);
+  if (raw != 0x7FFF) sum += signExtend(raw, 16);
+  sum += extractBits(data, 32, 16);
+  raw = extractBits(data, 48, 16);
+  if (raw != 0x7FFF) sum += signExtend(raw, 16);
+  sum += extractBits(data, 64, 2);
+  raw = extractBits(data, 66, 22);
+  if (raw != 0x3FFFFF) sum += signExtend(raw, 22);
+  raw = extractBits(data, 88, 20);
+  if (raw != 0xFFFFF) sum += signExtend(raw, 20);
+  raw = extractBits(data, 108, 10);
+  if (raw != 0x3FF) sum += raw;
+  return sum;
+}
+
+static uint32_t decodeWithFields(const uint8_t* data) {
+  using namespace SmartShuntRecord;
+  uint32_t sum = 0;
+  int32_t value;
+  if (TimeToGo::read(data, value)) sum += value;
+  if (BatteryVoltage::read(data, value)) sum += value;
+  if (AlarmReason::read(data, value)) sum += value;
+  if (AuxInput::read(data, value)) sum += value;
+  if (AuxInputType::read(data, value)) sum += value;
+  if (BatteryCurrent::read(data, value)) sum += value;
+  if (ConsumedAh::read(data, value)) sum += value;
+  if (StateOfCharge::read(data, value)) sum += value;
+  return sum;
+}
+
+template <uint32_t (*Decode)(const uint8_t*)>
+static double timeDecode(unsigned long iterations, uint32_t& total) {
+  total = 0;
+  Clock::time_point start = Clock::now();
+  for (unsigned long i = 0; i < iterations; i++) {
+    total += Decode(&records[(i % TIMED_RECORDS) * RECORD_BYTES]);
+  }
+  sink = total;
+  return std::chrono::duration<double, std::nano>(Clock::now() - start).count() / iterations;
+}
+
+int main(int argc, char** argv) {
+  unsigned long recordCount = 64;
+  unsigned long iterations = 20000000UL;
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "-r") == 0 && i + 1 < argc) {
+      recordCount = strtoul(argv[++i], nullptr, 10);
+    } else if (strcmp(argv[i], "-n") == 0 && i + 1 < argc) {
+      iterations = strtoul(argv[++i], nullptr, 10);
+    } else {
+      fprintf(stderr, "usage: %s [-r records] [-n iterations]\n", argv[0]);
+      return 2;
+    }
+  }
+  recordCount = std::max(recordCount, 1UL);
+
+  // Fixed seed so a mismatch is reproducible
+  srand(1);
+  records.resize(std::max(recordCount, (unsigned long)TIMED_RECORDS) * RECORD_BYTES);
+  for (size_t i = 0; i < records.size(); i++) {
+    records[i] = rand() & 0xFF;
+  }
+  // The equivalence check uses the first recordCount records
+  std::vector<uint8_t> timed(records);
+  records.resize(recordCount * RECORD_BYTES);
+
+  CheckOffsets<0>::run();
+  printf("%lu fields (every offset, width 1..32, signed and unsigned, in %u bits), %lu reads compared: %lu mismatches\n",
+         fieldsChecked, (unsigned)RECORD_BITS, readsChecked, mismatches);
+
+  records.swap(timed);
+  uint32_t loopTotal;
+  uint32_t fieldTotal;
+  double loopNs = timeDecode<decodeWithLoop>(iterations, loopTotal);
+  double fieldNs = timeDecode<decodeWithFields>(iterations, fieldTotal);
+  printf("SmartShunt record, 8 fields: bit loop %.1f ns, BitField %.1f ns (%.1fx)\n", loopNs, fieldNs,
+         fieldNs > 0 ? loopNs / fieldNs : 0.0);
+  if (loopTotal != fieldTotal) {
+    printf("MISMATCH in the timed decode: %lu vs %lu\n", (unsigned long)loopTotal, (unsigned long)fieldTotal);
+    mismatches++;
+  }
+
+  if (mismatches > 0) {
+    printf("FAILED\n");
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,401 @@
+// Host render simulator. Draws representative screens through the real
+// Display class into the SimPanel model, writes what the panel shows as PBM
+// images, compares them with the golden images and times the data screen
+// render path. Exits 1 if an image differs or has no golden image, or if
+// refresh() allocates.
+//
+//   render_sim [-o out_dir] [-g golden_dir] [-u] [-n iterations] [-v]
+//
+//   -o  where snapshots are written (default sim_out)
+//   -g  golden images, one golden_dir/<scene>.pbm per scene (default sim/golden)
+//   -u  (re)write the golden images instead of comparing
+//   -n  timed refreshes per scene (default 200)
+//   -v  show the display code's Serial output
+
+#include <Arduino.h>
+#include <chrono>
+#include <vector>
+#include <sys/stat.h>
+#include "display.h"
+#include "history.h"
+#include "config.h"
+#include "sim_panel.h"
+#include "energy_meter.h"
+
+#define SIM_START_MS 3600000UL   // Virtual clock at the start of each scene
+#define DIAGNOSTICS_REFRESH_S 30 // Partial refresh interval behind the diagnostics scene
+#define PBM_WIDTH 296
+#define PBM_HEIGHT 128
+#define DEFAULT_GOLDEN_DIR "sim/golden" // Relative to the repository root, where pio runs
+
+enum SceneKind {
+  SCENE_DATA,
+  SCENE_STALE,
+  SCENE_GRAPH,
+  SCENE_DIAGNOSTICS,
+  SCENE_TEST,
+  SCENE_CONFIG,
+  SCENE_SLEEP
+};
+
+struct Scene {
+  const char* name;
+  SceneKind kind;
+  BatteryData data;
+  const char* viewLabel;
+};
+
+struct RenderTiming {
+  double minUs = 0;
+  double meanUs = 0;
+  double maxUs = 0;
+  uint32_t maxAllocations = 0;   // Heap allocations in the worst refresh
+};
+
+static BatteryData makeData(float voltage, float current, float soc, float consumedAh, int8_t rssi) {
+  BatteryData data;
+  data.voltage = voltage;
+  data.current = current;
+  data.power = voltage * current;
+  data.soc = soc;
+  data.consumed_ah = consumedAh;
+  data.rssi = rssi;
+  data.data_valid = true;
+  return data;
+}
+
+static std::vector<Scene> buildScenes() {
+  std::vector<Scene> scenes;
+
+  BatteryData discharging = makeData(12.8f, -5.2f, 85.0f, -15.2f, -70);
+  discharging.ttg_minutes = 980;
+  discharging.calculated_time_remaining_minutes = 980;
+  discharging.time_calculation_valid = true;
+  scenes.push_back({"discharging", SCENE_DATA, discharging, ""});
+
+  BatteryData charging = makeData(13.6f, 12.4f, 42.0f, -58.0f, -84);
+  charging.calculated_time_to_full_minutes = 280;
+  charging.time_calculation_valid = true;
+  scenes.push_back({"charging", SCENE_DATA, charging, ""});
+
+  BatteryData idle = makeData(13.3f, 0.0f, 100.0f, 0.0f, -60);
+  scenes.push_back({"idle", SCENE_DATA, idle, ""});
+
+  BatteryData lowBattery = makeData(11.4f, -21.7f, 4.0f, -96.1f, -91);
+  lowBattery.ttg_minutes = 11;
+  lowBattery.alarms = 0x0001;
+  scenes.push_back({"alarm", SCENE_DATA, lowBattery, ""});
+
+  scenes.push_back({"multi_device", SCENE_DATA, discharging, "2/3"});
+  scenes.push_back({"aggregate", SCENE_DATA, charging, "ALL"});
+
+  scenes.push_back({"stale", SCENE_STALE, discharging, ""});
+  scenes.push_back({"graph", SCENE_GRAPH, discharging, ""});
+  scenes.push_back({"diagnostics", SCENE_DIAGNOSTICS, BatteryData(), ""});
+  scenes.push_back({"test_screen", SCENE_TEST, BatteryData(), ""});
+  scenes.push_back({"config_screen", SCENE_CONFIG, BatteryData(), ""});
+  scenes.push_back({"sleep_screen", SCENE_SLEEP, BatteryData(), ""});
+
+  return scenes;
+}
+
+// A day of one-minute samples: discharge through the evening with a load
+// step, a charging morning, and a half-hour gap without data
+static void fillHistory(History& history) {
+  history.begin();
+  for (int minute = 0; minute < 24 * 60; minute++) {
+    simAdvanceMillis(HISTORY_INTERVAL_MS);
+    if (minute >= 600 && minute < 630) {
+      continue;
+    }
+
+    float current = minute < 720 ? (minute % 240 < 60 ? -12.0f : -3.5f) : 8.0f;
+    float soc = minute < 720 ? 95.0f - minute * 0.06f : 51.8f + (minute - 720) * 0.06f;
+    BatteryData data = makeData(12.4f + soc * 0.01f + current * 0.01f, current, soc, 0, -70);
+    data.last_update = millis();
+    history.record(data, millis());
+  }
+}
+
+static void renderScene(Display& display, const Scene& scene) {
+  BatteryData data = scene.data;
+
+  switch (scene.kind) {
+    case SCENE_DATA:
+      display.setViewLabel(scene.viewLabel);
+      data.last_update = millis() - 4000;
+      display.updateData(data);
+      display.refresh();
+      break;
+
+    case SCENE_STALE:
+      data.last_update = millis() - DATA_STALE_TIMEOUT - 1000;
+      display.updateData(data);
+      display.refresh();
+      break;
+
+    case SCENE_GRAPH: {
+      static History history;
+      static bool filled = false;
+      if (!filled) {
+        fillHistory(history);
+        filled = true;
+      }
+      display.setHistory(&history);
+      display.setGraphMode(true);
+      display.refresh();
+      break;
+    }
+
+    case SCENE_DIAGNOSTICS:
+      // Figures are the hour set up by startEnergyMeter() and the splash screen
+      display.setDiagnosticsMode(true);
+      display.refresh();
+      break;
+
+    case SCENE_TEST:
+      display.showTestScreen();
+      break;
+
+    case SCENE_CONFIG:
+      display.showConfigScreen("CONFIG MODE", "WiFi: " CONFIG_AP_SSID, "Pass: " CONFIG_AP_PASSWORD,
+                               "Go to: 192.168.4.1", "Hold 3s to exit");
+      break;
+
+    case SCENE_SLEEP:
+      display.showSleepScreen();
+      break;
+  }
+}
+
+// Every scene starts the energy estimate over an hour before SIM_START_MS, so
+// the diagnostics screen does not depend on the scenes (and timing loops)
+// before it: that hour it sees scanning throughout and a partial refresh
+// every DIAGNOSTICS_REFRESH_S
+static void startEnergyMeter(const Scene& scene) {
+  simSetMillis(SIM_START_MS - 3600000UL);
+  EnergyMeter::reset();
+  if (scene.kind != SCENE_DIAGNOSTICS) {
+    return;
+  }
+  EnergyMeter::setScanning(true);
+  for (int i = 0; i < 3600 / DIAGNOSTICS_REFRESH_S; i++) {
+    EnergyMeter::panelRefreshed(false);
+  }
+}
+
+// Data screen render time: full redraw of every field, then alternating
+// readings that change a few fields as on a live feed
+static void timeScene(Display& display, const Scene& scene, int iterations,
+                      RenderTiming& full, RenderTiming& incremental) {
+  typedef std::chrono::steady_clock Clock;
+  double totalFull = 0;
+  double totalIncremental = 0;
+  full.minUs = incremental.minUs = 1e12;
+
+  for (int i = 0; i < iterations; i++) {
+    simAdvanceMillis(2000);
+
+    BatteryData data = scene.data;
+    data.last_update = millis();
+    display.updateData(data);
+    display.forceNextUpdate();
+    simAdvanceMillis(display.msUntilRefresh(millis()));
+
+    Clock::time_point start = Clock::now();
+    display.refresh();
+    double us = std::chrono::duration<double, std::micro>(Clock::now() - start).count();
+    totalFull += us;
+    full.minUs = min(full.minUs, us);
+    full.maxUs = max(full.maxUs, us);
+    full.maxAllocations = max(full.maxAllocations, display.getLastFrameAllocations());
+
+    simAdvanceMillis(2000);
+    data.current += (i & 1) ? 0.5f : -0.5f;
+    data.power = data.voltage * data.current;
+    data.consumed_ah -= 0.6f;
+    data.last_update = millis();
+    display.updateData(data);
+    simAdvanceMillis(display.msUntilRefresh(millis())); // Coalescing window
+
+    start = Clock::now();
+    display.refresh();
+    us = std::chrono::duration<double, std::micro>(Clock::now() - start).count();
+    totalIncremental += us;
+    incremental.minUs = min(incremental.minUs, us);
+    incremental.maxUs = max(incremental.maxUs, us);
+    incremental.maxAllocations = max(incremental.maxAllocations, display.getLastFrameAllocations());
+  }
+
+  full.meanUs = totalFull / iterations;
+  incremental.meanUs = totalIncremental / iterations;
+}
+
+static bool writePbm(const String& path) {
+  FILE* f = fopen(path.c_str(), "wb");
+  if (!f) {
+    return false;
+  }
+
+  const SimPanel& panel = SimPanel::instance();
+  fprintf(f, "P4\n%d %d\n", PBM_WIDTH, PBM_HEIGHT);
+  for (int16_t y = 0; y < PBM_HEIGHT; y++) {
+    uint8_t row[(PBM_WIDTH + 7) / 8] = {0};
+    for (int16_t x = 0; x < PBM_WIDTH; x++) {
+      if (panel.isBlack(x, y)) {
+        row[x / 8] |= 0x80 >> (x & 7);
+      }
+    }
+    fwrite(row, 1, sizeof(row), f);
+  }
+
+  fclose(f);
+  return true;
+}
+
+// Pixels differing from a golden image, or -1 if it cannot be read
+static long comparePbm(const String& path) {
+  FILE* f = fopen(path.c_str(), "rb");
+  if (!f) {
+    return -1;
+  }
+
+  int width = 0;
+  int height = 0;
+  if (fscanf(f, "P4 %d %d", &width, &height) != 2 || width != PBM_WIDTH || height != PBM_HEIGHT) {
+    fclose(f);
+    return -1;
+  }
+  fgetc(f);  // Single whitespace before the raster
+
+  const SimPanel& panel = SimPanel::instance();
+  long differing = 0;
+  for (int16_t y = 0; y < PBM_HEIGHT; y++) {
+    uint8_t row[(PBM_WIDTH + 7) / 8];
+    if (fread(row, 1, sizeof(row), f) != sizeof(row)) {
+      fclose(f);
+      return -1;
+    }
+    for (int16_t x = 0; x < PBM_WIDTH; x++) {
+      bool goldenBlack = row[x / 8] & (0x80 >> (x & 7));
+      if (goldenBlack != panel.isBlack(x, y)) {
+        differing++;
+      }
+    }
+  }
+
+  fclose(f);
+  return differing;
+}
+
+int main(int argc, char** argv) {
+  const char* outDir = "sim_out";
+  const char* goldenDir = DEFAULT_GOLDEN_DIR;
+  bool updateGolden = false;
+  int iterations = 200;
+
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "-o") == 0 && i + 1 < argc) {
+      outDir = argv[++i];
+    } else if (strcmp(argv[i], "-g") == 0 && i + 1 < argc) {
+      goldenDir = argv[++i];
+    } else if (strcmp(argv[i], "-u") == 0) {
+      updateGolden = true;
+    } else if (strcmp(argv[i], "-n") == 0 && i + 1 < argc) {
+      iterations = max(1, atoi(argv[++i]));
+    } else if (strcmp(argv[i], "-v") == 0) {
+      Serial.enabled = true;
+    } else {
+      fprintf(stderr, "usage: %s [-o out_dir] [-g golden_dir] [-u] [-n iterations] [-v]\n", argv[0]);
+      return 2;
+    }
+  }
+
+  mkdir(outDir, 0755);
+  if (updateGolden) {
+    mkdir(goldenDir, 0755);
+  }
+
+  std::vector<Scene> scenes = buildScenes();
+  int failures = 0;
+
+  printf("%-14s %8s %8s %8s | %8s %8s %8s | %7s %6s %6s\n", "scene", "full_min", "full_avg", "full_max",
+         "inc_min", "inc_avg", "inc_max", "bytes", "allocs", "golden");
+
+  for (size_t s = 0; s < scenes.size(); s++) {
+    const Scene& scene = scenes[s];
+
+    SimPanel::instance().reset();
+    startEnergyMeter(scene);
+    simSetMillis(SIM_START_MS);
+
+    Display* display = new Display();
+    display->begin();
+    simAdvanceMillis(DISPLAY_MIN_REFRESH_INTERVAL); // The splash screen counts against the refresh rate limit
+    uint32_t bytesBefore = SimPanel::instance().bytesWritten;
+    renderScene(*display, scene);
+
+    uint32_t bytesWritten = SimPanel::instance().bytesWritten - bytesBefore;
+    bool refreshed = scene.kind == SCENE_DATA || scene.kind == SCENE_STALE || scene.kind == SCENE_GRAPH ||
+                     scene.kind == SCENE_DIAGNOSTICS;
+    uint32_t allocations = refreshed ? display->getLastFrameAllocations() : 0;
+    String name = scene.name;
+    writePbm(String(outDir) + "/" + name + ".pbm");
+
+    // A scene without a golden image fails like one that differs
+    const char* goldenResult;
+    String goldenPath = String(goldenDir) + "/" + name + ".pbm";
+    if (updateGolden) {
+      if (writePbm(goldenPath)) {
+        goldenResult = "written";
+      } else {
+        goldenResult = "FAILED";
+        failures++;
+      }
+    } else {
+      long differing = comparePbm(goldenPath);
+      if (differing == 0) {
+        goldenResult = "ok";
+      } else if (differing < 0) {
+        goldenResult = "MISSING";
+        failures++;
+        fprintf(stderr, "%s: no golden image %s (record it with -u)\n", scene.name, goldenPath.c_str());
+      } else {
+        goldenResult = "DIFF";
+        failures++;
+        fprintf(stderr, "%s: %ld pixels differ from %s\n", scene.name, differing, goldenPath.c_str());
+      }
+    }
+
+    if (scene.kind == SCENE_DATA) {
+      RenderTiming full;
+      RenderTiming incremental;
+      timeScene(*display, scene, iterations, full, incremental);
+      allocations = max(allocations, max(full.maxAllocations, incremental.maxAllocations));
+      printf("%-14s %8.1f %8.1f %8.1f | %8.1f %8.1f %8.1f | %7u %6u %6s\n", scene.name,
+             full.minUs, full.meanUs, full.maxUs, incremental.minUs, incremental.meanUs, incremental.maxUs,
+             bytesWritten, allocations, goldenResult);
+    } else {
+      // Screens drawn outside refresh() have no count
+      char allocText[12] = "-";
+      if (refreshed) {
+        snprintf(allocText, sizeof(allocText), "%u", allocations);
+      }
+      printf("%-14s %8s %8s %8s | %8s %8s %8s | %7u %6s %6s\n", scene.name, "-", "-", "-", "-", "-", "-",
+             bytesWritten, allocText, goldenResult);
+    }
+    
+    // The refresh path must not touch the heap
+    if (allocations > 0) {
+      fprintf(stderr, "%s: %u heap allocations in refresh()\n", scene.name, allocations);
+      failures++;
+    }
+
+    delete display;
+  }
+
+  printf("Times in microseconds per refresh() on this host; bytes = controller RAM written for the snapshot;\n"
+         "allocs = heap allocations in the worst refresh (must be 0)\n");
+  printf("Snapshots written to %s/\n", outDir);
+  return failures > 0 ? 1 : 0;
+}
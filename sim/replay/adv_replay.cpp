@@ -0,0 +1,353 @@
+// Replays captured advertisements through the real VictronBLE decrypt, parse
+// and duplicate handling and the real Display change detection and refresh
+// scheduling, on the virtual clock, so a capture always gives the same result.
+//
+//   adv_replay [-v] [-p] [-a] [-k mac:key]... [-e expected | -u expected] [capture]
+//   adv_replay -s seconds out.cap
+//
+// capture is a /capture.bin download, or a serial log with "CAP" lines
+// (ADV_CAPTURE); without one, a synthetic capture of SYNTH_DEFAULT_S is
+// replayed and checked against sim/replay/synthetic.expected.
+//   -p  sleep between packets as recorded instead of replaying at full speed
+//   -a  list every decoded reading in the output, not only the refreshes
+//   -k  device MAC and key (default: the ones in config.h); repeat per device
+//   -e  compare the output with an expected file; exits 1 on divergence
+//
+// Every decoded packet must be published to the display exactly once and a
+// duplicate not at all; otherwise it exits 1 with or without -e.
+//   -u  write the output as the new expected file
+//   -s  write a synthetic capture of the given length and exit
+
+#include <Arduino.h>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <unistd.h>
+#include "victron_ble.h"
+#include "display.h"
+#include "capture_source.h"
+#include "victron_record.h"
+#include "config.h"
+#include "sim_panel.h"
+
+#define REPLAY_START_MS 3600000UL   // Virtual clock at the first packet
+#define SYNTH_DEFAULT_S 1800
+#define DEFAULT_EXPECTED "sim/replay/synthetic.expected"
+
+// ---- Replay ----
+
+struct ReplayResult {
+  std::vector<std::string> lines;   // Output compared against the expected file
+  uint32_t packets;
+  uint32_t decoded;
+  uint32_t duplicates;
+  uint32_t refreshes;
+  uint32_t fullRefreshes;
+  uint32_t skippedRefreshes;        // Rendered but no pixel changed
+  uint32_t coalesced;
+  uint32_t publishErrors;           // Packets not published exactly once (duplicates: not at all)
+  double decodeSeconds;             // Wall time in the scan callback and decode path
+  double totalSeconds;
+};
+
+static void addLine(ReplayResult& result, const char* format, ...) __attribute__((format(printf, 2, 3)));
+static void addLine(ReplayResult& result, const char* format, ...) {
+  char line[160];
+  va_list args;
+  va_start(args, format);
+  vsnprintf(line, sizeof(line), format, args);
+  va_end(args);
+  result.lines.push_back(line);
+}
+
+// Devices are added in key order, so the key index is the device index
+static int findDevice(const std::vector<DeviceKey>& keys, const uint8_t* native) {
+  uint64_t mac = DeviceTable::macFromBytes(native);
+  for (size_t i = 0; i < keys.size(); i++) {
+    uint64_t keyMac;
+    if (DeviceTable::parseMac(keys[i].mac, keyMac) && keyMac == mac) {
+      return i;
+    }
+  }
+  return -1;
+}
+
+// Runs one refresh and records what it decided
+static void refresh(Display& display, ReplayResult& result, unsigned long startMs) {
+  RefreshStats before;
+  display.getRefreshStats(before);
+  uint32_t skippedBefore = display.getSkippedRefreshCount();
+  unsigned long at = millis() - startMs;
+
+  display.refresh();
+
+  RefreshStats after;
+  display.getRefreshStats(after);
+  if (after.fullRefreshes != before.fullRefreshes) {
+    result.refreshes++;
+    result.fullRefreshes++;
+    addLine(result, "R %lu full %u", at, display.getLastChangedPixels());
+  } else if (after.partialRefreshes != before.partialRefreshes) {
+    result.refreshes++;
+    addLine(result, "R %lu partial %u", at, display.getLastChangedPixels());
+  } else if (display.getSkippedRefreshCount() != skippedBefore) {
+    result.skippedRefreshes++;
+    addLine(result, "R %lu unchanged", at);
+  }
+}
+
+static void runDueRefreshes(Display& display, ReplayResult& result, unsigned long startMs, unsigned long until) {
+  unsigned long wait;
+  while (millis() < until && (wait = display.msUntilRefresh(millis())) < until - millis()) {
+    simAdvanceMillis(wait);
+    refresh(display, result, startMs);
+  }
+}
+
+static ReplayResult replay(const std::vector<CapturedAdvertisement>& advs, const std::vector<DeviceKey>& keys,
+                           bool recordedPace, bool listReadings) {
+  ReplayResult result;
+  result.packets = result.decoded = result.duplicates = 0;
+  result.refreshes = result.fullRefreshes = result.skippedRefreshes = result.coalesced = 0;
+  result.publishErrors = 0;
+  result.decodeSeconds = 0;
+
+  SimPanel::instance().reset();
+  simSetMillis(REPLAY_START_MS);
+  Display display;
+  display.begin(false);
+
+  // No begin(): there is no radio or decode task, packets are decoded inline
+  VictronBLE ble;
+  for (size_t i = 0; i < keys.size(); i++) {
+    ble.addDevice(keys[i].mac, keys[i].key);
+  }
+  ble.setDisplay(&display);
+  ble.setView(0);
+
+  uint32_t crc = 0; // Over every decoded reading, so the summary catches any change
+  std::chrono::steady_clock::time_point wallStart = std::chrono::steady_clock::now();
+  uint32_t firstTime = advs.empty() ? 0 : advs[0].header.timeMs;
+
+  for (size_t i = 0; i < advs.size(); i++) {
+    const CapturedAdvertisement& adv = advs[i];
+
+    // A reboot during capture restarts the device clock; carry on from here
+    uint32_t offset = adv.header.timeMs >= firstTime ? adv.header.timeMs - firstTime : millis() - REPLAY_START_MS;
+    unsigned long now = REPLAY_START_MS + offset;
+    if (recordedPace && i > 0 && adv.header.timeMs > advs[i - 1].header.timeMs) {
+      usleep((adv.header.timeMs - advs[i - 1].header.timeMs) * 1000UL);
+    }
+    runDueRefreshes(display, result, REPLAY_START_MS, now);
+    simSetMillis(max(now, millis())); // Panel waveforms advance the clock too
+
+    std::string manufacturerData("\xE1\x02", 2);
+    manufacturerData.append((const char*)adv.payload, adv.length);
+    NimBLEAdvertisedDevice device(adv.header.mac, manufacturerData, adv.header.rssi);
+
+    uint32_t decryptsBefore = ble.getDecryptCount();
+    uint32_t skippedBefore = ble.getSkippedCount();
+    uint32_t publishedBefore = ble.getPublishCount();
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    ble.handleAdvertisement(&device);
+    ble.processPendingAdvertisements();
+    result.decodeSeconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    result.packets++;
+    result.duplicates += ble.getSkippedCount() - skippedBefore;
+
+    bool decrypted = ble.getDecryptCount() != decryptsBefore;
+    uint32_t published = ble.getPublishCount() - publishedBefore;
+    if (published != (decrypted ? 1u : 0u)) {
+      result.publishErrors++;
+      addLine(result, "P %lu published %u times", millis() - REPLAY_START_MS, published);
+    }
+
+    if (decrypted) {
+      result.decoded++;
+      int index = findDevice(keys, adv.header.mac);
+      const BatteryData& data = ble.getDeviceData(index);
+      char line[160];
+      snprintf(line, sizeof(line), "D %lu %d %.2f %.3f %.1f %.1f %u %u %d %u",
+               millis() - REPLAY_START_MS, index, data.voltage, data.current, data.soc, data.consumed_ah,
+               data.calculated_time_remaining_minutes, data.calculated_time_to_full_minutes,
+               data.time_calculation_valid, data.time_confidence);
+      crc = logCrc32((const uint8_t*)line, strlen(line), crc);
+      if (listReadings) {
+        result.lines.push_back(line);
+      }
+    }
+
+    if (display.msUntilRefresh(millis()) == 0) {
+      refresh(display, result, REPLAY_START_MS);
+    }
+  }
+
+  // Whatever the last packets left pending
+  while (display.isUpdatePending()) {
+    simAdvanceMillis(display.msUntilRefresh(millis()));
+    refresh(display, result, REPLAY_START_MS);
+  }
+
+  RefreshStats stats;
+  display.getRefreshStats(stats);
+  result.coalesced = stats.coalescedChanges;
+  result.totalSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - wallStart).count();
+  addLine(result, "S packets=%u decoded=%u duplicates=%u publish_errors=%u refreshes=%u full=%u unchanged=%u "
+          "coalesced=%u readings=%08x", result.packets, result.decoded, result.duplicates, result.publishErrors,
+          result.refreshes, result.fullRefreshes, result.skippedRefreshes, result.coalesced, crc);
+  return result;
+}
+
+// ---- Expected output ----
+
+static bool loadLines(const char* path, std::vector<std::string>& lines) {
+  FILE* f = fopen(path, "r");
+  if (!f) {
+    return false;
+  }
+  char line[256];
+  while (fgets(line, sizeof(line), f)) {
+    line[strcspn(line, "\r\n")] = '\0';
+    if (line[0] != '\0' && line[0] != '#') {
+      lines.push_back(line);
+    }
+  }
+  fclose(f);
+  return true;
+}
+
+// Prints the first differences; returns how many lines differ
+static uint32_t compareLines(const std::vector<std::string>& expected, const std::vector<std::string>& actual) {
+  uint32_t differences = 0;
+  size_t count = max(expected.size(), actual.size());
+  for (size_t i = 0; i < count; i++) {
+    const char* want = i < expected.size() ? expected[i].c_str() : "(end)";
+    const char* got = i < actual.size() ? actual[i].c_str() : "(end)";
+    if (strcmp(want, got) != 0) {
+      if (differences < 5) {
+        printf("line %zu:\n  expected %s\n  got      %s\n", i + 1, want, got);
+      }
+      differences++;
+    }
+  }
+  return differences;
+}
+
+int main(int argc, char** argv) {
+  const char* capturePath = nullptr;
+  const char* expectedPath = nullptr;
+  const char* updatePath = nullptr;
+  const char* synthPath = nullptr;
+  unsigned long synthSeconds = SYNTH_DEFAULT_S;
+  bool recordedPace = false;
+  bool listReadings = false;
+  std::vector<DeviceKey> keys;
+
+  for (int i = 1; i < argc; i++) {
+    DeviceKey key;
+    if (strcmp(argv[i], "-v") == 0) {
+      Serial.enabled = true;
+    } else if (strcmp(argv[i], "-p") == 0) {
+      recordedPace = true;
+    } else if (strcmp(argv[i], "-a") == 0) {
+      listReadings = true;
+    } else if (strcmp(argv[i], "-k") == 0 && i + 1 < argc && parseDeviceKey(argv[i + 1], key)) {
+      keys.push_back(key);
+      i++;
+    } else if (strcmp(argv[i], "-e") == 0 && i + 1 < argc) {
+      expectedPath = argv[++i];
+    } else if (strcmp(argv[i], "-u") == 0 && i + 1 < argc) {
+      updatePath = argv[++i];
+    } else if (strcmp(argv[i], "-s") == 0 && i + 2 < argc) {
+      synthSeconds = strtoul(argv[++i], nullptr, 10);
+      synthPath = argv[++i];
+    } else if (argv[i][0] != '-' && !capturePath) {
+      capturePath = argv[i];
+    } else {
+      fprintf(stderr, "usage: %s [-v] [-p] [-a] [-k mac:key]... [-e expected | -u expected] [capture]\n"
+                      "       %s -s seconds out.cap\n", argv[0], argv[0]);
+      return 2;
+    }
+  }
+
+  if (keys.empty()) {
+    DeviceKey key;
+    strcpy(key.mac, INSTANT_READOUT_MAC_ADDRESS);
+    strcpy(key.key, INSTANT_READOUT_ENCRYPTION_KEY);
+    keys.push_back(key);
+  }
+
+  std::vector<CapturedAdvertisement> advs;
+  if (synthPath || !capturePath) {
+    synthesizeCapture(keys[0], synthSeconds, advs);
+    if (synthPath) {
+      if (!writeCapture(synthPath, advs)) {
+        fprintf(stderr, "cannot write %s\n", synthPath);
+        return 2;
+      }
+      printf("%zu advertisements written to %s\n", advs.size(), synthPath);
+      return 0;
+    }
+    if (!expectedPath && !updatePath) {
+      expectedPath = DEFAULT_EXPECTED;
+    }
+  } else {
+    uint32_t skippedBytes = 0;
+    if (!loadCapture(capturePath, advs, skippedBytes)) {
+      fprintf(stderr, "cannot read %s\n", capturePath);
+      return 2;
+    }
+    if (skippedBytes > 0) {
+      printf("%u damaged bytes skipped\n", skippedBytes);
+    }
+  }
+  if (advs.empty()) {
+    fprintf(stderr, "no advertisements\n");
+    return 2;
+  }
+
+  ReplayResult result = replay(advs, keys, recordedPace, listReadings);
+
+  double capturedSeconds = (advs.back().header.timeMs - advs.front().header.timeMs) / 1000.0;
+  printf("%u packets over %.0f s of capture: %u decoded, %u duplicates skipped\n",
+         result.packets, capturedSeconds, result.decoded, result.duplicates);
+  printf("decode path: %.0f packets/s (%.2f us each), whole replay %.0f packets/s\n",
+         result.packets / result.decodeSeconds, result.decodeSeconds * 1e6 / result.packets,
+         result.packets / result.totalSeconds);
+  printf("refresh decisions: %u refreshes (%u full), %u rendered unchanged, %u changes coalesced\n",
+         result.refreshes, result.fullRefreshes, result.skippedRefreshes, result.coalesced);
+  printf("publications: %u packets not published exactly once\n", result.publishErrors);
+
+  if (updatePath) {
+    FILE* f = fopen(updatePath, "w");
+    if (!f) {
+      fprintf(stderr, "cannot write %s\n", updatePath);
+      return 2;
+    }
+    fprintf(f, "# adv_replay output: R <ms> refresh decision, D <ms> decoded reading (-a), "
+               "P <ms> packet not published exactly once, S summary\n");
+    for (size_t i = 0; i < result.lines.size(); i++) {
+      fprintf(f, "%s\n", result.lines[i].c_str());
+    }
+    fclose(f);
+    printf("expected output written to %s\n", updatePath);
+    return 0;
+  }
+
+  if (expectedPath) {
+    std::vector<std::string> expected;
+    if (!loadLines(expectedPath, expected)) {
+      fprintf(stderr, "cannot read %s\n", expectedPath);
+      return 2;
+    }
+    uint32_t differences = compareLines(expected, result.lines);
+    if (differences > 0) {
+      printf("DIVERGED: %u of %zu lines differ from %s\n", differences, max(expected.size(), result.lines.size()),
+             expectedPath);
+      return 1;
+    }
+    printf("matches %s (%zu lines)\n", expectedPath, expected.size());
+  }
+  // A decoded packet reaches the display once, a duplicate not at all, whatever the capture
+  return result.publishErrors > 0 ? 1 : 0;
+}
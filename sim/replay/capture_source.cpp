@@ -0,0 +1,162 @@
+#include <Arduino.h>
+#include <string>
+#include "capture_source.h"
+#include "device_table.h"
+#include "victron_record.h"
+#include "config.h"
+
+// ---- Capture input ----
+
+static void parseBytes(const uint8_t* data, size_t length, CaptureFrameParser& parser,
+                       std::vector<CapturedAdvertisement>& out) {
+  CapturedAdvertisement adv;
+  bool complete;
+  size_t used = 0;
+  do {
+    used += parser.feed(data + used, length - used, adv, complete);
+    if (complete) {
+      out.push_back(adv);
+    }
+  } while (complete || used < length);
+}
+
+static int hexValue(char c) {
+  if (c >= '0' && c <= '9') return c - '0';
+  if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+  if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+  return -1;
+}
+
+bool loadCapture(const char* path, std::vector<CapturedAdvertisement>& out, uint32_t& skippedBytes) {
+  FILE* f = fopen(path, "rb");
+  if (!f) {
+    return false;
+  }
+  std::vector<uint8_t> bytes;
+  uint8_t chunk[4096];
+  size_t n;
+  while ((n = fread(chunk, 1, sizeof(chunk), f)) > 0) {
+    bytes.insert(bytes.end(), chunk, chunk + n);
+  }
+  fclose(f);
+
+  CaptureFrameParser parser;
+  std::string text(bytes.begin(), bytes.end());
+  if (text.find(CAPTURE_LINE_PREFIX) == std::string::npos) {
+    parseBytes(bytes.data(), bytes.size(), parser, out);
+  } else {
+    size_t pos = 0;
+    while ((pos = text.find(CAPTURE_LINE_PREFIX, pos)) != std::string::npos) {
+      pos += strlen(CAPTURE_LINE_PREFIX);
+      std::vector<uint8_t> frame;
+      int hi, lo;
+      while (pos + 1 < text.size() && (hi = hexValue(text[pos])) >= 0 && (lo = hexValue(text[pos + 1])) >= 0) {
+        frame.push_back(hi << 4 | lo);
+        pos += 2;
+      }
+      parseBytes(frame.data(), frame.size(), parser, out);
+    }
+  }
+  skippedBytes = parser.getSkippedBytes();
+  return true;
+}
+
+// ---- Synthetic capture ----
+
+// Stores value in a record field, the inverse of BitField::read
+template <typename Field>
+static void putField(uint8_t* data, int32_t value) {
+  uint32_t raw = (uint32_t)value & Field::mask;
+  for (uint8_t bit = 0; bit < Field::width; bit++) {
+    uint16_t at = Field::offset + bit;
+    if (raw & (1u << bit)) {
+      data[at / 8] |= 1 << (at % 8);
+    } else {
+      data[at / 8] &= ~(1 << (at % 8));
+    }
+  }
+}
+
+// Base load, a fridge compressor cycling, a water pump now and then and solar
+// in the middle of the run
+void synthesizeCapture(const DeviceKey& device, unsigned long seconds, std::vector<CapturedAdvertisement>& out) {
+  uint64_t mac;
+  DeviceTable::parseMac(device.mac, mac);
+  uint8_t key[16];
+  for (int i = 0; i < 16; i++) {
+    key[i] = hexValue(device.key[2 * i]) << 4 | hexValue(device.key[2 * i + 1]);
+  }
+  mbedtls_aes_context aes;
+  mbedtls_aes_init(&aes);
+  mbedtls_aes_setkey_enc(&aes, key, 128);
+
+  uint32_t noise = 12345;
+  float consumedAh = -12.0f;
+  for (unsigned long t = 0; t < seconds; t++) {
+    noise = noise * 1103515245u + 12345u;
+    float jitter = ((int)((noise >> 16) % 200) - 100) * 0.001f;
+    float current = -1.8f + jitter;
+    if (t % 1200 < 480) current -= 4.2f;                  // Compressor, 8 of every 20 minutes
+    if (t % 900 >= 300 && t % 900 < 330) current -= 6.5f; // Pump
+    if (t >= seconds / 3 && t < 2 * seconds / 3) current += 9.0f; // Solar
+    consumedAh += current / 3600.0f;
+    float soc = 100.0f + consumedAh / BATTERY_CAPACITY_AH * 100.0f;
+    float voltage = 13.10f + current * 0.015f + soc * 0.002f;
+
+    uint8_t plain[SmartShuntRecord::LONG_RECORD_LENGTH];
+    memset(plain, 0xFF, sizeof(plain));
+    putField<SmartShuntRecord::TimeToGo>(plain, current < 0 ? (int32_t)(soc * 60.0f / -current) : 0xFFFF);
+    putField<SmartShuntRecord::BatteryVoltage>(plain, (int32_t)lroundf(voltage * 100.0f));
+    putField<SmartShuntRecord::AlarmReason>(plain, 0);
+    putField<SmartShuntRecord::AuxInputType>(plain, 1);
+    putField<SmartShuntRecord::BatteryCurrent>(plain, (int32_t)lroundf(current * 1000.0f));
+    putField<SmartShuntRecord::ConsumedAh>(plain, (int32_t)lroundf(-consumedAh * 10.0f));
+    putField<SmartShuntRecord::StateOfCharge>(plain, (int32_t)lroundf(soc * 10.0f));
+
+    // Header as the SmartShunt sends it: prefix, model, record type, nonce, first key byte
+    uint16_t nonce = t;
+    uint8_t payload[8 + sizeof(plain)] = {0x10, 0x00, 0xA3, 0x89, VICTRON_RECORD_BATTERY_MONITOR,
+                                          (uint8_t)nonce, (uint8_t)(nonce >> 8), key[0]};
+    uint8_t counter[16] = {(uint8_t)nonce, (uint8_t)(nonce >> 8)};
+    uint8_t stream[16];
+    size_t offset = 0;
+    mbedtls_aes_crypt_ctr(&aes, sizeof(plain), &offset, counter, stream, plain, payload + 8);
+
+    for (int r = 0; r < SYNTH_REPEATS; r++) {
+      CapturedAdvertisement adv;
+      adv.header.timeMs = t * 1000UL + r * SYNTH_REPEAT_MS;
+      for (int b = 0; b < 6; b++) {
+        adv.header.mac[b] = (mac >> (8 * b)) & 0xFF;
+      }
+      adv.header.rssi = -70 - (int)((noise >> (8 + r)) % 6);
+      adv.length = sizeof(payload);
+      memcpy(adv.payload, payload, sizeof(payload));
+      out.push_back(adv);
+    }
+  }
+  mbedtls_aes_free(&aes);
+}
+
+bool writeCapture(const char* path, const std::vector<CapturedAdvertisement>& advs) {
+  FILE* f = fopen(path, "wb");
+  if (!f) {
+    return false;
+  }
+  uint8_t frame[CAPTURE_FRAME_MAX];
+  for (size_t i = 0; i < advs.size(); i++) {
+    size_t length = captureEncodeFrame(advs[i].header, advs[i].payload, advs[i].length, frame);
+    fwrite(frame, 1, length, f);
+  }
+  return fclose(f) == 0;
+}
+
+bool parseDeviceKey(const char* arg, DeviceKey& key) {
+  const char* colon = strchr(arg, ':');
+  if (!colon || colon - arg != 12 || strlen(colon + 1) != 32) {
+    return false;
+  }
+  memcpy(key.mac, arg, 12);
+  key.mac[12] = '\0';
+  strcpy(key.key, colon + 1);
+  return true;
+}
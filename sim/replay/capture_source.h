@@ -0,0 +1,30 @@
+#ifndef SIM_CAPTURE_SOURCE_H
+#define SIM_CAPTURE_SOURCE_H
+
+// Advertisements for the host tools: captures read from disk (ADV_CAPTURE)
+// and a synthetic SmartShunt encrypted with a configured key. Shared by
+// adv_replay and the native simulator.
+
+#include <vector>
+#include "capture_format.h"
+
+#define SYNTH_REPEATS 3             // Each reading is advertised this many times
+#define SYNTH_REPEAT_MS 330
+
+struct DeviceKey {
+  char mac[13];
+  char key[33];
+};
+
+// "mac:key" as 12 and 32 hex digits
+bool parseDeviceKey(const char* arg, DeviceKey& key);
+
+// Binary frames, or a serial log holding them as "CAP" hex lines
+bool loadCapture(const char* path, std::vector<CapturedAdvertisement>& out, uint32_t& skippedBytes);
+bool writeCapture(const char* path, const std::vector<CapturedAdvertisement>& advs);
+
+// One reading a second for the given length, starting at time 0: a day-like
+// load on a 100 Ah bank with solar through the middle third
+void synthesizeCapture(const DeviceKey& device, unsigned long seconds, std::vector<CapturedAdvertisement>& out);
+
+#endif // SIM_CAPTURE_SOURCE_H
@@ -0,0 +1,238 @@
+// Host stress test for SeqLock<BatteryData>: one writer thread publishes
+// readings flat out, as the decode task does, while reader threads copy them
+// as the main loop and the web server do. Every reading is built from a
+// counter so a copy that mixes two writes is recognised. The same run against
+// a copy that skips the sequence check shows what the lock prevents. Exits 1
+// if any reader saw a torn or out-of-order reading through the seqlock.
+//
+//   seqlock_stress [-s seconds] [-r readers]
+//
+//   -s  length of each stress run (default 2)
+//   -r  reader threads (default 3)
+//
+// Costs are this host's, where BatteryData is also a few words larger than on
+// the ESP32; compare them with each other (read vs. write vs. a plain copy).
+
+#include <Arduino.h>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+#include "display.h"
+#include "seqlock.h"
+
+typedef std::chrono::steady_clock Clock;
+
+#define UNCONTENDED_OPS 10000000UL
+#define COUNTER_MASK 0xFFFFF          // Exact in a float
+
+static volatile uint32_t sink;        // Keeps the timed loops from being optimised away
+
+// Every field follows from n, so one reading's fields cannot pass for another's
+static BatteryData makeReading(uint32_t n) {
+  n &= COUNTER_MASK;
+  BatteryData data;
+  data.voltage = (float)n;
+  data.current = -(float)n;
+  data.power = (float)n * 0.5f;
+  data.soc = (float)(n % 1000);
+  data.consumed_ah = (float)n * 0.25f;
+  data.ttg_minutes = n & 0xFFFF;
+  data.aux_value = (float)(n ^ 0x5555);
+  data.aux_type = n & 3;
+  data.alarms = (n >> 4) & 0xFFFF;
+  data.rssi = -(int8_t)(n & 0x7F);
+  data.data_valid = true;
+  data.last_update = n;
+  data.calculated_time_remaining_minutes = (n * 7) & 0xFFFF;
+  data.calculated_time_to_full_minutes = (n * 13) & 0xFFFF;
+  data.time_calculation_valid = n & 1;
+  data.time_confidence = n % 101;
+  return data;
+}
+
+// Field by field: padding bytes are not part of a reading
+static bool consistent(const BatteryData& data) {
+  BatteryData e = makeReading(data.last_update);
+  return data.voltage == e.voltage && data.current == e.current && data.power == e.power &&
+         data.soc == e.soc && data.consumed_ah == e.consumed_ah && data.ttg_minutes == e.ttg_minutes &&
+         data.aux_value == e.aux_value && data.aux_type == e.aux_type && data.alarms == e.alarms &&
+         data.rssi == e.rssi && data.data_valid == e.data_valid && data.last_update == e.last_update &&
+         data.calculated_time_remaining_minutes == e.calculated_time_remaining_minutes &&
+         data.calculated_time_to_full_minutes == e.calculated_time_to_full_minutes &&
+         data.time_calculation_valid == e.time_calculation_valid && data.time_confidence == e.time_confidence;
+}
+
+// The seqlock's word copy without the sequence check: what unsynchronized
+// sharing of the struct amounts to, minus the undefined behaviour
+class UncheckedCopy {
+private:
+  static const size_t WORDS = (sizeof(BatteryData) + 3) / 4;
+  std::atomic<uint32_t> words[WORDS];
+
+public:
+  UncheckedCopy() {
+    for (size_t i = 0; i < WORDS; i++) {
+      words[i].store(0, std::memory_order_relaxed);
+    }
+  }
+
+  void write(const BatteryData& value) {
+    uint32_t buffer[WORDS];
+    buffer[WORDS - 1] = 0;
+    memcpy(buffer, &value, sizeof(value));
+    for (size_t i = 0; i < WORDS; i++) {
+      words[i].store(buffer[i], std::memory_order_relaxed);
+    }
+  }
+
+  bool tryRead(BatteryData& out) const {
+    uint32_t buffer[WORDS];
+    for (size_t i = 0; i < WORDS; i++) {
+      buffer[i] = words[i].load(std::memory_order_relaxed);
+    }
+    memcpy(&out, buffer, sizeof(out));
+    return true;
+  }
+};
+
+struct ReaderStats {
+  uint64_t reads = 0;
+  uint64_t retries = 0;     // Attempts that overlapped a write, spinning on one included
+  uint64_t torn = 0;        // Copies mixing two readings
+  uint64_t backwards = 0;   // Copies older than one this reader already had
+};
+
+struct StressResult {
+  uint64_t writes = 0;
+  ReaderStats readers;
+  double seconds = 0;
+};
+
+template <typename Shared>
+static StressResult stress(double seconds, int readerCount) {
+  Shared shared;
+  shared.write(makeReading(1));
+  std::atomic<bool> running(true);
+  std::vector<ReaderStats> stats(readerCount);
+  std::vector<std::thread> readers;
+
+  for (int r = 0; r < readerCount; r++) {
+    readers.push_back(std::thread([&shared, &running, &stats, r]() {
+      ReaderStats& own = stats[r];
+      uint32_t newest = 0;
+      BatteryData data;
+      while (running.load(std::memory_order_relaxed)) {
+        if (!shared.tryRead(data)) {
+          own.retries++;
+          continue;
+        }
+        own.reads++;
+        if (!consistent(data)) {
+          own.torn++;
+        } else if (((data.last_update - newest) & COUNTER_MASK) > COUNTER_MASK / 2) {
+          own.backwards++;
+        } else {
+          newest = data.last_update;
+        }
+      }
+    }));
+  }
+
+  StressResult result;
+  Clock::time_point start = Clock::now();
+  Clock::time_point end = start + std::chrono::microseconds((long long)(seconds * 1e6));
+  uint32_t n = 1;
+  while (Clock::now() < end) {
+    for (int i = 0; i < 256; i++) {
+      shared.write(makeReading(++n));
+    }
+    result.writes += 256;
+  }
+  running.store(false);
+  for (size_t r = 0; r < readers.size(); r++) {
+    readers[r].join();
+  }
+  result.seconds = std::chrono::duration<double>(Clock::now() - start).count();
+
+  for (int r = 0; r < readerCount; r++) {
+    result.readers.reads += stats[r].reads;
+    result.readers.retries += stats[r].retries;
+    result.readers.torn += stats[r].torn;
+    result.readers.backwards += stats[r].backwards;
+  }
+  return result;
+}
+
+static void printStress(const char* name, const StressResult& result) {
+  const ReaderStats& r = result.readers;
+  printf("%-10s %10.0f writes/s %10.0f reads/s  retries %5.2f%%  torn %llu  backwards %llu\n", name,
+         result.writes / result.seconds, r.reads / result.seconds,
+         r.reads + r.retries ? r.retries * 100.0 / (r.reads + r.retries) : 0.0,
+         (unsigned long long)r.torn, (unsigned long long)r.backwards);
+}
+
+// Single thread: the cost of one write and one read with nothing in the way
+static void timeUncontended() {
+  SeqLock<BatteryData> lock;
+  BatteryData data = makeReading(7);
+  BatteryData copy;
+
+  Clock::time_point start = Clock::now();
+  for (unsigned long i = 0; i < UNCONTENDED_OPS; i++) {
+    data.last_update = i;
+    lock.write(data);
+  }
+  double writeNs = std::chrono::duration<double, std::nano>(Clock::now() - start).count() / UNCONTENDED_OPS;
+
+  start = Clock::now();
+  for (unsigned long i = 0; i < UNCONTENDED_OPS; i++) {
+    lock.read(copy);
+    sink = copy.last_update;
+  }
+  double readNs = std::chrono::duration<double, std::nano>(Clock::now() - start).count() / UNCONTENDED_OPS;
+
+  start = Clock::now();
+  for (unsigned long i = 0; i < UNCONTENDED_OPS; i++) {
+    data.last_update = i;
+    memcpy(&copy, &data, sizeof(copy));
+    __asm__ __volatile__("" : : "r"(&copy) : "memory");
+    sink = copy.last_update;
+  }
+  double copyNs = std::chrono::duration<double, std::nano>(Clock::now() - start).count() / UNCONTENDED_OPS;
+
+  printf("uncontended (%zu-byte BatteryData): write %.1f ns, read %.1f ns, plain struct copy %.1f ns\n",
+         sizeof(BatteryData), writeNs, readNs, copyNs);
+}
+
+int main(int argc, char** argv) {
+  double seconds = 2;
+  int readerCount = 3;
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "-s") == 0 && i + 1 < argc) {
+      seconds = atof(argv[++i]);
+    } else if (strcmp(argv[i], "-r") == 0 && i + 1 < argc) {
+      readerCount = max(1, atoi(argv[++i]));
+    } else {
+      fprintf(stderr, "usage: %s [-s seconds] [-r readers]\n", argv[0]);
+      return 2;
+    }
+  }
+
+  timeUncontended();
+  printf("1 writer, %d readers, %.1f s each, %u hardware threads:\n", readerCount, seconds,
+         std::thread::hardware_concurrency());
+  StressResult locked = stress<SeqLock<BatteryData> >(seconds, readerCount);
+  printStress("seqlock", locked);
+  StressResult unchecked = stress<UncheckedCopy>(seconds, readerCount);
+  printStress("unchecked", unchecked);
+
+  if (unchecked.readers.torn == 0) {
+    printf("(no torn copies without the lock either; try more readers or a longer run)\n");
+  }
+  if (locked.readers.torn > 0 || locked.readers.backwards > 0) {
+    printf("FAILED: the seqlock let a torn or out-of-order reading through\n");
+    return 1;
+  }
+  return 0;
+}
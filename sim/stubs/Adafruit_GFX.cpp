@@ -0,0 +1,150 @@
+#include "Adafruit_GFX.h"
+
+Adafruit_GFX::Adafruit_GFX(int16_t w, int16_t h) : WIDTH(w), HEIGHT(h), _width(w), _height(h) {}
+
+void Adafruit_GFX::fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+  for (int16_t i = x; i < x + w; i++) {
+    drawFastVLine(i, y, h, color);
+  }
+}
+
+void Adafruit_GFX::fillScreen(uint16_t color) {
+  fillRect(0, 0, _width, _height, color);
+}
+
+void Adafruit_GFX::drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
+  for (int16_t i = 0; i < w; i++) {
+    drawPixel(x + i, y, color);
+  }
+}
+
+void Adafruit_GFX::drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) {
+  for (int16_t i = 0; i < h; i++) {
+    drawPixel(x, y + i, color);
+  }
+}
+
+void Adafruit_GFX::drawRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+  drawFastHLine(x, y, w, color);
+  drawFastHLine(x, y + h - 1, w, color);
+  drawFastVLine(x, y, h, color);
+  drawFastVLine(x + w - 1, y, h, color);
+}
+
+void Adafruit_GFX::setRotation(uint8_t r) {
+  rotation = r & 3;
+  if (rotation & 1) {
+    _width = HEIGHT;
+    _height = WIDTH;
+  } else {
+    _width = WIDTH;
+    _height = HEIGHT;
+  }
+}
+
+void Adafruit_GFX::setFont(const GFXfont* f) {
+  // Same baseline shift the library applies when switching font families
+  if (f && !gfxFont) {
+    cursor_y += 6;
+  } else if (!f && gfxFont) {
+    cursor_y -= 6;
+  }
+  gfxFont = f;
+}
+
+size_t Adafruit_GFX::write(uint8_t c) {
+  if (!gfxFont) {
+    // Classic font: not rendered, keep the cursor arithmetic
+    if (c == '\n') {
+      cursor_x = 0;
+      cursor_y += 8;
+    } else if (c != '\r') {
+      cursor_x += 6;
+    }
+    return 1;
+  }
+
+  if (c == '\n') {
+    cursor_x = 0;
+    cursor_y += gfxFont->yAdvance;
+  } else if (c != '\r' && c >= gfxFont->first && c <= gfxFont->last) {
+    const GFXglyph* glyph = &gfxFont->glyph[c - gfxFont->first];
+    if (glyph->width > 0 && glyph->height > 0) {
+      if (wrap && cursor_x + glyph->xOffset + glyph->width > _width) {
+        cursor_x = 0;
+        cursor_y += gfxFont->yAdvance;
+      }
+      drawGlyph(cursor_x, cursor_y, glyph, textcolor);
+    }
+    cursor_x += glyph->xAdvance;
+  }
+  return 1;
+}
+
+void Adafruit_GFX::drawGlyph(int16_t x, int16_t y, const GFXglyph* glyph, uint16_t color) {
+  const uint8_t* bitmap = gfxFont->bitmap;
+  uint16_t offset = glyph->bitmapOffset;
+  uint8_t bits = 0;
+  uint8_t bit = 0;
+
+  for (uint8_t yy = 0; yy < glyph->height; yy++) {
+    for (uint8_t xx = 0; xx < glyph->width; xx++) {
+      if (!(bit++ & 7)) {
+        bits = pgm_read_byte(&bitmap[offset++]);
+      }
+      if (bits & 0x80) {
+        drawPixel(x + glyph->xOffset + xx, y + glyph->yOffset + yy, color);
+      }
+      bits <<= 1;
+    }
+  }
+}
+
+GFXcanvas1::GFXcanvas1(uint16_t w, uint16_t h) : Adafruit_GFX(w, h) {
+  size_t bytes = ((w + 7) / 8) * h;
+  buffer = (uint8_t*)malloc(bytes);
+  if (buffer) {
+    memset(buffer, 0, bytes);
+  }
+}
+
+GFXcanvas1::~GFXcanvas1() {
+  free(buffer);
+}
+
+void GFXcanvas1::drawPixel(int16_t x, int16_t y, uint16_t color) {
+  if (!buffer || x < 0 || y < 0 || x >= _width || y >= _height) {
+    return;
+  }
+
+  int16_t t;
+  switch (rotation) {
+    case 1:
+      t = x;
+      x = WIDTH - 1 - y;
+      y = t;
+      break;
+    case 2:
+      x = WIDTH - 1 - x;
+      y = HEIGHT - 1 - y;
+      break;
+    case 3:
+      t = x;
+      x = y;
+      y = HEIGHT - 1 - t;
+      break;
+  }
+
+  uint8_t* ptr = &buffer[(x / 8) + y * ((WIDTH + 7) / 8)];
+  if (color) {
+    *ptr |= 0x80 >> (x & 7);
+  } else {
+    *ptr &= ~(0x80 >> (x & 7));
+  }
+}
+
+void GFXcanvas1::fillScreen(uint16_t color) {
+  if (buffer) {
+    memset(buffer, color ? 0xFF : 0x00, ((WIDTH + 7) / 8) * HEIGHT);
+  }
+}
@@ -0,0 +1,84 @@
+#ifndef SIM_ADAFRUIT_GFX_H
+#define SIM_ADAFRUIT_GFX_H
+
+// Host stand-in for the parts of Adafruit GFX the display code uses. Pixel
+// placement, rotation and custom-font glyph rendering follow the library so
+// frames match what the device draws, apart from the glyph shapes of the
+// SimMonoBold substitute fonts in Fonts/. The classic built-in 5x7 font is not included:
+// text without a custom font only advances the cursor.
+
+#include <Arduino.h>
+
+typedef struct {
+  uint16_t bitmapOffset;
+  uint8_t width;
+  uint8_t height;
+  uint8_t xAdvance;
+  int8_t xOffset;
+  int8_t yOffset;
+} GFXglyph;
+
+typedef struct {
+  uint8_t* bitmap;
+  GFXglyph* glyph;
+  uint16_t first;
+  uint16_t last;
+  uint8_t yAdvance;
+} GFXfont;
+
+class Adafruit_GFX : public Print {
+public:
+  Adafruit_GFX(int16_t w, int16_t h);
+  virtual ~Adafruit_GFX() {}
+
+  virtual void drawPixel(int16_t x, int16_t y, uint16_t color) = 0;
+
+  virtual void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+  virtual void fillScreen(uint16_t color);
+  void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color);
+  void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color);
+  void drawRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+
+  void setRotation(uint8_t r);
+  uint8_t getRotation() const { return rotation; }
+  int16_t width() const { return _width; }
+  int16_t height() const { return _height; }
+
+  void setCursor(int16_t x, int16_t y) { cursor_x = x; cursor_y = y; }
+  void setTextColor(uint16_t c) { textcolor = c; }
+  void setTextWrap(bool w) { wrap = w; }
+  void setFont(const GFXfont* f = nullptr);
+
+  size_t write(uint8_t c) override;
+  using Print::write;
+
+protected:
+  const int16_t WIDTH;
+  const int16_t HEIGHT;
+  int16_t _width;
+  int16_t _height;
+  int16_t cursor_x = 0;
+  int16_t cursor_y = 0;
+  uint16_t textcolor = 0xFFFF;
+  uint8_t rotation = 0;
+  bool wrap = true;
+  const GFXfont* gfxFont = nullptr;
+
+  void drawGlyph(int16_t x, int16_t y, const GFXglyph* glyph, uint16_t color);
+};
+
+// 1bpp off-screen canvas; rows of (WIDTH + 7) / 8 bytes, MSB first, set bit = white
+class GFXcanvas1 : public Adafruit_GFX {
+public:
+  GFXcanvas1(uint16_t w, uint16_t h);
+  ~GFXcanvas1();
+
+  void drawPixel(int16_t x, int16_t y, uint16_t color) override;
+  void fillScreen(uint16_t color) override;
+  uint8_t* getBuffer() const { return buffer; }
+
+private:
+  uint8_t* buffer;
+};
+
+#endif // SIM_ADAFRUIT_GFX_H
@@ -0,0 +1,128 @@
+#include <Arduino.h>
+#include <SPI.h>
+#include <chrono>
+
+HardwareSerial Serial;
+SPIClass SPI;
+EspClass ESP;
+
+static unsigned long simClockMs = 0;
+static SimBackgroundHook backgroundHook = nullptr;
+static bool inBackground = false;
+
+unsigned long millis() {
+  return simClockMs;
+}
+
+unsigned long micros() {
+  return simClockMs * 1000UL;
+}
+
+void delay(unsigned long ms) {
+  simBlock(ms, nullptr);
+}
+
+void simSetMillis(unsigned long ms) {
+  simClockMs = ms;
+}
+
+void simAdvanceMillis(unsigned long ms) {
+  simClockMs += ms;
+}
+
+void simSetBackgroundHook(SimBackgroundHook hook) {
+  backgroundHook = hook;
+}
+
+void simBlock(unsigned long ms, bool (*wake)()) {
+  unsigned long start = simClockMs;
+  // Background work that blocks (a panel refresh it triggers) only passes time
+  if (!backgroundHook || inBackground) {
+    simClockMs += ms;
+    return;
+  }
+  while (!(wake && wake()) && simClockMs - start < ms) {
+    unsigned long before = simClockMs;
+    inBackground = true;
+    backgroundHook(start + ms);
+    inBackground = false;
+    if (simClockMs == before && !(wake && wake())) {
+      break; // The hook has nothing left to run
+    }
+  }
+}
+
+// ---- GPIO ----
+
+#define SIM_PIN_COUNT 49
+
+struct SimPin {
+  uint8_t level;
+  void (*handler)();
+  int mode;
+};
+
+static SimPin pins[SIM_PIN_COUNT];
+static bool pinsReady = false;
+
+static SimPin* pinAt(uint8_t pin) {
+  if (!pinsReady) {
+    for (uint8_t i = 0; i < SIM_PIN_COUNT; i++) {
+      pins[i].level = HIGH;
+      pins[i].handler = nullptr;
+      pins[i].mode = 0;
+    }
+    pinsReady = true;
+  }
+  return pin < SIM_PIN_COUNT ? &pins[pin] : nullptr;
+}
+
+void pinMode(uint8_t, uint8_t) {}
+
+void digitalWrite(uint8_t pin, uint8_t value) {
+  SimPin* p = pinAt(pin);
+  if (p) {
+    p->level = value ? HIGH : LOW;
+  }
+}
+
+int digitalRead(uint8_t pin) {
+  SimPin* p = pinAt(pin);
+  return p ? p->level : HIGH;
+}
+
+void simSetPin(uint8_t pin, uint8_t value) {
+  SimPin* p = pinAt(pin);
+  if (!p) {
+    return;
+  }
+  uint8_t previous = p->level;
+  p->level = value ? HIGH : LOW;
+  if (!p->handler || p->level == previous) {
+    return;
+  }
+  if (p->mode == CHANGE || (p->mode == RISING && p->level == HIGH) || (p->mode == FALLING && p->level == LOW)) {
+    p->handler();
+  }
+}
+
+void attachInterrupt(uint8_t pin, void (*handler)(), int mode) {
+  SimPin* p = pinAt(pin);
+  if (p) {
+    p->handler = handler;
+    p->mode = mode;
+  }
+}
+
+void detachInterrupt(uint8_t pin) {
+  SimPin* p = pinAt(pin);
+  if (p) {
+    p->handler = nullptr;
+  }
+}
+
+uint32_t EspClass::getCycleCount() const {
+  using namespace std::chrono;
+  uint64_t ns = duration_cast<nanoseconds>(steady_clock::now().time_since_epoch()).count();
+  return (uint32_t)(ns * getCpuFreqMHz() / 1000);
+}
@@ -0,0 +1,271 @@
+#ifndef SIM_ARDUINO_H
+#define SIM_ARDUINO_H
+
+// Minimal Arduino core stand-in for host builds of the firmware. Only what
+// src/ actually uses is provided; time comes from a virtual clock the
+// simulator advances explicitly.
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdarg.h>
+#include <string.h>
+#include <ctype.h>
+#include <math.h>
+#include <cmath>
+#include <algorithm>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+using std::min;
+using std::max;
+using std::abs;
+
+#define PROGMEM
+#define IRAM_ATTR
+// RTC memory variables share one section, which the deep sleep stand-in can
+// keep across a simulated wake (esp_sleep.h)
+#ifdef __linux__
+#define RTC_DATA_ATTR __attribute__((section("rtc_data")))
+#else
+#define RTC_DATA_ATTR
+#endif
+#define pgm_read_byte(addr) (*(const uint8_t*)(addr))
+
+#define HIGH 1
+#define LOW 0
+#define INPUT 0
+#define OUTPUT 1
+#define INPUT_PULLUP 2
+
+#define RISING 1
+#define FALLING 2
+#define CHANGE 3
+
+// Virtual clock
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void simSetMillis(unsigned long ms);
+void simAdvanceMillis(unsigned long ms);
+
+// Work that carries on while the main loop is blocked in delay() or a task
+// wait, such as the BLE decode task or a button being pressed. The hook is
+// called with the time the block ends; it advances the clock to its next
+// event or that time, whichever is first, and runs what is due. Without a
+// hook a block just moves the clock on.
+typedef void (*SimBackgroundHook)(unsigned long untilMs);
+void simSetBackgroundHook(SimBackgroundHook hook);
+
+// Blocks for up to ms of virtual time, running background work meanwhile,
+// and returns early once wake (if given) returns true
+void simBlock(unsigned long ms, bool (*wake)());
+
+// GPIO levels, HIGH until set. Setting a pin calls its interrupt handler as
+// the edge and mode say.
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t value);
+int digitalRead(uint8_t pin);
+void simSetPin(uint8_t pin, uint8_t value);
+
+inline int digitalPinToInterrupt(uint8_t pin) { return pin; }
+void attachInterrupt(uint8_t pin, void (*handler)(), int mode);
+void detachInterrupt(uint8_t pin);
+
+// Like the Arduino String, any non-empty value lives on the heap, so the
+// allocation counter sees what the device would
+class String {
+private:
+  char* buf;
+  unsigned int len;
+
+  void assign(const char* str, unsigned int n) {
+    char* next = nullptr;
+    if (n > 0) {
+      next = new char[n + 1];
+      memcpy(next, str, n);
+      next[n] = '\0';
+    }
+    delete[] buf;
+    buf = next;
+    len = n;
+  }
+
+  void append(const char* str, unsigned int n) {
+    if (n == 0) {
+      return;
+    }
+    char* next = new char[len + n + 1];
+    if (len > 0) {
+      memcpy(next, buf, len);
+    }
+    memcpy(next + len, str, n);
+    next[len + n] = '\0';
+    delete[] buf;
+    buf = next;
+    len += n;
+  }
+
+  void setNumber(const char* format, ...) {
+    char tmp[33];
+    va_list args;
+    va_start(args, format);
+    vsnprintf(tmp, sizeof(tmp), format, args);
+    va_end(args);
+    assign(tmp, strlen(tmp));
+  }
+
+public:
+  String(const char* cstr = "") : buf(nullptr), len(0) { if (cstr) assign(cstr, strlen(cstr)); }
+  String(const String& other) : buf(nullptr), len(0) { assign(other.c_str(), other.len); }
+  String(char c) : buf(nullptr), len(0) { assign(&c, 1); }
+  String(int value) : buf(nullptr), len(0) { setNumber("%d", value); }
+  String(unsigned int value) : buf(nullptr), len(0) { setNumber("%u", value); }
+  String(long value) : buf(nullptr), len(0) { setNumber("%ld", value); }
+  String(unsigned long value) : buf(nullptr), len(0) { setNumber("%lu", value); }
+  String(float value, unsigned char decimals = 2) : buf(nullptr), len(0) { setNumber("%.*f", decimals, (double)value); }
+  String(double value, unsigned char decimals = 2) : buf(nullptr), len(0) { setNumber("%.*f", decimals, value); }
+  ~String() { delete[] buf; }
+
+  String& operator=(const String& rhs) { if (this != &rhs) assign(rhs.c_str(), rhs.len); return *this; }
+
+  const char* c_str() const { return buf ? buf : ""; }
+  unsigned int length() const { return len; }
+  char charAt(unsigned int index) const { return index < len ? buf[index] : 0; }
+
+  String substring(unsigned int from, unsigned int to = (unsigned int)-1) const {
+    String r;
+    if (to > len) to = len;
+    if (from < to) r.assign(buf + from, to - from);
+    return r;
+  }
+
+  void replace(const char* find, const char* with) {
+    size_t findLen = strlen(find);
+    if (len == 0 || findLen == 0) {
+      return;
+    }
+    String r;
+    const char* pos = buf;
+    const char* hit;
+    while ((hit = strstr(pos, find)) != nullptr) {
+      r.append(pos, hit - pos);
+      r.append(with, strlen(with));
+      pos = hit + findLen;
+    }
+    r.append(pos, strlen(pos));
+    assign(r.c_str(), r.len);
+  }
+
+  void toLowerCase() {
+    for (unsigned int i = 0; i < len; i++) {
+      if (buf[i] >= 'A' && buf[i] <= 'Z') buf[i] += 'a' - 'A';
+    }
+  }
+
+  void trim() {
+    unsigned int start = 0;
+    unsigned int end = len;
+    while (start < end && isspace((unsigned char)buf[start])) start++;
+    while (end > start && isspace((unsigned char)buf[end - 1])) end--;
+    String r = substring(start, end);
+    assign(r.c_str(), r.len);
+  }
+
+  String& operator+=(const String& rhs) { append(rhs.c_str(), rhs.len); return *this; }
+  String& operator+=(const char* rhs) { append(rhs, strlen(rhs)); return *this; }
+  String& operator+=(char c) { append(&c, 1); return *this; }
+
+  friend String operator+(const String& lhs, const String& rhs) { String r(lhs); r += rhs; return r; }
+  friend String operator+(const String& lhs, const char* rhs) { String r(lhs); r += rhs; return r; }
+  friend String operator+(const char* lhs, const String& rhs) { String r(lhs); r += rhs; return r; }
+
+  bool operator==(const String& rhs) const { return strcmp(c_str(), rhs.c_str()) == 0; }
+  bool operator!=(const String& rhs) const { return !(*this == rhs); }
+};
+
+class Print {
+public:
+  virtual ~Print() {}
+  virtual size_t write(uint8_t c) = 0;
+
+  size_t write(const uint8_t* buffer, size_t size) {
+    size_t n = 0;
+    while (size--) n += write(*buffer++);
+    return n;
+  }
+  size_t write(const char* str) { return write((const uint8_t*)str, strlen(str)); }
+
+  size_t print(const char* str) { return write(str); }
+  size_t print(const String& str) { return write(str.c_str()); }
+  size_t print(char c) { return write((uint8_t)c); }
+  size_t print(int value) { return print(String(value)); }
+  size_t print(unsigned int value) { return print(String(value)); }
+  size_t print(long value) { return print(String(value)); }
+  size_t print(unsigned long value) { return print(String(value)); }
+  size_t print(double value, int decimals = 2) { return print(String(value, decimals)); }
+
+  size_t println() { return write("\r\n"); }
+  template <typename T> size_t println(const T& value) { return print(value) + println(); }
+
+  // Same 64-byte stack buffer as the ESP32 core, with its heap fallback for
+  // longer output
+  size_t printf(const char* format, ...) __attribute__((format(printf, 2, 3))) {
+    char buf[64];
+    va_list args;
+    va_start(args, format);
+    va_list copy;
+    va_copy(copy, args);
+    int n = vsnprintf(buf, sizeof(buf), format, copy);
+    va_end(copy);
+    if (n < 0) {
+      va_end(args);
+      return 0;
+    }
+    if ((size_t)n < sizeof(buf)) {
+      va_end(args);
+      return write(buf);
+    }
+    char* temp = new char[n + 1];
+    vsnprintf(temp, n + 1, format, args);
+    va_end(args);
+    size_t written = write(temp);
+    delete[] temp;
+    return written;
+  }
+};
+
+// Serial output goes to stdout when enabled; the simulator keeps it quiet so
+// log formatting does not swamp the report
+class HardwareSerial : public Print {
+public:
+  bool enabled = false;
+
+  void begin(unsigned long) {}
+  void flush() { fflush(stdout); }
+  size_t write(uint8_t c) override {
+    if (enabled) fputc(c, stdout);
+    return 1;
+  }
+  using Print::write;
+  operator bool() const { return true; }
+};
+
+extern HardwareSerial Serial;
+
+// Chip information. The cycle counter runs off the host clock at the nominal
+// CPU frequency, so it measures host time in ESP32 units; there is no heap
+// model, the heap figures are fixed.
+class EspClass {
+public:
+  uint32_t getCpuFreqMHz() const { return 240; }
+  uint32_t getFlashChipSize() const { return 16UL * 1024 * 1024; }
+  uint32_t getFreeHeap() const { return 200000; }
+  uint32_t getMinFreeHeap() const { return 200000; }
+  uint32_t getCycleCount() const;
+};
+
+extern EspClass ESP;
+
+#endif // SIM_ARDUINO_H
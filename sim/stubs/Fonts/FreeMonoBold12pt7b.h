@@ -0,0 +1,3 @@
+// The host builds draw FreeMonoBold12pt7b with the substitute SimMonoBold12pt7b
+#include "SimMonoBold12pt7b.h"
+#define FreeMonoBold12pt7b SimMonoBold12pt7b
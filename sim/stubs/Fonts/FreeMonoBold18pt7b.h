@@ -0,0 +1,3 @@
+// The host builds draw FreeMonoBold18pt7b with the substitute SimMonoBold18pt7b
+#include "SimMonoBold18pt7b.h"
+#define FreeMonoBold18pt7b SimMonoBold18pt7b
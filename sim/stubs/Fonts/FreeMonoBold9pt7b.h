@@ -0,0 +1,3 @@
+// The host builds draw FreeMonoBold9pt7b with the substitute SimMonoBold9pt7b
+#include "SimMonoBold9pt7b.h"
+#define FreeMonoBold9pt7b SimMonoBold9pt7b
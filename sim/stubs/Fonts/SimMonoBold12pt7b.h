@@ -0,0 +1,276 @@
+// SimMonoBold12pt7b: the host builds' substitute for Adafruit GFX's
+// FreeMonoBold12pt7b, with the same character advance. Source Code Pro Bold,
+// Copyright 2010, 2012 Adobe Systems Incorporated, under the SIL Open Font
+// License 1.1 (OFL.txt). Glyph shapes, extents and line height are not the
+// device's, so text extents on the panel are not checked by the sims.
+//
+// Source Code Pro converted at 12 pt by tools/font_convert
+
+const uint8_t SimMonoBold12pt7bBitmaps[] PROGMEM = {
+  0x00, 0xF3, 0x9C, 0xE7, 0x39, 0xCC, 0x60, 0x00, 0xEF, 0x7F, 0xCE, 0xF3,
+  0xFC, 0xFF, 0x3F, 0xCF, 0xF1, 0xFC, 0x76, 0x1D, 0x87, 0x61, 0xC0, 0x19,
+  0x83, 0x30, 0xC6, 0x7F, 0xFF, 0xFF, 0xFF, 0xCC, 0x61, 0x98, 0xFF, 0xDF,
+  0xFB, 0xFF, 0x31, 0x86, 0x30, 0xC6, 0x19, 0xC0, 0x0C, 0x01, 0x80, 0x30,
+  0x1F, 0x87, 0xFD, 0xFF, 0xBC, 0x67, 0x80, 0x7C, 0x0F, 0xE0, 0x7F, 0x03,
+  0xE0, 0x1F, 0xC3, 0xBF, 0xF7, 0xFC, 0x3F, 0x01, 0x80, 0x30, 0x06, 0x00,
+  0xC0, 0x3C, 0x01, 0xF8, 0x26, 0x61, 0xD9, 0xCE, 0x67, 0x71, 0x99, 0x87,
+  0xEC, 0x0F, 0x00, 0x00, 0xF0, 0x27, 0xE1, 0xD9, 0xCE, 0x67, 0x71, 0x9F,
+  0x86, 0x72, 0x1F, 0x80, 0x3C, 0x1E, 0x01, 0xF8, 0x1C, 0xE0, 0xE7, 0x07,
+  0x38, 0x3B, 0x80, 0xFC, 0x07, 0xC7, 0x7C, 0x7F, 0xF3, 0xBB, 0xDD, 0xCF,
+  0xCE, 0x3F, 0x7F, 0xFD, 0xFF, 0xE7, 0xC2, 0xFF, 0xFF, 0xF7, 0x77, 0x60,
+  0x04, 0x1C, 0x79, 0xE3, 0x8E, 0x1C, 0x38, 0x71, 0xC3, 0x87, 0x0E, 0x0C,
+  0x1C, 0x38, 0x70, 0x70, 0xF0, 0xE0, 0xE0, 0x80, 0x61, 0xC1, 0xC1, 0xC3,
+  0xC3, 0x87, 0x07, 0x0E, 0x1C, 0x38, 0x70, 0xE1, 0xC3, 0x8E, 0x1C, 0x78,
+  0xE3, 0x8F, 0x0C, 0x00, 0x0C, 0x01, 0x80, 0x30, 0x66, 0x2F, 0xFF, 0xFF,
+  0x8F, 0xC0, 0xF0, 0x3F, 0x06, 0x71, 0xC6, 0x10, 0x60, 0x0E, 0x01, 0xC0,
+  0x38, 0x07, 0x0F, 0xFF, 0xFF, 0xFF, 0xF8, 0x70, 0x0E, 0x01, 0xC0, 0x38,
+  0x00, 0x39, 0xF7, 0xDF, 0x3C, 0x71, 0xCE, 0xF9, 0x80, 0xFF, 0xFF, 0xFF,
+  0xFF, 0x80, 0x39, 0xFF, 0xFF, 0x7C, 0xE0, 0x01, 0xE0, 0x38, 0x07, 0x01,
+  0xC0, 0x38, 0x07, 0x01, 0xC0, 0x38, 0x0E, 0x01, 0xC0, 0x38, 0x0E, 0x01,
+  0xC0, 0x38, 0x0E, 0x01, 0xC0, 0x70, 0x0E, 0x01, 0xC0, 0x70, 0x0E, 0x00,
+  0x0F, 0x83, 0xFC, 0x7F, 0xE7, 0x8E, 0x70, 0xFF, 0x67, 0xFF, 0x7E, 0xF7,
+  0xF6, 0x7F, 0x07, 0x70, 0xF7, 0x8E, 0x3F, 0xE3, 0xFC, 0x0F, 0x80, 0x3E,
+  0x0F, 0xC1, 0xF8, 0x3F, 0x00, 0xE0, 0x1C, 0x03, 0x80, 0x70, 0x0E, 0x01,
+  0xC0, 0x38, 0x07, 0x0F, 0xFF, 0xFF, 0xFF, 0xF8, 0x1F, 0x07, 0xFC, 0xFF,
+  0xE6, 0x1E, 0x40, 0xE0, 0x0E, 0x01, 0xE0, 0x3C, 0x03, 0x80, 0x70, 0x1E,
+  0x03, 0xC0, 0x7F, 0xFF, 0xFF, 0xFF, 0xF0, 0x1F, 0x87, 0xFC, 0xFF, 0xE3,
+  0x1E, 0x00, 0xE0, 0x1E, 0x0F, 0xC0, 0xF8, 0x0F, 0xE0, 0x1E, 0x40, 0xF6,
+  0x0F, 0xFF, 0xE7, 0xFE, 0x1F, 0x80, 0x03, 0xC0, 0x7C, 0x0F, 0xC0, 0xFC,
+  0x1D, 0xC3, 0xDC, 0x39, 0xC7, 0x1C, 0xF1, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0x01, 0xC0, 0x1C, 0x01, 0xC0, 0x3F, 0xE3, 0xFE, 0x3F, 0xE3, 0x80, 0x78,
+  0x07, 0xF8, 0x7F, 0xE7, 0xFE, 0x21, 0xF0, 0x0F, 0x40, 0xF6, 0x1E, 0xFF,
+  0xE7, 0xFC, 0x1F, 0x00, 0x0F, 0xC1, 0xFE, 0x3F, 0xF7, 0x86, 0x70, 0x07,
+  0x3C, 0xFF, 0xEF, 0xFF, 0xF8, 0xF7, 0x07, 0x70, 0x77, 0x8F, 0x3F, 0xE1,
+  0xFE, 0x0F, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0E, 0x01, 0xC0, 0x38,
+  0x03, 0x80, 0x70, 0x07, 0x00, 0xF0, 0x0F, 0x00, 0xE0, 0x0E, 0x00, 0xE0,
+  0x0E, 0x00, 0x0F, 0x83, 0xFC, 0x7F, 0xE7, 0x8E, 0x70, 0xE3, 0xCE, 0x1F,
+  0xC3, 0xFC, 0x73, 0xE7, 0x0F, 0xF0, 0x77, 0x0F, 0x7F, 0xF3, 0xFE, 0x1F,
+  0x80, 0x1F, 0x03, 0xFC, 0x7F, 0xE7, 0x0E, 0xF0, 0xFF, 0x0F, 0xF1, 0xF7,
+  0xFF, 0x7F, 0x71, 0xEF, 0x00, 0xE2, 0x1E, 0x7F, 0xCF, 0xF8, 0x1F, 0x00,
+  0x39, 0xFF, 0xFF, 0x7C, 0xE0, 0x00, 0x39, 0xFF, 0xFF, 0x7C, 0xE0, 0x39,
+  0xFF, 0xFF, 0x7C, 0xE0, 0x00, 0x00, 0xE7, 0xDF, 0x7C, 0xF1, 0xC7, 0x3B,
+  0xE6, 0x00, 0x00, 0x80, 0xC1, 0xE1, 0xE3, 0xE3, 0xC3, 0xC1, 0xC0, 0xF0,
+  0x3C, 0x0F, 0x81, 0xE0, 0x78, 0x0C, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0x80,
+  0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xE0, 0x80, 0x38, 0x0F, 0x01,
+  0xF0, 0x3E, 0x03, 0xE0, 0x7C, 0x07, 0x07, 0xC3, 0xE3, 0xE1, 0xF0, 0xF0,
+  0x38, 0x08, 0x00, 0x1F, 0x1F, 0xEF, 0xFC, 0x8F, 0x03, 0xC0, 0xE0, 0xF0,
+  0x78, 0x1C, 0x00, 0x00, 0x00, 0x70, 0x1E, 0x0F, 0x81, 0xE0, 0x70, 0x0F,
+  0x81, 0xFE, 0x3F, 0xE7, 0x87, 0x70, 0x3E, 0x03, 0xE0, 0xFE, 0x7F, 0xC7,
+  0xFC, 0xE3, 0xCE, 0x7C, 0xFF, 0xC7, 0xFE, 0x7B, 0xE0, 0x07, 0x00, 0x78,
+  0x23, 0xFE, 0x1F, 0xE0, 0x78, 0x07, 0x80, 0x1F, 0x00, 0xFC, 0x03, 0xF0,
+  0x0E, 0xE0, 0x73, 0x81, 0xCE, 0x07, 0x3C, 0x3C, 0x70, 0xFF, 0xC3, 0xFF,
+  0x8F, 0xFE, 0x78, 0x39, 0xC0, 0xE7, 0x03, 0xFC, 0x0F, 0xFF, 0x1F, 0xFB,
+  0xFF, 0x78, 0xFF, 0x1F, 0xE3, 0xBF, 0xE7, 0xFC, 0xFF, 0xDE, 0x3F, 0xC3,
+  0xF8, 0x7F, 0x1F, 0xFF, 0xFF, 0xF7, 0xF8, 0x07, 0xC0, 0xFF, 0x8F, 0xFC,
+  0xF8, 0x47, 0x80, 0x38, 0x03, 0xC0, 0x1E, 0x00, 0xF0, 0x07, 0x80, 0x1C,
+  0x00, 0xF0, 0x07, 0xC3, 0x1F, 0xF8, 0x7F, 0xE0, 0xF8, 0xFE, 0x1F, 0xF3,
+  0xFF, 0x71, 0xEE, 0x1F, 0xC3, 0xF8, 0x3F, 0x07, 0xE0, 0xFC, 0x1F, 0x87,
+  0xF0, 0xFE, 0x3D, 0xFF, 0xBF, 0xE7, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8,
+  0x0F, 0x01, 0xE0, 0x3F, 0xF7, 0xFE, 0xFF, 0xDE, 0x03, 0xC0, 0x78, 0x0F,
+  0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xE0, 0x38,
+  0x0E, 0x03, 0xFE, 0xFF, 0xBF, 0xEE, 0x03, 0x80, 0xE0, 0x38, 0x0E, 0x03,
+  0x80, 0x07, 0xC1, 0xFE, 0x3F, 0xF7, 0xC4, 0x78, 0x0F, 0x00, 0xF0, 0x0F,
+  0x1F, 0xF1, 0xFF, 0x1F, 0xF0, 0x77, 0x87, 0x7C, 0x73, 0xFF, 0x1F, 0xF0,
+  0xFC, 0xE1, 0xFC, 0x3F, 0x87, 0xF0, 0xFE, 0x1F, 0xC3, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFC, 0x3F, 0x87, 0xF0, 0xFE, 0x1F, 0xC3, 0xF8, 0x7F, 0x0F, 0xFF,
+  0xFF, 0xFF, 0xFF, 0x8F, 0x01, 0xE0, 0x3C, 0x07, 0x80, 0xF0, 0x1E, 0x03,
+  0xC0, 0x78, 0x0F, 0x01, 0xE1, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0xE7, 0xFC,
+  0xFF, 0x80, 0x70, 0x0E, 0x01, 0xC0, 0x38, 0x07, 0x00, 0xE0, 0x1C, 0x03,
+  0x90, 0x77, 0x1F, 0xFF, 0xDF, 0xF0, 0xF8, 0xE0, 0xFE, 0x1E, 0xE3, 0xCE,
+  0x78, 0xE7, 0x8E, 0xF0, 0xFE, 0x0F, 0xF0, 0xFF, 0x0F, 0xF8, 0xF3, 0x8E,
+  0x3C, 0xE1, 0xCE, 0x1E, 0xE0, 0xEE, 0x0F, 0xE0, 0x38, 0x0E, 0x03, 0x80,
+  0xE0, 0x38, 0x0E, 0x03, 0x80, 0xE0, 0x38, 0x0E, 0x03, 0x80, 0xE0, 0x3F,
+  0xFF, 0xFF, 0xFF, 0xE1, 0xFE, 0x3F, 0xC7, 0xF9, 0xFF, 0x3F, 0xB7, 0xF6,
+  0xBE, 0xF7, 0xCE, 0xF9, 0x9F, 0x33, 0xE0, 0x7C, 0x0F, 0x81, 0xF0, 0x3E,
+  0x07, 0xE1, 0xFE, 0x3F, 0xC7, 0xFC, 0xFD, 0x9F, 0xF3, 0xFF, 0x7F, 0x6F,
+  0xEE, 0xFC, 0xDF, 0x9B, 0xF3, 0xFE, 0x3F, 0xC7, 0xF8, 0x7F, 0x0F, 0x0F,
+  0x83, 0xFC, 0x7F, 0xE7, 0x9F, 0xF0, 0xFF, 0x07, 0xF0, 0x7F, 0x07, 0xF0,
+  0x7F, 0x07, 0xF0, 0x7F, 0x0F, 0x79, 0xF7, 0xFE, 0x3F, 0xC0, 0xF8, 0xFF,
+  0x8F, 0xFC, 0xFF, 0xEE, 0x1E, 0xE0, 0xFE, 0x0F, 0xE0, 0xFE, 0x1E, 0xFF,
+  0xEF, 0xFC, 0xFF, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0x0F,
+  0x81, 0xFE, 0x1F, 0xF8, 0xF3, 0xCF, 0x0F, 0x78, 0x7B, 0xC1, 0xDC, 0x0E,
+  0xE0, 0x77, 0x83, 0xBC, 0x3D, 0xE1, 0xE7, 0x9F, 0x3F, 0xF0, 0xFF, 0x03,
+  0xF0, 0x07, 0x80, 0x3F, 0x80, 0xFE, 0x01, 0xF0, 0xFF, 0x0F, 0xFC, 0xFF,
+  0xEE, 0x1E, 0xE0, 0xEE, 0x0E, 0xE1, 0xEF, 0xFE, 0xFF, 0xCF, 0xF8, 0xE7,
+  0x8E, 0x3C, 0xE3, 0xCE, 0x1E, 0xE1, 0xEE, 0x0F, 0x0F, 0x83, 0xFE, 0x7F,
+  0xF7, 0x86, 0x70, 0x07, 0x80, 0x7F, 0x03, 0xFC, 0x1F, 0xE0, 0x3F, 0x00,
+  0xF4, 0x07, 0x70, 0xFF, 0xFF, 0x7F, 0xE1, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFE, 0x1E, 0x00, 0xF0, 0x07, 0x80, 0x3C, 0x01, 0xE0, 0x0F, 0x00, 0x78,
+  0x03, 0xC0, 0x1E, 0x00, 0xF0, 0x07, 0x80, 0x3C, 0x01, 0xE0, 0xE1, 0xFC,
+  0x3F, 0x87, 0xF0, 0xFE, 0x1F, 0xC3, 0xF8, 0x7F, 0x0F, 0xE1, 0xFC, 0x3F,
+  0x87, 0xF0, 0xFF, 0x1D, 0xFF, 0x9F, 0xE1, 0xF8, 0xF0, 0x3D, 0xC0, 0xF7,
+  0x83, 0x9E, 0x0E, 0x38, 0x78, 0xE1, 0xC3, 0xC7, 0x07, 0x1C, 0x1C, 0xF0,
+  0x73, 0x81, 0xEE, 0x03, 0xB8, 0x0F, 0xC0, 0x3F, 0x00, 0x7C, 0x01, 0xF0,
+  0xF0, 0x1F, 0xC0, 0x7F, 0x01, 0xDC, 0x07, 0x70, 0x1D, 0xCE, 0x77, 0x39,
+  0xDC, 0xE6, 0x77, 0xB9, 0xDF, 0xE7, 0x6F, 0x8D, 0xBE, 0x3C, 0xF8, 0xF3,
+  0xE3, 0xCF, 0x8F, 0x1C, 0x78, 0x3C, 0xE1, 0xE3, 0xC7, 0x07, 0x3C, 0x1E,
+  0xE0, 0x3F, 0x80, 0xFC, 0x01, 0xF0, 0x07, 0xC0, 0x3F, 0x01, 0xFE, 0x07,
+  0x38, 0x3C, 0xF0, 0xE1, 0xE7, 0x87, 0xBC, 0x0F, 0xF0, 0x3D, 0xE0, 0xE3,
+  0x87, 0x8F, 0x1C, 0x1C, 0xF0, 0x73, 0x81, 0xEE, 0x03, 0xF0, 0x0F, 0xC0,
+  0x1F, 0x00, 0x78, 0x01, 0xE0, 0x07, 0x80, 0x1E, 0x00, 0x78, 0x01, 0xE0,
+  0x7F, 0xF7, 0xFF, 0x7F, 0xF0, 0x1E, 0x01, 0xC0, 0x3C, 0x07, 0x80, 0x70,
+  0x0F, 0x01, 0xE0, 0x1C, 0x03, 0xC0, 0x78, 0x07, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0x87, 0x0E, 0x1C, 0x38, 0x70, 0xE1, 0xC3, 0x87, 0x0E, 0x1C,
+  0x38, 0x70, 0xE1, 0xC3, 0x87, 0xFF, 0xE0, 0xE0, 0x1C, 0x01, 0xC0, 0x38,
+  0x07, 0x00, 0x70, 0x0E, 0x00, 0xE0, 0x1C, 0x03, 0x80, 0x38, 0x07, 0x00,
+  0xE0, 0x0E, 0x01, 0xC0, 0x1C, 0x03, 0x80, 0x70, 0x07, 0x00, 0xE0, 0x1E,
+  0xFF, 0xFC, 0x38, 0x70, 0xE1, 0xC3, 0x87, 0x0E, 0x1C, 0x38, 0x70, 0xE1,
+  0xC3, 0x87, 0x0E, 0x1C, 0x3F, 0xFF, 0xE0, 0x0E, 0x07, 0x81, 0xF0, 0xFC,
+  0x3B, 0x0C, 0xE7, 0x39, 0xC6, 0x71, 0xF8, 0x70, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xF0, 0xF0, 0xE3, 0x87, 0x1F, 0x87, 0xFE, 0x7F, 0xE2, 0x0F, 0x07, 0xF3,
+  0xFF, 0x7F, 0xF7, 0x8F, 0xF1, 0xF7, 0xFF, 0x7F, 0xF3, 0xE7, 0xE0, 0x1C,
+  0x03, 0x80, 0x70, 0x0E, 0x01, 0xDF, 0x3F, 0xF7, 0xFF, 0xF1, 0xFC, 0x3F,
+  0x83, 0xF0, 0x7E, 0x1F, 0xE3, 0xFF, 0xF7, 0xFE, 0xEF, 0x00, 0x0F, 0x87,
+  0xFD, 0xFF, 0x7C, 0x2F, 0x01, 0xC0, 0x38, 0x07, 0x80, 0xF8, 0x4F, 0xFC,
+  0xFF, 0x8F, 0xC0, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF1, 0xEF,
+  0x3F, 0xF7, 0xFF, 0x79, 0xFF, 0x0F, 0xF0, 0xFF, 0x0F, 0xF0, 0xFF, 0x9F,
+  0x7F, 0xF3, 0xFF, 0x1E, 0x70, 0x0F, 0x83, 0xFE, 0x7F, 0xE7, 0x07, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x78, 0x27, 0xFE, 0x3F, 0xF0, 0xFC, 0x03,
+  0xE0, 0xFF, 0x0F, 0xF1, 0xE0, 0x1E, 0x0F, 0xFE, 0xFF, 0xEF, 0xFE, 0x1E,
+  0x01, 0xE0, 0x1E, 0x01, 0xE0, 0x1E, 0x01, 0xE0, 0x1E, 0x01, 0xE0, 0x1E,
+  0x00, 0x1F, 0xF9, 0xFF, 0xDF, 0xFE, 0xE1, 0xC7, 0xFE, 0x1F, 0xE0, 0xFE,
+  0x0E, 0x00, 0x70, 0x03, 0xFF, 0x0F, 0xFC, 0xFF, 0xFE, 0x07, 0xFF, 0xF9,
+  0xFF, 0x87, 0xF0, 0xE0, 0x1C, 0x03, 0x80, 0x70, 0x0E, 0x01, 0xCF, 0x3F,
+  0xF7, 0xFF, 0xF1, 0xFC, 0x3F, 0x87, 0xF0, 0xFE, 0x1F, 0xC3, 0xF8, 0x7F,
+  0x0F, 0xE1, 0xE0, 0x07, 0x07, 0xC3, 0xE0, 0xE0, 0x00, 0x03, 0xFD, 0xFE,
+  0xFF, 0x03, 0x81, 0xC0, 0xE0, 0x70, 0x38, 0x1C, 0x0E, 0x07, 0x03, 0x80,
+  0x03, 0x81, 0xF0, 0x7C, 0x0E, 0x00, 0x00, 0x07, 0xF9, 0xFE, 0x7F, 0x80,
+  0xE0, 0x38, 0x0E, 0x03, 0x80, 0xE0, 0x38, 0x0E, 0x03, 0x80, 0xE8, 0x79,
+  0xFE, 0xFF, 0x1F, 0x80, 0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x0E,
+  0x1F, 0xE3, 0xCE, 0x38, 0xE7, 0x8E, 0xF0, 0xFF, 0x0F, 0xF0, 0xFF, 0x8F,
+  0x3C, 0xE1, 0xCE, 0x1E, 0xE0, 0xF0, 0xFE, 0x0F, 0xE0, 0xFE, 0x00, 0xE0,
+  0x0E, 0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0xE0,
+  0x0E, 0x00, 0xF0, 0x0F, 0xF0, 0x7F, 0x03, 0xF0, 0xEE, 0xF7, 0xF7, 0xBF,
+  0xFF, 0xEE, 0xFE, 0x77, 0xF3, 0xBF, 0x9D, 0xFC, 0xEF, 0xE7, 0x7F, 0x3B,
+  0xF9, 0xDF, 0xCE, 0xF0, 0xE7, 0x9F, 0xFB, 0xFF, 0xF8, 0xFF, 0x1F, 0xC3,
+  0xF8, 0x7F, 0x0F, 0xE1, 0xFC, 0x3F, 0x87, 0xF0, 0xF0, 0x0F, 0x83, 0xFC,
+  0x7F, 0xE7, 0x8F, 0xF0, 0xFF, 0x07, 0xF0, 0x7F, 0x0F, 0x78, 0xF7, 0xFE,
+  0x3F, 0xC0, 0xF8, 0xEF, 0x9F, 0xFB, 0xFF, 0xF8, 0xFE, 0x1F, 0xC1, 0xF8,
+  0x3F, 0x0F, 0xF1, 0xFF, 0xFB, 0xFF, 0x77, 0x8E, 0x01, 0xC0, 0x38, 0x07,
+  0x00, 0x1E, 0x73, 0xFF, 0x7F, 0xF7, 0x9F, 0xF0, 0xFF, 0x0F, 0xF0, 0xFF,
+  0x0F, 0xF9, 0xF7, 0xFF, 0x3F, 0xF1, 0xEF, 0x00, 0xF0, 0x0F, 0x00, 0xF0,
+  0x0F, 0xE7, 0xFB, 0xFF, 0xFF, 0xE0, 0xF0, 0x38, 0x0E, 0x03, 0x80, 0xE0,
+  0x38, 0x0E, 0x03, 0x80, 0x0F, 0x83, 0xFE, 0x7F, 0xF7, 0x86, 0x7C, 0x03,
+  0xFC, 0x0F, 0xE0, 0x1F, 0x70, 0xF7, 0xFF, 0xFF, 0xE1, 0xF8, 0x0E, 0x00,
+  0xE0, 0x1E, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x1E, 0x01, 0xE0, 0x1E, 0x01,
+  0xE0, 0x1E, 0x01, 0xE0, 0x0F, 0xF0, 0xFF, 0x03, 0xE0, 0xF0, 0xFF, 0x0F,
+  0xF0, 0xFF, 0x0F, 0xF0, 0xFF, 0x0F, 0xF0, 0xFF, 0x0F, 0x71, 0xF7, 0xFF,
+  0x7F, 0x73, 0xE7, 0xE0, 0x7F, 0x83, 0x9C, 0x3C, 0xF1, 0xC7, 0x8E, 0x1C,
+  0xF0, 0xE7, 0x03, 0xB8, 0x1F, 0xC0, 0xFC, 0x03, 0xE0, 0x1E, 0x00, 0xF3,
+  0x9F, 0xCE, 0x77, 0x39, 0xDD, 0xE7, 0x77, 0x9D, 0xDE, 0xE7, 0x7F, 0x9D,
+  0xBE, 0x7E, 0xF8, 0xF3, 0xE3, 0xCF, 0x8F, 0x3E, 0xF0, 0xF7, 0x8E, 0x39,
+  0xE3, 0xDC, 0x1F, 0x80, 0xF8, 0x0F, 0x81, 0xF8, 0x3F, 0xC3, 0x9E, 0x70,
+  0xEF, 0x0F, 0xE0, 0x7F, 0x83, 0x9C, 0x1C, 0xF1, 0xC3, 0x8E, 0x1C, 0x60,
+  0x77, 0x03, 0xB8, 0x1D, 0x80, 0x7C, 0x03, 0xC0, 0x0E, 0x00, 0xF0, 0x3F,
+  0x01, 0xF0, 0x0F, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0xE0, 0x78, 0x1E,
+  0x07, 0x81, 0xE0, 0x78, 0x1F, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0x8F, 0xC7,
+  0x03, 0x01, 0x80, 0xE0, 0x70, 0x38, 0x3C, 0x7C, 0x38, 0x1F, 0x03, 0xC0,
+  0xE0, 0x70, 0x38, 0x18, 0x0C, 0x07, 0x03, 0xF0, 0xF8, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x7C, 0x07, 0x03, 0x81, 0xC0,
+  0xE0, 0x70, 0x38, 0x1C, 0x0F, 0xC1, 0xE3, 0xF1, 0xC0, 0xE0, 0x70, 0x38,
+  0x1C, 0x0E, 0x07, 0x1F, 0x0F, 0x00, 0x3E, 0x37, 0xFF, 0x7F, 0xEE, 0x3C };
+
+const GFXglyph SimMonoBold12pt7bGlyphs[] PROGMEM = {
+  {     0,   1,   1,  14,    0,    0 },   // 0x20 ' '
+  {     1,   5,  16,  14,    5,  -15 },   // 0x21 '!'
+  {    11,  10,   9,  14,    2,  -15 },   // 0x22 '"'
+  {    23,  11,  15,  14,    2,  -14 },   // 0x23 '#'
+  {    44,  11,  21,  14,    2,  -17 },   // 0x24 '$'
+  {    73,  14,  16,  14,    0,  -15 },   // 0x25 '%'
+  {   101,  13,  16,  14,    1,  -15 },   // 0x26 '&'
+  {   127,   4,   9,  14,    5,  -15 },   // 0x27 '''
+  {   132,   7,  22,  14,    4,  -17 },   // 0x28 '('
+  {   152,   7,  22,  14,    3,  -17 },   // 0x29 ')'
+  {   172,  11,  12,  14,    2,  -13 },   // 0x2A '*'
+  {   189,  11,  11,  14,    2,  -12 },   // 0x2B '+'
+  {   205,   6,  10,  14,    4,   -4 },   // 0x2C ','
+  {   213,  11,   3,  14,    2,   -8 },   // 0x2D '-'
+  {   218,   6,   6,  14,    4,   -5 },   // 0x2E '.'
+  {   223,  11,  21,  14,    2,  -16 },   // 0x2F '/'
+  {   252,  12,  15,  14,    1,  -14 },   // 0x30 '0'
+  {   275,  11,  15,  14,    2,  -14 },   // 0x31 '1'
+  {   296,  12,  15,  14,    1,  -14 },   // 0x32 '2'
+  {   319,  12,  15,  14,    1,  -14 },   // 0x33 '3'
+  {   342,  12,  15,  14,    1,  -14 },   // 0x34 '4'
+  {   365,  12,  15,  14,    1,  -14 },   // 0x35 '5'
+  {   388,  12,  15,  14,    1,  -14 },   // 0x36 '6'
+  {   411,  12,  15,  14,    1,  -14 },   // 0x37 '7'
+  {   434,  12,  15,  14,    1,  -14 },   // 0x38 '8'
+  {   457,  12,  15,  14,    1,  -14 },   // 0x39 '9'
+  {   480,   6,  14,  14,    4,  -13 },   // 0x3A ':'
+  {   491,   6,  19,  14,    4,  -13 },   // 0x3B ';'
+  {   506,   9,  15,  14,    3,  -14 },   // 0x3C '<'
+  {   523,  11,   9,  14,    2,  -11 },   // 0x3D '='
+  {   536,  10,  15,  14,    2,  -14 },   // 0x3E '>'
+  {   555,  10,  16,  14,    2,  -15 },   // 0x3F '?'
+  {   575,  12,  20,  14,    1,  -15 },   // 0x40 '@'
+  {   605,  14,  16,  14,    0,  -15 },   // 0x41 'A'
+  {   633,  11,  16,  14,    2,  -15 },   // 0x42 'B'
+  {   655,  13,  16,  14,    1,  -15 },   // 0x43 'C'
+  {   681,  11,  16,  14,    2,  -15 },   // 0x44 'D'
+  {   703,  11,  16,  14,    2,  -15 },   // 0x45 'E'
+  {   725,  10,  16,  14,    3,  -15 },   // 0x46 'F'
+  {   745,  12,  16,  14,    1,  -15 },   // 0x47 'G'
+  {   769,  11,  16,  14,    2,  -15 },   // 0x48 'H'
+  {   791,  11,  16,  14,    2,  -15 },   // 0x49 'I'
+  {   813,  11,  16,  14,    1,  -15 },   // 0x4A 'J'
+  {   835,  12,  16,  14,    2,  -15 },   // 0x4B 'K'
+  {   859,  10,  16,  14,    3,  -15 },   // 0x4C 'L'
+  {   879,  11,  16,  14,    2,  -15 },   // 0x4D 'M'
+  {   901,  11,  16,  14,    2,  -15 },   // 0x4E 'N'
+  {   923,  12,  16,  14,    1,  -15 },   // 0x4F 'O'
+  {   947,  12,  16,  14,    2,  -15 },   // 0x50 'P'
+  {   971,  13,  20,  14,    1,  -15 },   // 0x51 'Q'
+  {  1004,  12,  16,  14,    2,  -15 },   // 0x52 'R'
+  {  1028,  12,  16,  14,    1,  -15 },   // 0x53 'S'
+  {  1052,  13,  16,  14,    1,  -15 },   // 0x54 'T'
+  {  1078,  11,  16,  14,    2,  -15 },   // 0x55 'U'
+  {  1100,  14,  16,  14,    0,  -15 },   // 0x56 'V'
+  {  1128,  14,  16,  14,    0,  -15 },   // 0x57 'W'
+  {  1156,  14,  16,  14,    0,  -15 },   // 0x58 'X'
+  {  1184,  14,  16,  14,    0,  -15 },   // 0x59 'Y'
+  {  1212,  12,  16,  14,    1,  -15 },   // 0x5A 'Z'
+  {  1236,   7,  21,  14,    5,  -16 },   // 0x5B '['
+  {  1255,  11,  21,  14,    2,  -16 },   // 0x5C
+  {  1284,   7,  21,  14,    3,  -16 },   // 0x5D ']'
+  {  1303,  10,  10,  14,    2,  -15 },   // 0x5E '^'
+  {  1316,  12,   3,  14,    1,    2 },   // 0x5F '_'
+  {  1321,   6,   4,  14,    3,  -17 },   // 0x60 '`'
+  {  1324,  12,  12,  14,    1,  -11 },   // 0x61 'a'
+  {  1342,  11,  17,  14,    2,  -16 },   // 0x62 'b'
+  {  1366,  11,  12,  14,    2,  -11 },   // 0x63 'c'
+  {  1383,  12,  17,  14,    1,  -16 },   // 0x64 'd'
+  {  1409,  12,  12,  14,    1,  -11 },   // 0x65 'e'
+  {  1427,  12,  17,  14,    2,  -16 },   // 0x66 'f'
+  {  1453,  13,  16,  14,    1,  -11 },   // 0x67 'g'
+  {  1479,  11,  17,  14,    2,  -16 },   // 0x68 'h'
+  {  1503,   9,  18,  14,    2,  -17 },   // 0x69 'i'
+  {  1524,  10,  22,  14,    1,  -17 },   // 0x6A 'j'
+  {  1552,  12,  17,  14,    2,  -16 },   // 0x6B 'k'
+  {  1578,  12,  17,  14,    1,  -16 },   // 0x6C 'l'
+  {  1604,  13,  12,  14,    1,  -11 },   // 0x6D 'm'
+  {  1624,  11,  12,  14,    2,  -11 },   // 0x6E 'n'
+  {  1641,  12,  12,  14,    1,  -11 },   // 0x6F 'o'
+  {  1659,  11,  16,  14,    2,  -11 },   // 0x70 'p'
+  {  1681,  12,  16,  14,    1,  -11 },   // 0x71 'q'
+  {  1705,  10,  12,  14,    3,  -11 },   // 0x72 'r'
+  {  1720,  12,  12,  14,    1,  -11 },   // 0x73 's'
+  {  1738,  12,  15,  14,    1,  -14 },   // 0x74 't'
+  {  1761,  12,  12,  14,    1,  -11 },   // 0x75 'u'
+  {  1779,  13,  12,  14,    1,  -11 },   // 0x76 'v'
+  {  1799,  14,  12,  14,    0,  -11 },   // 0x77 'w'
+  {  1820,  12,  12,  14,    1,  -11 },   // 0x78 'x'
+  {  1838,  13,  16,  14,    1,  -11 },   // 0x79 'y'
+  {  1864,  11,  12,  14,    2,  -11 },   // 0x7A 'z'
+  {  1881,   9,  21,  14,    3,  -16 },   // 0x7B '{'
+  {  1905,   3,  24,  14,    6,  -17 },   // 0x7C '|'
+  {  1914,   9,  21,  14,    3,  -16 },   // 0x7D '}'
+  {  1938,  12,   4,  14,    1,   -9 }    // 0x7E '~'
+};
+
+const GFXfont SimMonoBold12pt7b PROGMEM = {
+  (uint8_t  *)SimMonoBold12pt7bBitmaps,
+  (GFXglyph *)SimMonoBold12pt7bGlyphs,
+  0x20, 0x7E, 30 };
+
+// Approx. 2616 bytes
@@ -0,0 +1,453 @@
+// SimMonoBold18pt7b: the host builds' substitute for Adafruit GFX's
+// FreeMonoBold18pt7b, with the same character advance. Source Code Pro Bold,
+// Copyright 2010, 2012 Adobe Systems Incorporated, under the SIL Open Font
+// License 1.1 (OFL.txt). Glyph shapes, extents and line height are not the
+// device's, so text extents on the panel are not checked by the sims.
+//
+// Source Code Pro converted at 18 pt by tools/font_convert
+
+const uint8_t SimMonoBold18pt7bBitmaps[] PROGMEM = {
+  0x00, 0x7C, 0xF9, 0xF3, 0xE7, 0xCF, 0x9F, 0x3E, 0x7C, 0xF8, 0xE1, 0xC3,
+  0x87, 0x00, 0x00, 0x38, 0xFB, 0xFF, 0xFF, 0xEF, 0x8E, 0x00, 0xFC, 0x7F,
+  0xF8, 0xFF, 0xF1, 0xFF, 0xE3, 0xFF, 0xC7, 0xFF, 0x8F, 0xFE, 0x0F, 0xFC,
+  0x1F, 0x78, 0x3C, 0xF0, 0x79, 0xE0, 0xF3, 0xC1, 0xE7, 0x83, 0xC0, 0x07,
+  0x0E, 0x03, 0x8E, 0x01, 0xC7, 0x00, 0xE3, 0x80, 0xE1, 0xC3, 0xFF, 0xFD,
+  0xFF, 0xFE, 0xFF, 0xFF, 0x7F, 0xFF, 0x87, 0x1C, 0x03, 0x8E, 0x03, 0xC7,
+  0x0F, 0xFF, 0xF7, 0xFF, 0xFB, 0xFF, 0xFD, 0xFF, 0xFE, 0x1C, 0x38, 0x0E,
+  0x38, 0x07, 0x1C, 0x03, 0x8E, 0x03, 0x87, 0x01, 0xC3, 0x80, 0x01, 0xC0,
+  0x01, 0xC0, 0x01, 0xC0, 0x01, 0xC0, 0x01, 0xC0, 0x07, 0xF8, 0x1F, 0xFC,
+  0x3F, 0xFF, 0x3F, 0xFE, 0x7E, 0x1E, 0x7C, 0x04, 0x7E, 0x00, 0x7F, 0x80,
+  0x3F, 0xF0, 0x1F, 0xFC, 0x0F, 0xFE, 0x01, 0xFF, 0x00, 0x7F, 0x00, 0x1F,
+  0x30, 0x1F, 0x7C, 0x1F, 0x7F, 0xFF, 0xFF, 0xFE, 0x3F, 0xFC, 0x0F, 0xF0,
+  0x01, 0xC0, 0x01, 0xC0, 0x01, 0xC0, 0x01, 0xC0, 0x01, 0xC0, 0x1E, 0x00,
+  0x8F, 0xF0, 0x19, 0xFF, 0x07, 0xF9, 0xE1, 0xEE, 0x1C, 0x79, 0xC3, 0x9E,
+  0x38, 0x73, 0x87, 0x9E, 0xE0, 0x7F, 0xC8, 0x0F, 0xF0, 0x00, 0x78, 0x00,
+  0x00, 0x07, 0x80, 0x43, 0xFC, 0x0C, 0xFF, 0x83, 0xDE, 0x78, 0xF3, 0x87,
+  0x3C, 0x70, 0xEF, 0x0E, 0x1F, 0xC1, 0xE7, 0xB0, 0x1F, 0xE2, 0x03, 0xFC,
+  0x00, 0x1E, 0x00, 0x07, 0xC0, 0x00, 0xFF, 0x00, 0x1F, 0xF0, 0x03, 0xE7,
+  0x80, 0x3C, 0x78, 0x03, 0xC7, 0x80, 0x3C, 0x78, 0x03, 0xEF, 0x80, 0x1F,
+  0xF0, 0x01, 0xFF, 0x00, 0x1F, 0xE1, 0xF3, 0xFC, 0x3E, 0x7F, 0x83, 0xE7,
+  0xFC, 0x3C, 0xFB, 0xF7, 0xCF, 0x9F, 0xF8, 0xF8, 0xFF, 0x8F, 0x87, 0xF0,
+  0xFC, 0x3F, 0xCF, 0xFF, 0xFF, 0x7F, 0xFF, 0xE3, 0xFF, 0xBE, 0x0F, 0xC0,
+  0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDC, 0xE7, 0x00, 0x01, 0x00,
+  0x78, 0x1F, 0x87, 0xC0, 0xF8, 0x3E, 0x07, 0x81, 0xF0, 0x3C, 0x0F, 0x81,
+  0xE0, 0x3C, 0x07, 0x81, 0xF0, 0x3E, 0x07, 0xC0, 0xF8, 0x1F, 0x03, 0xE0,
+  0x3C, 0x07, 0x80, 0xF0, 0x1F, 0x01, 0xE0, 0x3E, 0x03, 0xC0, 0x7C, 0x07,
+  0xC0, 0xF8, 0x0F, 0x80, 0xF8, 0x08, 0x10, 0x0F, 0x03, 0xF0, 0x1F, 0x03,
+  0xE0, 0x3E, 0x03, 0xC0, 0x7C, 0x07, 0x80, 0xF8, 0x0F, 0x01, 0xE0, 0x3C,
+  0x07, 0xC0, 0xF8, 0x1F, 0x03, 0xE0, 0x7C, 0x0F, 0x81, 0xE0, 0x3C, 0x07,
+  0x81, 0xF0, 0x3C, 0x0F, 0x81, 0xE0, 0x7C, 0x1F, 0x03, 0xE0, 0xF8, 0x3E,
+  0x00, 0x80, 0x01, 0xC0, 0x00, 0xE0, 0x00, 0x70, 0x00, 0x38, 0x08, 0x1C,
+  0x13, 0xCE, 0x7B, 0xFF, 0xFE, 0xFF, 0xFE, 0x1F, 0xFC, 0x03, 0xF8, 0x01,
+  0xFC, 0x00, 0xFE, 0x00, 0xF7, 0x80, 0xF1, 0xE0, 0x70, 0x70, 0x78, 0x3C,
+  0x08, 0x08, 0x00, 0x01, 0xC0, 0x00, 0xE0, 0x00, 0x70, 0x00, 0x38, 0x00,
+  0x1C, 0x00, 0x0E, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xC0, 0x70, 0x00, 0x38, 0x00, 0x1C, 0x00, 0x0E, 0x00, 0x07, 0x00, 0x03,
+  0x80, 0x1E, 0x3F, 0x9F, 0xCF, 0xF7, 0xFB, 0xFC, 0xFE, 0x0F, 0x07, 0x87,
+  0x87, 0xCF, 0xCF, 0xC3, 0xC1, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xF0, 0x3E, 0x3F, 0x9F, 0xDF, 0xFF, 0xFB, 0xF9, 0xFC, 0x7C,
+  0x00, 0x1E, 0x00, 0x3C, 0x00, 0xF0, 0x01, 0xE0, 0x07, 0xC0, 0x0F, 0x00,
+  0x1E, 0x00, 0x7C, 0x00, 0xF0, 0x03, 0xE0, 0x07, 0x80, 0x0F, 0x00, 0x3E,
+  0x00, 0x78, 0x00, 0xF0, 0x03, 0xC0, 0x07, 0x80, 0x1F, 0x00, 0x3C, 0x00,
+  0x78, 0x01, 0xF0, 0x03, 0xC0, 0x0F, 0x80, 0x1E, 0x00, 0x3C, 0x00, 0xF8,
+  0x01, 0xE0, 0x03, 0xC0, 0x0F, 0x00, 0x1E, 0x00, 0x00, 0x07, 0xF0, 0x07,
+  0xFC, 0x07, 0xFF, 0x07, 0xFF, 0xC7, 0xE3, 0xF3, 0xE0, 0xFB, 0xE0, 0x3F,
+  0xF0, 0x1F, 0xF9, 0xCF, 0xFD, 0xF7, 0xFE, 0xFB, 0xFF, 0x7D, 0xFF, 0x9C,
+  0xFF, 0xC0, 0x7F, 0xE0, 0x3F, 0xF0, 0x1E, 0x7C, 0x1F, 0x3F, 0x1F, 0x8F,
+  0xFF, 0x83, 0xFF, 0x80, 0xFF, 0x80, 0x3F, 0x80, 0x07, 0xE0, 0x7F, 0xE0,
+  0x7F, 0xE0, 0x7F, 0xE0, 0x7F, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0,
+  0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0,
+  0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0x03, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xE0, 0x1F, 0xFC, 0x1F, 0xFF, 0x1F, 0xFF,
+  0xC7, 0x87, 0xE1, 0x01, 0xF0, 0x00, 0x7C, 0x00, 0x3E, 0x00, 0x3E, 0x00,
+  0x1F, 0x00, 0x1F, 0x80, 0x0F, 0x80, 0x0F, 0x80, 0x0F, 0x80, 0x0F, 0x80,
+  0x0F, 0x80, 0x1F, 0x80, 0x1F, 0x80, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFC, 0x07, 0xF0, 0x07, 0xFF, 0x87, 0xFF, 0xF0, 0xFF, 0xFC,
+  0x3C, 0x1F, 0x84, 0x03, 0xE0, 0x01, 0xF8, 0x00, 0xFC, 0x03, 0xFE, 0x00,
+  0xFE, 0x00, 0x3F, 0xC0, 0x0F, 0xFC, 0x00, 0x3F, 0x80, 0x03, 0xE0, 0x00,
+  0xFC, 0x00, 0x3F, 0x30, 0x0F, 0x8F, 0x07, 0xE7, 0xFF, 0xFB, 0xFF, 0xFC,
+  0x3F, 0xFE, 0x01, 0xFC, 0x00, 0x00, 0x7F, 0x00, 0x1F, 0xE0, 0x03, 0xFC,
+  0x00, 0xFF, 0x80, 0x3F, 0xF0, 0x07, 0xBE, 0x01, 0xE7, 0xC0, 0x7C, 0xF8,
+  0x0F, 0x1F, 0x03, 0xE3, 0xE0, 0xF8, 0x7C, 0x1E, 0x0F, 0x87, 0xC1, 0xF1,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x03, 0xE0,
+  0x00, 0x7C, 0x00, 0x0F, 0x80, 0x01, 0xF0, 0x00, 0x3E, 0x00, 0x3F, 0xFF,
+  0x1F, 0xFF, 0x8F, 0xFF, 0xC7, 0xFF, 0xE3, 0xC0, 0x01, 0xE0, 0x00, 0xF0,
+  0x00, 0x78, 0x00, 0x3F, 0xF0, 0x3F, 0xFE, 0x1F, 0xFF, 0x87, 0xFF, 0xE1,
+  0x83, 0xF0, 0x00, 0xFC, 0x00, 0x7E, 0x00, 0x3F, 0x60, 0x1F, 0x3C, 0x1F,
+  0xBF, 0xFF, 0x9F, 0xFF, 0xC3, 0xFF, 0x80, 0x7F, 0x00, 0x01, 0xF8, 0x03,
+  0xFF, 0x07, 0xFF, 0xE7, 0xFF, 0xE3, 0xF0, 0xE3, 0xF0, 0x21, 0xF0, 0x00,
+  0xF0, 0x00, 0xF8, 0xF8, 0x7D, 0xFF, 0x3F, 0xFF, 0xDF, 0xFF, 0xEF, 0xE1,
+  0xFF, 0xE0, 0x7F, 0xE0, 0x3E, 0xF0, 0x1F, 0x7C, 0x0F, 0xBF, 0x0F, 0xCF,
+  0xFF, 0xC3, 0xFF, 0xC0, 0xFF, 0xC0, 0x1F, 0x80, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x01, 0xE0, 0x01, 0xF0, 0x01, 0xF0, 0x00,
+  0xF0, 0x00, 0xF8, 0x00, 0x78, 0x00, 0x7C, 0x00, 0x3C, 0x00, 0x3E, 0x00,
+  0x1F, 0x00, 0x0F, 0x80, 0x07, 0x80, 0x07, 0xC0, 0x03, 0xE0, 0x01, 0xF0,
+  0x00, 0xF8, 0x00, 0x7C, 0x00, 0x3E, 0x00, 0x07, 0xF0, 0x0F, 0xFE, 0x0F,
+  0xFF, 0x87, 0xFF, 0xE7, 0xE1, 0xF3, 0xE0, 0x79, 0xF0, 0x3C, 0xF8, 0x3C,
+  0x3F, 0x1E, 0x0F, 0xFC, 0x03, 0xFE, 0x03, 0xFF, 0xC3, 0xCF, 0xF3, 0xC0,
+  0xFB, 0xE0, 0x3F, 0xF0, 0x1F, 0xF8, 0x0F, 0xFE, 0x0F, 0xDF, 0xFF, 0xCF,
+  0xFF, 0xE3, 0xFF, 0xC0, 0x3F, 0x80, 0x07, 0xE0, 0x0F, 0xFC, 0x0F, 0xFF,
+  0x0F, 0xFF, 0xCF, 0xC3, 0xF7, 0xC0, 0xFB, 0xE0, 0x3D, 0xF0, 0x1F, 0xF8,
+  0x1F, 0xFE, 0x1F, 0xFF, 0xFF, 0xEF, 0xFF, 0xF3, 0xFE, 0xF8, 0x7C, 0x7C,
+  0x00, 0x3C, 0x00, 0x3E, 0x20, 0x3F, 0x1C, 0x3F, 0x1F, 0xFF, 0x9F, 0xFF,
+  0x83, 0xFF, 0x00, 0x7E, 0x00, 0x3E, 0x3F, 0x9F, 0xDF, 0xFF, 0xFB, 0xF9,
+  0xFC, 0x7C, 0x00, 0x00, 0x00, 0x07, 0xC7, 0xF3, 0xFB, 0xFF, 0xFF, 0x7F,
+  0x3F, 0x8F, 0x80, 0x3E, 0x3F, 0x9F, 0xDF, 0xFF, 0xFB, 0xF9, 0xFC, 0x7C,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0xE3, 0xF9, 0xFC, 0xFF, 0x7F, 0xBF, 0xCF,
+  0xE0, 0xF0, 0x78, 0x78, 0x7C, 0xFC, 0xFC, 0x3C, 0x18, 0x00, 0x00, 0x04,
+  0x00, 0x70, 0x07, 0xC0, 0x3F, 0x03, 0xF8, 0x3F, 0x81, 0xFC, 0x1F, 0xC0,
+  0xFE, 0x03, 0xE0, 0x0F, 0x80, 0x3F, 0x80, 0x7F, 0x00, 0x7F, 0x00, 0xFE,
+  0x00, 0xFE, 0x00, 0xFC, 0x01, 0xF0, 0x01, 0xC0, 0x01, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x80,
+  0x03, 0x80, 0x0F, 0x80, 0x3F, 0x00, 0x7F, 0x00, 0x7F, 0x00, 0xFE, 0x00,
+  0xFE, 0x01, 0xFC, 0x01, 0xF0, 0x07, 0xC0, 0x7F, 0x03, 0xF8, 0x3F, 0x81,
+  0xFC, 0x1F, 0xC0, 0xFC, 0x03, 0xE0, 0x0E, 0x00, 0x20, 0x00, 0x0F, 0xC0,
+  0xFF, 0xC7, 0xFF, 0xBF, 0xFF, 0x38, 0x7C, 0x81, 0xF0, 0x07, 0xC0, 0x1F,
+  0x00, 0xFC, 0x07, 0xE0, 0x3F, 0x01, 0xF8, 0x07, 0xC0, 0x1E, 0x00, 0x78,
+  0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0xFC, 0x03, 0xF0, 0x0F, 0xE0, 0x3F,
+  0x00, 0xFC, 0x01, 0xE0, 0x01, 0xFC, 0x01, 0xFF, 0x80, 0xFF, 0xF0, 0x7F,
+  0xFE, 0x3F, 0x07, 0xCF, 0x80, 0xF7, 0xC0, 0x1D, 0xE0, 0x07, 0x78, 0x01,
+  0xFC, 0x03, 0xFF, 0x07, 0xFF, 0xC3, 0xFF, 0xF1, 0xFF, 0xFC, 0x7C, 0x7F,
+  0x3C, 0x1F, 0xCF, 0x07, 0xF1, 0xFF, 0xFC, 0x7F, 0xFF, 0x0F, 0xDD, 0xC1,
+  0xE3, 0x78, 0x00, 0x1E, 0x00, 0x03, 0xC0, 0x00, 0xF8, 0x00, 0x1F, 0x83,
+  0x07, 0xFF, 0xE0, 0xFF, 0xF8, 0x0F, 0xFC, 0x00, 0xFC, 0x00, 0x01, 0xFC,
+  0x00, 0x0F, 0xE0, 0x00, 0x7F, 0x00, 0x07, 0xFC, 0x00, 0x3D, 0xE0, 0x01,
+  0xEF, 0x00, 0x1F, 0x7C, 0x00, 0xFB, 0xE0, 0x07, 0x9F, 0x00, 0x7C, 0x7C,
+  0x03, 0xE3, 0xE0, 0x1F, 0x1F, 0x00, 0xF0, 0xF8, 0x0F, 0x83, 0xE0, 0x7F,
+  0xFF, 0x03, 0xFF, 0xF8, 0x3F, 0xFF, 0xE1, 0xFF, 0xFF, 0x0F, 0x80, 0xF8,
+  0xFC, 0x07, 0xE7, 0xC0, 0x1F, 0x3E, 0x00, 0xFB, 0xF0, 0x07, 0xE0, 0xFF,
+  0xE0, 0x7F, 0xFE, 0x3F, 0xFF, 0x9F, 0xFF, 0xCF, 0x87, 0xE7, 0xC1, 0xF3,
+  0xE0, 0xF9, 0xF0, 0x7C, 0xF8, 0x7E, 0x7F, 0xFE, 0x3F, 0xFC, 0x1F, 0xFF,
+  0x8F, 0xFF, 0xE7, 0xC1, 0xFB, 0xE0, 0x7D, 0xF0, 0x3E, 0xF8, 0x1F, 0xFC,
+  0x0F, 0xBE, 0x0F, 0xDF, 0xFF, 0xEF, 0xFF, 0xE7, 0xFF, 0xE3, 0xFF, 0xC0,
+  0x01, 0xFC, 0x01, 0xFF, 0xC0, 0xFF, 0xF8, 0x7F, 0xFF, 0x3F, 0x87, 0x1F,
+  0x80, 0x87, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3E, 0x00, 0x0F, 0x80,
+  0x03, 0xE0, 0x00, 0xF8, 0x00, 0x3E, 0x00, 0x0F, 0xC0, 0x03, 0xF0, 0x00,
+  0x7C, 0x00, 0x1F, 0x80, 0x43, 0xF8, 0x78, 0x7F, 0xFE, 0x0F, 0xFF, 0xC1,
+  0xFF, 0xC0, 0x1F, 0xC0, 0xFF, 0xC0, 0x7F, 0xFC, 0x3F, 0xFF, 0x1F, 0xFF,
+  0xCF, 0x87, 0xF7, 0xC1, 0xFB, 0xE0, 0x7F, 0xF0, 0x1F, 0xF8, 0x0F, 0xFC,
+  0x07, 0xFE, 0x03, 0xFF, 0x01, 0xFF, 0x80, 0xFF, 0xC0, 0x7F, 0xE0, 0x3F,
+  0xF0, 0x1F, 0xF8, 0x1F, 0xFC, 0x1F, 0xBE, 0x1F, 0xDF, 0xFF, 0xCF, 0xFF,
+  0xC7, 0xFF, 0xC3, 0xFF, 0x00, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF,
+  0xFE, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xFF,
+  0xFC, 0xFF, 0xFC, 0xFF, 0xFC, 0xFF, 0xFC, 0xF8, 0x00, 0xF8, 0x00, 0xF8,
+  0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80,
+  0x1F, 0x00, 0x3E, 0x00, 0x7C, 0x00, 0xF8, 0x01, 0xF0, 0x03, 0xFF, 0xE7,
+  0xFF, 0xCF, 0xFF, 0x9F, 0xFF, 0x3E, 0x00, 0x7C, 0x00, 0xF8, 0x01, 0xF0,
+  0x03, 0xE0, 0x07, 0xC0, 0x0F, 0x80, 0x1F, 0x00, 0x3E, 0x00, 0x00, 0x01,
+  0xF8, 0x03, 0xFF, 0x07, 0xFF, 0xE7, 0xFF, 0xE7, 0xF0, 0xE3, 0xF0, 0x23,
+  0xF0, 0x01, 0xF8, 0x00, 0xF8, 0x00, 0x7C, 0x00, 0x3E, 0x1F, 0xFF, 0x0F,
+  0xFF, 0x87, 0xFF, 0xC3, 0xFF, 0xE0, 0x1F, 0xF0, 0x0F, 0xFC, 0x07, 0xBF,
+  0x03, 0xDF, 0xC3, 0xE7, 0xFF, 0xF1, 0xFF, 0xF8, 0x7F, 0xF8, 0x0F, 0xE0,
+  0xF8, 0x0F, 0xFC, 0x07, 0xFE, 0x03, 0xFF, 0x01, 0xFF, 0x80, 0xFF, 0xC0,
+  0x7F, 0xE0, 0x3F, 0xF0, 0x1F, 0xF8, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x7F, 0xE0, 0x3F, 0xF0, 0x1F, 0xF8, 0x0F,
+  0xFC, 0x07, 0xFE, 0x03, 0xFF, 0x01, 0xFF, 0x80, 0xFF, 0xC0, 0x7F, 0xE0,
+  0x3E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x7C, 0x00, 0xF8,
+  0x01, 0xF0, 0x03, 0xE0, 0x07, 0xC0, 0x0F, 0x80, 0x1F, 0x00, 0x3E, 0x00,
+  0x7C, 0x00, 0xF8, 0x01, 0xF0, 0x03, 0xE0, 0x07, 0xC0, 0x0F, 0x80, 0x1F,
+  0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0x3F,
+  0xFF, 0x3F, 0xFF, 0x3F, 0xFF, 0x00, 0x1F, 0x00, 0x1F, 0x00, 0x1F, 0x00,
+  0x1F, 0x00, 0x1F, 0x00, 0x1F, 0x00, 0x1F, 0x00, 0x1F, 0x00, 0x1F, 0x00,
+  0x1F, 0x00, 0x1F, 0x00, 0x1F, 0x20, 0x1F, 0x30, 0x3F, 0x78, 0x3E, 0xFF,
+  0xFE, 0x7F, 0xFC, 0x3F, 0xF8, 0x0F, 0xE0, 0xFC, 0x0F, 0xDF, 0x83, 0xF3,
+  0xF0, 0x7C, 0x7E, 0x1F, 0x8F, 0xC7, 0xE1, 0xF9, 0xF8, 0x3F, 0x3E, 0x07,
+  0xEF, 0xC0, 0xFF, 0xF0, 0x1F, 0xFC, 0x03, 0xFF, 0xC0, 0x7F, 0xFC, 0x0F,
+  0xFF, 0x81, 0xFF, 0xF8, 0x3F, 0x9F, 0x07, 0xF3, 0xF0, 0xFC, 0x3E, 0x1F,
+  0x87, 0xE3, 0xF0, 0x7C, 0x7E, 0x0F, 0xCF, 0xC0, 0xF9, 0xF8, 0x1F, 0xBF,
+  0x01, 0xF8, 0xF8, 0x01, 0xF0, 0x03, 0xE0, 0x07, 0xC0, 0x0F, 0x80, 0x1F,
+  0x00, 0x3E, 0x00, 0x7C, 0x00, 0xF8, 0x01, 0xF0, 0x03, 0xE0, 0x07, 0xC0,
+  0x0F, 0x80, 0x1F, 0x00, 0x3E, 0x00, 0x7C, 0x00, 0xF8, 0x01, 0xF0, 0x03,
+  0xE0, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFC, 0x1F,
+  0xFE, 0x0F, 0xFF, 0x07, 0xFF, 0x83, 0xFF, 0xE3, 0xFF, 0xF1, 0xFF, 0xF8,
+  0xDF, 0xEC, 0x6F, 0xF7, 0x77, 0xFB, 0xBB, 0xFD, 0xD9, 0xFE, 0x6C, 0xFF,
+  0x3E, 0x7F, 0x9F, 0x3F, 0xC7, 0x1F, 0xE3, 0x8F, 0xF1, 0xC7, 0xF8, 0x03,
+  0xFC, 0x01, 0xFE, 0x00, 0xFF, 0x00, 0x7F, 0x80, 0x3F, 0xC0, 0x1E, 0xFC,
+  0x0F, 0xFE, 0x07, 0xFF, 0x83, 0xFF, 0xC1, 0xFF, 0xE0, 0xFF, 0xF8, 0x7F,
+  0xFC, 0x3F, 0xFF, 0x1F, 0xFB, 0x8F, 0xFD, 0xE7, 0xFE, 0xF3, 0xFF, 0x39,
+  0xFF, 0x9E, 0xFF, 0xCF, 0x7F, 0xE3, 0xBF, 0xF1, 0xFF, 0xF8, 0x7F, 0xFC,
+  0x3F, 0xFE, 0x0F, 0xFF, 0x07, 0xFF, 0x83, 0xFF, 0xC0, 0xFF, 0xE0, 0x7E,
+  0x03, 0xF8, 0x01, 0xFF, 0xC0, 0x7F, 0xFC, 0x1F, 0xFF, 0xC3, 0xF1, 0xF8,
+  0xFC, 0x1F, 0x9F, 0x01, 0xF3, 0xE0, 0x3E, 0x7C, 0x07, 0xDF, 0x80, 0xFF,
+  0xF0, 0x1F, 0xFE, 0x03, 0xFF, 0xC0, 0x7F, 0xF8, 0x0F, 0xDF, 0x01, 0xF3,
+  0xE0, 0x3E, 0x7C, 0x07, 0xCF, 0xC1, 0xF8, 0xFC, 0x7E, 0x0F, 0xFF, 0x81,
+  0xFF, 0xF0, 0x0F, 0xF8, 0x00, 0xFE, 0x00, 0xFF, 0xF0, 0x7F, 0xFE, 0x3F,
+  0xFF, 0x9F, 0xFF, 0xEF, 0x83, 0xF7, 0xC0, 0xFF, 0xE0, 0x3F, 0xF0, 0x1F,
+  0xF8, 0x0F, 0xFC, 0x0F, 0xFE, 0x0F, 0xDF, 0xFF, 0xEF, 0xFF, 0xE7, 0xFF,
+  0xE3, 0xFF, 0xC1, 0xF0, 0x00, 0xF8, 0x00, 0x7C, 0x00, 0x3E, 0x00, 0x1F,
+  0x00, 0x0F, 0x80, 0x07, 0xC0, 0x03, 0xE0, 0x00, 0x03, 0xF0, 0x01, 0xFF,
+  0x80, 0x7F, 0xFC, 0x1F, 0xFF, 0x83, 0xF1, 0xF8, 0xFC, 0x1F, 0x1F, 0x03,
+  0xF3, 0xE0, 0x3E, 0xFC, 0x07, 0xDF, 0x80, 0xFB, 0xF0, 0x1F, 0x7E, 0x03,
+  0xEF, 0xC0, 0x7F, 0xF8, 0x0F, 0xBF, 0x01, 0xF3, 0xE0, 0x3E, 0x7C, 0x0F,
+  0xCF, 0xC1, 0xF8, 0xFC, 0x7E, 0x1F, 0xFF, 0x81, 0xFF, 0xF0, 0x1F, 0xFC,
+  0x00, 0xFE, 0x00, 0x0F, 0xC0, 0x00, 0xFC, 0x00, 0x1F, 0xFC, 0x01, 0xFF,
+  0x80, 0x0F, 0xF0, 0x00, 0x7E, 0xFF, 0xF0, 0x3F, 0xFF, 0x8F, 0xFF, 0xF3,
+  0xFF, 0xFC, 0xFC, 0x1F, 0xBF, 0x03, 0xEF, 0xC0, 0xFB, 0xF0, 0x3E, 0xFC,
+  0x0F, 0xBF, 0x03, 0xEF, 0xC1, 0xFB, 0xFF, 0xFC, 0xFF, 0xFF, 0x3F, 0xFF,
+  0x0F, 0xFF, 0xC3, 0xF1, 0xF0, 0xFC, 0x7E, 0x3F, 0x0F, 0x8F, 0xC3, 0xF3,
+  0xF0, 0x7C, 0xFC, 0x1F, 0xBF, 0x03, 0xFF, 0xC0, 0xFC, 0x03, 0xF0, 0x07,
+  0xFF, 0x0F, 0xFF, 0xC7, 0xFF, 0xF7, 0xE0, 0xE3, 0xE0, 0x21, 0xF0, 0x00,
+  0xF8, 0x00, 0x7F, 0x00, 0x3F, 0xF0, 0x0F, 0xFE, 0x03, 0xFF, 0xC0, 0x7F,
+  0xF0, 0x07, 0xFC, 0x00, 0xFE, 0x00, 0x1F, 0x00, 0x0F, 0x98, 0x07, 0xDF,
+  0x07, 0xFF, 0xFF, 0xEF, 0xFF, 0xE1, 0xFF, 0xE0, 0x1F, 0xC0, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x1F, 0x00, 0x03, 0xE0,
+  0x00, 0x7C, 0x00, 0x0F, 0x80, 0x01, 0xF0, 0x00, 0x3E, 0x00, 0x07, 0xC0,
+  0x00, 0xF8, 0x00, 0x1F, 0x00, 0x03, 0xE0, 0x00, 0x7C, 0x00, 0x0F, 0x80,
+  0x01, 0xF0, 0x00, 0x3E, 0x00, 0x07, 0xC0, 0x00, 0xF8, 0x00, 0x1F, 0x00,
+  0x03, 0xE0, 0x00, 0x7C, 0x00, 0xF8, 0x0F, 0xFC, 0x07, 0xFE, 0x03, 0xFF,
+  0x01, 0xFF, 0x80, 0xFF, 0xC0, 0x7F, 0xE0, 0x3F, 0xF0, 0x1F, 0xF8, 0x0F,
+  0xFC, 0x07, 0xFE, 0x03, 0xFF, 0x01, 0xFF, 0x80, 0xFF, 0xC0, 0x7F, 0xE0,
+  0x3F, 0xF0, 0x1F, 0xFC, 0x0F, 0xBE, 0x0F, 0x9F, 0x8F, 0xCF, 0xFF, 0xE3,
+  0xFF, 0xE0, 0xFF, 0xE0, 0x1F, 0xC0, 0xF8, 0x03, 0xFF, 0x00, 0x7F, 0xF0,
+  0x0F, 0xBE, 0x03, 0xE7, 0xC0, 0x7C, 0xF8, 0x0F, 0x9F, 0x81, 0xF1, 0xF0,
+  0x7C, 0x3E, 0x0F, 0x87, 0xC1, 0xF0, 0x7C, 0x3C, 0x0F, 0x8F, 0x81, 0xF1,
+  0xF0, 0x1E, 0x3C, 0x03, 0xC7, 0x80, 0x7C, 0xF0, 0x0F, 0xBE, 0x00, 0xF7,
+  0x80, 0x1E, 0xF0, 0x03, 0xFE, 0x00, 0x3F, 0x80, 0x07, 0xF0, 0x00, 0xFE,
+  0x00, 0xF8, 0x00, 0xFF, 0xC0, 0x07, 0xFF, 0x00, 0x3E, 0xF8, 0x01, 0xE7,
+  0xC0, 0x0F, 0x3E, 0x00, 0x79, 0xF1, 0xC3, 0xCF, 0x8F, 0x1E, 0x7C, 0x78,
+  0xF3, 0xE7, 0xCF, 0x8F, 0x3E, 0x7C, 0x79, 0xBB, 0xC3, 0xCD, 0xDE, 0x1E,
+  0xEE, 0xF0, 0xF7, 0x77, 0x87, 0xBB, 0xBC, 0x3D, 0xDF, 0xE1, 0xEC, 0x7F,
+  0x07, 0xE3, 0xF8, 0x3F, 0x1F, 0x81, 0xF8, 0xFC, 0x0F, 0xC7, 0xE0, 0x7E,
+  0x1F, 0x00, 0xFC, 0x07, 0xEF, 0xC0, 0xF9, 0xF8, 0x3F, 0x1F, 0x87, 0xC1,
+  0xF1, 0xF8, 0x3F, 0x3E, 0x03, 0xEF, 0x80, 0x7D, 0xF0, 0x07, 0xFC, 0x00,
+  0xFF, 0x80, 0x0F, 0xE0, 0x01, 0xFC, 0x00, 0x3F, 0x80, 0x0F, 0xF8, 0x03,
+  0xFF, 0x00, 0x7D, 0xF0, 0x1F, 0x3F, 0x03, 0xE3, 0xE0, 0xF8, 0x7E, 0x1F,
+  0x07, 0xC7, 0xC0, 0xFD, 0xF8, 0x0F, 0xFE, 0x01, 0xF8, 0xF8, 0x03, 0xFF,
+  0x80, 0xFD, 0xF0, 0x1F, 0x3F, 0x03, 0xE3, 0xE0, 0xF8, 0x7C, 0x1F, 0x07,
+  0xC7, 0xC0, 0xF8, 0xF8, 0x0F, 0x9E, 0x01, 0xF7, 0xC0, 0x1E, 0xF0, 0x03,
+  0xFE, 0x00, 0x3F, 0x80, 0x07, 0xF0, 0x00, 0x7C, 0x00, 0x0F, 0x80, 0x01,
+  0xF0, 0x00, 0x3E, 0x00, 0x07, 0xC0, 0x00, 0xF8, 0x00, 0x1F, 0x00, 0x03,
+  0xE0, 0x00, 0x7C, 0x00, 0x7F, 0xFF, 0xBF, 0xFF, 0xDF, 0xFF, 0xEF, 0xFF,
+  0xF0, 0x03, 0xF0, 0x01, 0xF0, 0x01, 0xF8, 0x01, 0xF8, 0x00, 0xF8, 0x00,
+  0xFC, 0x00, 0xFC, 0x00, 0x7C, 0x00, 0x7E, 0x00, 0x7E, 0x00, 0x3E, 0x00,
+  0x3F, 0x00, 0x3F, 0x00, 0x1F, 0x00, 0x1F, 0x80, 0x1F, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xF0, 0x3C,
+  0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0x0F, 0x03,
+  0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0,
+  0x3C, 0x0F, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0xF0, 0x01, 0xE0, 0x01, 0xE0,
+  0x03, 0xC0, 0x07, 0xC0, 0x07, 0x80, 0x0F, 0x00, 0x1F, 0x00, 0x1E, 0x00,
+  0x3E, 0x00, 0x3C, 0x00, 0x78, 0x00, 0xF8, 0x00, 0xF0, 0x01, 0xE0, 0x01,
+  0xE0, 0x03, 0xC0, 0x07, 0xC0, 0x07, 0x80, 0x0F, 0x00, 0x1F, 0x00, 0x1E,
+  0x00, 0x3E, 0x00, 0x3C, 0x00, 0x78, 0x00, 0xF8, 0x00, 0xF0, 0x01, 0xE0,
+  0x01, 0xE0, 0x03, 0xC0, 0xFF, 0xFF, 0xFF, 0xFC, 0x0F, 0x03, 0xC0, 0xF0,
+  0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0x0F,
+  0x03, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0,
+  0xF0, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0x07, 0xC0, 0x0F, 0x80, 0x3F, 0x80,
+  0x7F, 0x00, 0xFE, 0x03, 0xDE, 0x07, 0xBC, 0x0F, 0x78, 0x3C, 0x78, 0x78,
+  0xF1, 0xF0, 0xF3, 0xC1, 0xE7, 0x83, 0xDE, 0x03, 0xC0, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFC, 0x7C, 0x3E, 0x1E, 0x1F, 0x0F,
+  0x07, 0xF0, 0x1F, 0xFE, 0x1F, 0xFF, 0x8F, 0xFF, 0xE3, 0x83, 0xF0, 0x00,
+  0xFC, 0x07, 0xFE, 0x3F, 0xFF, 0x3F, 0xFF, 0xBF, 0xFF, 0xFF, 0x83, 0xFF,
+  0x03, 0xFF, 0x83, 0xFF, 0xFF, 0xFD, 0xFF, 0xFE, 0x7F, 0xDF, 0x1F, 0x8F,
+  0x80, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8,
+  0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF9, 0xF0, 0xFF, 0xFC, 0xFF, 0xFE, 0xFF,
+  0xFE, 0xFC, 0x3F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8,
+  0x1F, 0xF8, 0x1F, 0xF8, 0x3F, 0xFC, 0x7E, 0xFF, 0xFE, 0xFF, 0xFC, 0xF7,
+  0xF8, 0xF1, 0xE0, 0x01, 0xFC, 0x07, 0xFF, 0x87, 0xFF, 0xE7, 0xFF, 0xE7,
+  0xF0, 0x63, 0xF0, 0x01, 0xF0, 0x01, 0xF8, 0x00, 0xFC, 0x00, 0x7E, 0x00,
+  0x1F, 0x00, 0x0F, 0xC0, 0x47, 0xF0, 0x71, 0xFF, 0xFC, 0x7F, 0xFE, 0x1F,
+  0xFE, 0x03, 0xF8, 0x00, 0x00, 0x1F, 0x00, 0x1F, 0x00, 0x1F, 0x00, 0x1F,
+  0x00, 0x1F, 0x00, 0x1F, 0x00, 0x1F, 0x00, 0x1F, 0x07, 0xDF, 0x1F, 0xFF,
+  0x3F, 0xFF, 0x7F, 0xFF, 0xFE, 0x3F, 0xFC, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F,
+  0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xFC, 0x1F, 0xFC, 0x3F, 0x7F, 0xFF,
+  0x7F, 0xFF, 0x3F, 0xEF, 0x0F, 0x8F, 0x03, 0xF0, 0x07, 0xFE, 0x0F, 0xFF,
+  0x87, 0xFF, 0xE7, 0xE1, 0xF7, 0xC0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x1F, 0x80, 0x07, 0xE0, 0x61, 0xFF, 0xF8,
+  0xFF, 0xFC, 0x1F, 0xFC, 0x03, 0xF8, 0x00, 0x00, 0x7F, 0x00, 0xFF, 0xC0,
+  0xFF, 0xE0, 0xFF, 0xF0, 0x7E, 0x08, 0x3E, 0x00, 0x3F, 0x00, 0x1F, 0x80,
+  0xFF, 0xFF, 0x7F, 0xFF, 0xBF, 0xFF, 0xDF, 0xFF, 0xE0, 0xFC, 0x00, 0x7E,
+  0x00, 0x3F, 0x00, 0x1F, 0x80, 0x0F, 0xC0, 0x07, 0xE0, 0x03, 0xF0, 0x01,
+  0xF8, 0x00, 0xFC, 0x00, 0x7E, 0x00, 0x3F, 0x00, 0x1F, 0x80, 0x0F, 0xC0,
+  0x00, 0x07, 0xFF, 0xC7, 0xFF, 0xF3, 0xFF, 0xFD, 0xFF, 0xFF, 0x7C, 0x3E,
+  0x1E, 0x07, 0x87, 0xC3, 0xE1, 0xFF, 0xF8, 0x3F, 0xFC, 0x07, 0xFE, 0x03,
+  0xFF, 0x01, 0xE0, 0x00, 0x78, 0x00, 0x1F, 0xFF, 0x87, 0xFF, 0xF8, 0xFF,
+  0xFF, 0x7F, 0xFF, 0xFC, 0x01, 0xFF, 0x80, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF,
+  0x1F, 0xFF, 0x81, 0xFF, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8,
+  0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF9, 0xF8, 0xF3,
+  0xFC, 0xFF, 0xFE, 0xFF, 0xFE, 0xFE, 0x3F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8,
+  0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8,
+  0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0x01, 0xE0, 0x1F, 0x80, 0xFC,
+  0x07, 0xF0, 0x3F, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xBF,
+  0xFD, 0xFF, 0xEF, 0xFF, 0x00, 0xF8, 0x07, 0xC0, 0x3E, 0x01, 0xF0, 0x0F,
+  0x80, 0x7C, 0x03, 0xE0, 0x1F, 0x00, 0xF8, 0x07, 0xC0, 0x3E, 0x01, 0xF0,
+  0x0F, 0x80, 0x00, 0x78, 0x01, 0xF8, 0x03, 0xF0, 0x07, 0xF0, 0x0F, 0xC0,
+  0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xF8, 0xFF, 0xF1, 0xFF,
+  0xE3, 0xFF, 0xC0, 0x0F, 0x80, 0x1F, 0x00, 0x3E, 0x00, 0x7C, 0x00, 0xF8,
+  0x01, 0xF0, 0x03, 0xE0, 0x07, 0xC0, 0x0F, 0x80, 0x1F, 0x00, 0x3E, 0x00,
+  0x7C, 0x00, 0xF8, 0x03, 0xF1, 0x07, 0xC7, 0xFF, 0x8F, 0xFE, 0x1F, 0xF8,
+  0x5F, 0xC0, 0xF8, 0x00, 0x7C, 0x00, 0x3E, 0x00, 0x1F, 0x00, 0x0F, 0x80,
+  0x07, 0xC0, 0x03, 0xE0, 0x01, 0xF0, 0x00, 0xF8, 0x1F, 0xFC, 0x1F, 0x3E,
+  0x1F, 0x1F, 0x1F, 0x0F, 0x9F, 0x87, 0xDF, 0x83, 0xFF, 0x81, 0xFF, 0xC0,
+  0xFF, 0xF0, 0x7F, 0xF8, 0x3F, 0xBE, 0x1F, 0x9F, 0x8F, 0x87, 0xC7, 0xC1,
+  0xF3, 0xE0, 0xFD, 0xF0, 0x3E, 0xF8, 0x0F, 0x80, 0xFF, 0xC0, 0x7F, 0xE0,
+  0x3F, 0xF0, 0x1F, 0xF8, 0x00, 0x7C, 0x00, 0x3E, 0x00, 0x1F, 0x00, 0x0F,
+  0x80, 0x07, 0xC0, 0x03, 0xE0, 0x01, 0xF0, 0x00, 0xF8, 0x00, 0x7C, 0x00,
+  0x3E, 0x00, 0x1F, 0x00, 0x0F, 0x80, 0x07, 0xC0, 0x03, 0xE0, 0x01, 0xF0,
+  0x00, 0xFC, 0x00, 0x3E, 0x10, 0x1F, 0xF8, 0x0F, 0xFE, 0x03, 0xFF, 0x00,
+  0x7F, 0x00, 0xF3, 0xC7, 0x9E, 0xFD, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xDF, 0x3F, 0xF1, 0xE7, 0xFE, 0x3C, 0xFF, 0xC7, 0x9F, 0xF8, 0xF3, 0xFF,
+  0x1E, 0x7F, 0xE3, 0xCF, 0xFC, 0x79, 0xFF, 0x8F, 0x3F, 0xF1, 0xE7, 0xFE,
+  0x3C, 0xFF, 0xC7, 0x9F, 0xF8, 0xF3, 0xE0, 0xF1, 0xF8, 0xF3, 0xFC, 0xFF,
+  0xFE, 0xFF, 0xFE, 0xFE, 0x3F, 0xFC, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8,
+  0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8,
+  0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0x07, 0xF0, 0x0F, 0xFE, 0x0F, 0xFF, 0x8F,
+  0xFF, 0xE7, 0xE3, 0xF7, 0xE0, 0xFF, 0xE0, 0x3F, 0xF0, 0x1F, 0xF8, 0x0F,
+  0xFC, 0x07, 0xFE, 0x03, 0xFF, 0x83, 0xF7, 0xE3, 0xF3, 0xFF, 0xF8, 0xFF,
+  0xF8, 0x3F, 0xF8, 0x07, 0xF0, 0x00, 0xF1, 0xF0, 0xF7, 0xFC, 0xFF, 0xFE,
+  0xFF, 0xFE, 0xFC, 0x3F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F,
+  0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x3F, 0xFC, 0x7E, 0xFF, 0xFE, 0xFF, 0xFC,
+  0xFF, 0xF8, 0xFB, 0xE0, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00,
+  0xF8, 0x00, 0xF8, 0x00, 0x07, 0xCF, 0x1F, 0xEF, 0x3F, 0xFF, 0x7F, 0xFF,
+  0xFE, 0x3F, 0xFC, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F,
+  0xF8, 0x1F, 0xFC, 0x1F, 0xFC, 0x3F, 0x7F, 0xFF, 0x7F, 0xFF, 0x3F, 0xFF,
+  0x0F, 0x9F, 0x00, 0x1F, 0x00, 0x1F, 0x00, 0x1F, 0x00, 0x1F, 0x00, 0x1F,
+  0x00, 0x1F, 0xF0, 0x7F, 0xE3, 0xFF, 0xEF, 0xFF, 0xFF, 0xEF, 0xF8, 0x1F,
+  0xC0, 0x3F, 0x00, 0x7C, 0x00, 0xF8, 0x01, 0xF0, 0x03, 0xE0, 0x07, 0xC0,
+  0x0F, 0x80, 0x1F, 0x00, 0x3E, 0x00, 0x7C, 0x00, 0xF8, 0x00, 0x07, 0xF0,
+  0x0F, 0xFF, 0x0F, 0xFF, 0xCF, 0xFF, 0xE7, 0xC0, 0xE3, 0xE0, 0x21, 0xFE,
+  0x00, 0x7F, 0xF0, 0x1F, 0xFE, 0x01, 0xFF, 0x80, 0x1F, 0xE4, 0x01, 0xF7,
+  0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x7F, 0xFC, 0x07, 0xF0, 0x00, 0x07,
+  0x80, 0x03, 0xC0, 0x01, 0xE0, 0x00, 0xF0, 0x00, 0xF8, 0x07, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x87, 0xC0, 0x03, 0xE0, 0x01, 0xF0,
+  0x00, 0xF8, 0x00, 0x7C, 0x00, 0x3E, 0x00, 0x1F, 0x00, 0x0F, 0xC0, 0x07,
+  0xE0, 0x81, 0xFF, 0xE0, 0xFF, 0xF0, 0x3F, 0xF8, 0x07, 0xF8, 0xF8, 0x1F,
+  0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F,
+  0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xFC, 0x3F, 0xFC, 0x7F,
+  0x7F, 0xFF, 0x7F, 0xEF, 0x3F, 0xCF, 0x1F, 0x8F, 0xF8, 0x03, 0xEF, 0x80,
+  0xF9, 0xF0, 0x1F, 0x3E, 0x03, 0xE3, 0xE0, 0xF8, 0x7C, 0x1F, 0x07, 0xC3,
+  0xC0, 0xF8, 0xF8, 0x1F, 0x1F, 0x01, 0xF3, 0xC0, 0x3E, 0xF8, 0x03, 0xDF,
+  0x00, 0x7B, 0xC0, 0x0F, 0xF8, 0x00, 0xFE, 0x00, 0x1F, 0xC0, 0x03, 0xF8,
+  0x00, 0xF8, 0x78, 0xFF, 0xC3, 0xC7, 0xDF, 0x3E, 0x3C, 0xF9, 0xF1, 0xE7,
+  0xCF, 0x8F, 0x3E, 0x7C, 0xF9, 0xF3, 0x77, 0xCF, 0x9B, 0xBE, 0x3D, 0xDD,
+  0xF1, 0xEE, 0xEF, 0x0F, 0xF7, 0x78, 0x7F, 0xBB, 0xC3, 0xFD, 0xDE, 0x1F,
+  0xC7, 0xF0, 0x7E, 0x3F, 0x83, 0xF1, 0xF8, 0x1F, 0x8F, 0xC0, 0x7E, 0x07,
+  0xC7, 0xC1, 0xF0, 0xFC, 0x7E, 0x0F, 0x8F, 0x80, 0xFB, 0xE0, 0x0F, 0xFC,
+  0x01, 0xFF, 0x00, 0x1F, 0xC0, 0x03, 0xF8, 0x00, 0xFF, 0x00, 0x1F, 0xF0,
+  0x07, 0xFF, 0x01, 0xF3, 0xE0, 0x3E, 0x3E, 0x0F, 0x87, 0xE3, 0xF0, 0x7E,
+  0xFC, 0x07, 0xE0, 0xF8, 0x03, 0xEF, 0x80, 0x79, 0xF0, 0x1F, 0x1F, 0x03,
+  0xE3, 0xE0, 0x78, 0x3C, 0x1F, 0x07, 0xC3, 0xC0, 0xF8, 0x78, 0x0F, 0x1F,
+  0x01, 0xF3, 0xC0, 0x1E, 0x78, 0x03, 0xDE, 0x00, 0x3F, 0xC0, 0x07, 0xF0,
+  0x00, 0xFE, 0x00, 0x0F, 0xC0, 0x01, 0xF0, 0x00, 0x3E, 0x00, 0x0F, 0x80,
+  0x1F, 0xF0, 0x03, 0xFC, 0x00, 0x7F, 0x00, 0x1F, 0x80, 0x00, 0x3F, 0xFF,
+  0x9F, 0xFF, 0xCF, 0xFF, 0xE7, 0xFF, 0xE0, 0x07, 0xE0, 0x07, 0xE0, 0x07,
+  0xE0, 0x07, 0xE0, 0x03, 0xF0, 0x03, 0xF0, 0x03, 0xF0, 0x03, 0xF0, 0x03,
+  0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x01,
+  0xF8, 0x3F, 0xC1, 0xFE, 0x1F, 0x00, 0xF0, 0x07, 0x80, 0x3C, 0x01, 0xE0,
+  0x0F, 0x00, 0x7C, 0x03, 0xE0, 0x1F, 0x01, 0xF0, 0x7F, 0x83, 0xF8, 0x1F,
+  0x80, 0xFF, 0x00, 0xF8, 0x03, 0xE0, 0x1F, 0x00, 0xF8, 0x07, 0x80, 0x3C,
+  0x01, 0xE0, 0x0F, 0x00, 0x78, 0x03, 0xE0, 0x0F, 0xF0, 0x7F, 0x80, 0xFC,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFC, 0x07,
+  0xF8, 0x3F, 0xC0, 0x1F, 0x00, 0x78, 0x03, 0xC0, 0x1E, 0x00, 0xF0, 0x07,
+  0x80, 0x7C, 0x03, 0xE0, 0x0F, 0x00, 0x7C, 0x03, 0xFC, 0x0F, 0xE0, 0x7F,
+  0x07, 0xF8, 0x3E, 0x03, 0xE0, 0x1F, 0x00, 0x78, 0x03, 0xC0, 0x1E, 0x00,
+  0xF0, 0x07, 0x80, 0x3C, 0x03, 0xE1, 0xFE, 0x0F, 0xF0, 0x7E, 0x00, 0x0E,
+  0x03, 0x1F, 0xC3, 0xDF, 0xF1, 0xEF, 0xFF, 0xEF, 0x1F, 0xF7, 0x87, 0xF1,
+  0x80, 0xE0 };
+
+const GFXglyph SimMonoBold18pt7bGlyphs[] PROGMEM = {
+  {     0,   1,   1,  21,    0,    0 },   // 0x20 ' '
+  {     1,   7,  23,  21,    7,  -22 },   // 0x21 '!'
+  {    22,  15,  13,  21,    3,  -23 },   // 0x22 '"'
+  {    47,  17,  22,  21,    2,  -21 },   // 0x23 '#'
+  {    94,  16,  30,  21,    2,  -25 },   // 0x24 '$'
+  {   154,  19,  22,  21,    1,  -21 },   // 0x25 '%'
+  {   207,  20,  23,  21,    1,  -22 },   // 0x26 '&'
+  {   265,   5,  13,  21,    8,  -23 },   // 0x27 '''
+  {   274,  11,  32,  21,    6,  -25 },   // 0x28 '('
+  {   318,  11,  32,  21,    4,  -25 },   // 0x29 ')'
+  {   362,  17,  17,  21,    2,  -19 },   // 0x2A '*'
+  {   399,  17,  16,  21,    2,  -19 },   // 0x2B '+'
+  {   433,   9,  15,  21,    6,   -6 },   // 0x2C ','
+  {   450,  17,   4,  21,    2,  -13 },   // 0x2D '-'
+  {   459,   9,   8,  21,    6,   -7 },   // 0x2E '.'
+  {   468,  15,  30,  21,    3,  -24 },   // 0x2F '/'
+  {   525,  17,  22,  21,    2,  -21 },   // 0x30 '0'
+  {   572,  16,  22,  21,    3,  -21 },   // 0x31 '1'
+  {   616,  17,  22,  21,    2,  -21 },   // 0x32 '2'
+  {   663,  18,  22,  21,    1,  -21 },   // 0x33 '3'
+  {   713,  19,  22,  21,    1,  -21 },   // 0x34 '4'
+  {   766,  17,  22,  21,    2,  -21 },   // 0x35 '5'
+  {   813,  17,  22,  21,    2,  -21 },   // 0x36 '6'
+  {   860,  17,  22,  21,    2,  -21 },   // 0x37 '7'
+  {   907,  17,  22,  21,    2,  -21 },   // 0x38 '8'
+  {   954,  17,  22,  21,    2,  -21 },   // 0x39 '9'
+  {  1001,   9,  19,  21,    6,  -18 },   // 0x3A ':'
+  {  1023,   9,  27,  21,    6,  -18 },   // 0x3B ';'
+  {  1054,  14,  20,  21,    4,  -21 },   // 0x3C '<'
+  {  1089,  17,  12,  21,    2,  -17 },   // 0x3D '='
+  {  1115,  14,  20,  21,    3,  -21 },   // 0x3E '>'
+  {  1150,  14,  24,  21,    3,  -23 },   // 0x3F '?'
+  {  1192,  18,  29,  21,    1,  -22 },   // 0x40 '@'
+  {  1258,  21,  23,  21,    0,  -22 },   // 0x41 'A'
+  {  1319,  17,  23,  21,    3,  -22 },   // 0x42 'B'
+  {  1368,  18,  23,  21,    2,  -22 },   // 0x43 'C'
+  {  1420,  17,  23,  21,    2,  -22 },   // 0x44 'D'
+  {  1469,  16,  23,  21,    3,  -22 },   // 0x45 'E'
+  {  1515,  15,  23,  21,    4,  -22 },   // 0x46 'F'
+  {  1559,  17,  23,  21,    2,  -22 },   // 0x47 'G'
+  {  1608,  17,  23,  21,    2,  -22 },   // 0x48 'H'
+  {  1657,  15,  23,  21,    3,  -22 },   // 0x49 'I'
+  {  1701,  16,  23,  21,    2,  -22 },   // 0x4A 'J'
+  {  1747,  19,  23,  21,    2,  -22 },   // 0x4B 'K'
+  {  1802,  15,  23,  21,    4,  -22 },   // 0x4C 'L'
+  {  1846,  17,  23,  21,    2,  -22 },   // 0x4D 'M'
+  {  1895,  17,  23,  21,    2,  -22 },   // 0x4E 'N'
+  {  1944,  19,  23,  21,    1,  -22 },   // 0x4F 'O'
+  {  1999,  17,  23,  21,    3,  -22 },   // 0x50 'P'
+  {  2048,  19,  29,  21,    1,  -22 },   // 0x51 'Q'
+  {  2117,  18,  23,  21,    2,  -22 },   // 0x52 'R'
+  {  2169,  17,  23,  21,    2,  -22 },   // 0x53 'S'
+  {  2218,  19,  23,  21,    1,  -22 },   // 0x54 'T'
+  {  2273,  17,  23,  21,    2,  -22 },   // 0x55 'U'
+  {  2322,  19,  23,  21,    1,  -22 },   // 0x56 'V'
+  {  2377,  21,  23,  21,    0,  -22 },   // 0x57 'W'
+  {  2438,  19,  23,  21,    1,  -22 },   // 0x58 'X'
+  {  2493,  19,  23,  21,    1,  -22 },   // 0x59 'Y'
+  {  2548,  17,  23,  21,    2,  -22 },   // 0x5A 'Z'
+  {  2597,  10,  30,  21,    7,  -24 },   // 0x5B '['
+  {  2635,  15,  30,  21,    3,  -24 },   // 0x5C
+  {  2692,  10,  30,  21,    4,  -24 },   // 0x5D ']'
+  {  2730,  15,  14,  21,    3,  -22 },   // 0x5E '^'
+  {  2757,  17,   4,  21,    2,    3 },   // 0x5F '_'
+  {  2766,   8,   6,  21,    5,  -25 },   // 0x60 '`'
+  {  2772,  17,  17,  21,    2,  -16 },   // 0x61 'a'
+  {  2809,  16,  25,  21,    3,  -24 },   // 0x62 'b'
+  {  2859,  17,  17,  21,    2,  -16 },   // 0x63 'c'
+  {  2896,  16,  25,  21,    2,  -24 },   // 0x64 'd'
+  {  2946,  17,  17,  21,    2,  -16 },   // 0x65 'e'
+  {  2983,  17,  25,  21,    3,  -24 },   // 0x66 'f'
+  {  3037,  18,  23,  21,    2,  -16 },   // 0x67 'g'
+  {  3089,  16,  25,  21,    3,  -24 },   // 0x68 'h'
+  {  3139,  13,  26,  21,    3,  -25 },   // 0x69 'i'
+  {  3182,  15,  32,  21,    1,  -25 },   // 0x6A 'j'
+  {  3242,  17,  25,  21,    3,  -24 },   // 0x6B 'k'
+  {  3296,  17,  25,  21,    2,  -24 },   // 0x6C 'l'
+  {  3350,  19,  17,  21,    1,  -16 },   // 0x6D 'm'
+  {  3391,  16,  17,  21,    3,  -16 },   // 0x6E 'n'
+  {  3425,  17,  17,  21,    2,  -16 },   // 0x6F 'o'
+  {  3462,  16,  23,  21,    3,  -16 },   // 0x70 'p'
+  {  3508,  16,  23,  21,    2,  -16 },   // 0x71 'q'
+  {  3554,  15,  17,  21,    4,  -16 },   // 0x72 'r'
+  {  3586,  17,  17,  21,    2,  -16 },   // 0x73 's'
+  {  3623,  17,  22,  21,    2,  -21 },   // 0x74 't'
+  {  3670,  16,  17,  21,    2,  -16 },   // 0x75 'u'
+  {  3704,  19,  17,  21,    1,  -16 },   // 0x76 'v'
+  {  3745,  21,  17,  21,    0,  -16 },   // 0x77 'w'
+  {  3790,  19,  17,  21,    1,  -16 },   // 0x78 'x'
+  {  3831,  19,  23,  21,    1,  -16 },   // 0x79 'y'
+  {  3886,  17,  17,  21,    2,  -16 },   // 0x7A 'z'
+  {  3923,  13,  30,  21,    4,  -24 },   // 0x7B '{'
+  {  3972,   5,  35,  21,    8,  -25 },   // 0x7C '|'
+  {  3994,  13,  30,  21,    4,  -24 },   // 0x7D '}'
+  {  4043,  17,   7,  21,    2,  -14 }    // 0x7E '~'
+};
+
+const GFXfont SimMonoBold18pt7b PROGMEM = {
+  (uint8_t  *)SimMonoBold18pt7bBitmaps,
+  (GFXglyph *)SimMonoBold18pt7bGlyphs,
+  0x20, 0x7E, 44 };
+
+// Approx. 4730 bytes
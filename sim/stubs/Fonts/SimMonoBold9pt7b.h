@@ -0,0 +1,209 @@
+// SimMonoBold9pt7b: the host builds' substitute for Adafruit GFX's
+// FreeMonoBold9pt7b, with the same character advance. Source Code Pro Bold,
+// Copyright 2010, 2012 Adobe Systems Incorporated, under the SIL Open Font
+// License 1.1 (OFL.txt). Glyph shapes, extents and line height are not the
+// device's, so text extents on the panel are not checked by the sims.
+//
+// Source Code Pro converted at 9 pt by tools/font_convert
+
+const uint8_t SimMonoBold9pt7bBitmaps[] PROGMEM = {
+  0x00, 0xFF, 0xFD, 0xB0, 0xFF, 0xF0, 0xF7, 0x77, 0x67, 0x67, 0x63, 0x63,
+  0x63, 0x13, 0x19, 0x1F, 0xEF, 0xF3, 0x61, 0x33, 0xFD, 0xFE, 0x24, 0x32,
+  0x19, 0x00, 0x08, 0x08, 0x3E, 0x7F, 0x62, 0x70, 0x7E, 0x1F, 0x07, 0x43,
+  0xFF, 0x3E, 0x08, 0x08, 0x08, 0x38, 0x0F, 0x0B, 0x33, 0xE6, 0xC7, 0xB0,
+  0x70, 0x00, 0xE0, 0x3E, 0x1E, 0xC6, 0xD9, 0x9F, 0x61, 0xC0, 0x1C, 0x07,
+  0xC0, 0xD8, 0x1B, 0x03, 0xE0, 0x79, 0xDE, 0x33, 0x7E, 0xEF, 0x8C, 0x71,
+  0xFF, 0x9E, 0x60, 0xFF, 0xFF, 0x90, 0x08, 0x73, 0x1C, 0x61, 0x8E, 0x30,
+  0xC3, 0x86, 0x18, 0x70, 0xC1, 0x83, 0x43, 0x83, 0x0E, 0x18, 0x61, 0x87,
+  0x1C, 0x61, 0x86, 0x38, 0xC6, 0x30, 0x08, 0x04, 0x02, 0x1F, 0xE7, 0xF8,
+  0xE0, 0xF8, 0x6C, 0x63, 0x00, 0x18, 0x0C, 0x06, 0x1F, 0xFF, 0xF8, 0xC0,
+  0x60, 0x30, 0x73, 0xBE, 0xF1, 0x9B, 0xC8, 0xFF, 0xFF, 0xC0, 0x7F, 0xF7,
+  0x03, 0x03, 0x07, 0x06, 0x06, 0x0C, 0x0C, 0x1C, 0x18, 0x18, 0x38, 0x30,
+  0x30, 0x60, 0x60, 0xE0, 0x3E, 0x3F, 0x98, 0xDC, 0x7D, 0xBE, 0xFF, 0x6F,
+  0xC7, 0x63, 0x3F, 0x8F, 0x00, 0x3C, 0x3E, 0x1F, 0x03, 0x81, 0xC0, 0xE0,
+  0x70, 0x38, 0x1C, 0x7F, 0xFF, 0xE0, 0x3C, 0x7F, 0x11, 0xC0, 0x60, 0x70,
+  0x30, 0x38, 0x38, 0x38, 0x7F, 0xFF, 0xE0, 0x3E, 0x7F, 0x91, 0xC0, 0xE3,
+  0xE1, 0xF0, 0x1C, 0x07, 0xC3, 0x7F, 0x9F, 0x80, 0x0F, 0x0F, 0x8F, 0xC6,
+  0xE6, 0x77, 0x3B, 0xFF, 0xFF, 0x07, 0x03, 0x81, 0xC0, 0x7F, 0x3F, 0x98,
+  0x0C, 0x07, 0xE3, 0xF9, 0x0E, 0x07, 0x47, 0x7F, 0x9F, 0x00, 0x1E, 0x3F,
+  0xDC, 0x5C, 0x0E, 0xE7, 0xFB, 0x8F, 0xC7, 0x63, 0xBF, 0x87, 0x80, 0xFF,
+  0xFF, 0xC1, 0xC0, 0xC0, 0xC0, 0x60, 0x70, 0x30, 0x18, 0x0C, 0x0E, 0x00,
+  0x3E, 0x3F, 0x98, 0xCC, 0x63, 0xE3, 0xF3, 0x9D, 0x87, 0xE3, 0xBF, 0x8F,
+  0x80, 0x3C, 0x3F, 0xB8, 0xD8, 0x6E, 0x7F, 0xFD, 0xEE, 0x06, 0x47, 0x7F,
+  0x1F, 0x00, 0x7F, 0xF7, 0x00, 0x7F, 0xF7, 0x77, 0xBC, 0xE0, 0x01, 0xCE,
+  0xFB, 0xC6, 0x6F, 0x20, 0x02, 0x1C, 0x73, 0xCE, 0x1C, 0x1E, 0x0E, 0x0E,
+  0x04, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xFC, 0x81, 0x81, 0xC1, 0xE0,
+  0xE1, 0xCF, 0x38, 0xC1, 0x00, 0x7D, 0xFD, 0x38, 0x71, 0xC7, 0x0C, 0x00,
+  0x30, 0xF1, 0xE1, 0x80, 0x1E, 0x3F, 0x98, 0xF8, 0x3C, 0x1E, 0x3E, 0x7F,
+  0x33, 0x99, 0xEF, 0xF3, 0xF8, 0x06, 0x11, 0xF8, 0x78, 0x0E, 0x03, 0xC0,
+  0x7C, 0x0D, 0x83, 0xB0, 0x67, 0x0C, 0xE1, 0xFC, 0x7F, 0xCC, 0x39, 0x87,
+  0x70, 0x70, 0xFC, 0xFE, 0xC6, 0xC6, 0xC6, 0xFC, 0xFE, 0xC7, 0xC7, 0xC7,
+  0xFE, 0xFC, 0x1F, 0x1F, 0xDC, 0x5C, 0x0E, 0x07, 0x03, 0x81, 0xC0, 0xE0,
+  0x38, 0x8F, 0xE3, 0xE0, 0xFC, 0x7F, 0xB9, 0xDC, 0x7E, 0x3F, 0x1F, 0x8F,
+  0xC7, 0xE3, 0xF3, 0xBF, 0x9F, 0x80, 0xFE, 0xFE, 0xC0, 0xC0, 0xC0, 0xFE,
+  0xFE, 0xC0, 0xC0, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xFE,
+  0xFE, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x1E, 0x3F, 0xDC, 0x5C, 0x0E, 0x07,
+  0x3F, 0x9F, 0xC7, 0xE3, 0xB9, 0xDF, 0xE3, 0xC0, 0xE3, 0xF1, 0xF8, 0xFC,
+  0x7E, 0x3F, 0xFF, 0xFF, 0xC7, 0xE3, 0xF1, 0xF8, 0xFC, 0x70, 0xFF, 0xFF,
+  0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0xFF, 0xFF, 0x7F, 0x7F,
+  0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x47, 0xFF, 0x3C, 0xE3, 0xB9,
+  0xCE, 0x73, 0xB8, 0xFC, 0x3F, 0x0F, 0xE3, 0xD8, 0xE7, 0x38, 0xCE, 0x3B,
+  0x87, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xFF,
+  0xFF, 0xE3, 0xF1, 0xFD, 0xFE, 0xBD, 0x5E, 0xAF, 0x67, 0x97, 0xC3, 0xE1,
+  0xF0, 0xF8, 0x70, 0xE3, 0xF9, 0xFC, 0xFA, 0x7D, 0xBF, 0xDF, 0xBF, 0xDF,
+  0xEF, 0xF3, 0xF9, 0xFC, 0x70, 0x3E, 0x3F, 0xB9, 0xDC, 0x7E, 0x3E, 0x1F,
+  0x0F, 0xC7, 0xE3, 0xF3, 0x9F, 0xC7, 0x80, 0xFE, 0x7F, 0xF8, 0xFC, 0x3E,
+  0x1F, 0x1F, 0xFD, 0xFC, 0xE0, 0x70, 0x38, 0x1C, 0x00, 0x3C, 0x3F, 0xB9,
+  0xDC, 0x7C, 0x3E, 0x1F, 0x0F, 0x87, 0xE3, 0xF3, 0x9F, 0xC7, 0xC1, 0xC0,
+  0x7C, 0x1E, 0xFE, 0x3F, 0xCE, 0x3B, 0x8E, 0xE3, 0xB8, 0xEF, 0xF3, 0xF8,
+  0xE6, 0x39, 0xCE, 0x3B, 0x8F, 0x3E, 0x3F, 0xD8, 0x5C, 0x07, 0x83, 0xF0,
+  0x7C, 0x0F, 0x03, 0xB1, 0xFF, 0xC7, 0xC0, 0xFF, 0xFF, 0xC7, 0x03, 0x81,
+  0xC0, 0xE0, 0x70, 0x38, 0x1C, 0x0E, 0x07, 0x03, 0x80, 0xE3, 0xF1, 0xF8,
+  0xFC, 0x7E, 0x3F, 0x1F, 0x8F, 0xC7, 0xE3, 0xF1, 0x9F, 0xC7, 0xC0, 0xE0,
+  0xEC, 0x39, 0xC7, 0x38, 0xE3, 0x18, 0x63, 0x0E, 0xE1, 0xD8, 0x1B, 0x03,
+  0x60, 0x78, 0x07, 0x00, 0xE0, 0xFC, 0x1F, 0x83, 0x30, 0x66, 0x4C, 0xDD,
+  0x9B, 0xB3, 0x56, 0x6A, 0xCF, 0x79, 0xEE, 0x19, 0xC0, 0x71, 0xDC, 0x63,
+  0xB8, 0xEC, 0x1F, 0x03, 0x81, 0xE0, 0x7C, 0x3B, 0x0C, 0xE7, 0x1F, 0x87,
+  0xE0, 0xEE, 0x39, 0xC6, 0x1D, 0xC3, 0xB0, 0x36, 0x07, 0x80, 0x70, 0x0E,
+  0x01, 0xC0, 0x38, 0x07, 0x00, 0x7F, 0xBF, 0xC1, 0xC0, 0xC0, 0xE0, 0xE0,
+  0x70, 0x70, 0x70, 0x38, 0x3F, 0xFF, 0xF0, 0xFF, 0xF1, 0x8C, 0x63, 0x18,
+  0xC6, 0x31, 0x8C, 0x63, 0xFF, 0xE0, 0x60, 0x60, 0x30, 0x30, 0x38, 0x18,
+  0x18, 0x1C, 0x0C, 0x0C, 0x06, 0x06, 0x07, 0x03, 0x03, 0xFF, 0xC6, 0x31,
+  0x8C, 0x63, 0x18, 0xC6, 0x31, 0x8F, 0xFF, 0x38, 0x71, 0xE3, 0x66, 0xD8,
+  0xF1, 0x80, 0xFF, 0xFF, 0xC0, 0xE6, 0x30, 0x3E, 0x7F, 0x90, 0xC3, 0xF7,
+  0xFF, 0x1F, 0x9F, 0xFF, 0x7B, 0x80, 0xE0, 0x70, 0x38, 0x1C, 0x0E, 0xE7,
+  0xFB, 0x8F, 0xC7, 0xE3, 0xF1, 0xF8, 0xFF, 0xED, 0xE0, 0x1F, 0x3F, 0xDC,
+  0x5C, 0x0E, 0x07, 0x01, 0xC4, 0xFF, 0x1F, 0x00, 0x03, 0x81, 0xC0, 0xE0,
+  0x73, 0xBB, 0xFF, 0x8F, 0xC7, 0xE3, 0xF1, 0xF9, 0xEF, 0xF3, 0xB8, 0x3E,
+  0x3F, 0xB8, 0xFF, 0xFF, 0xFF, 0x03, 0xC4, 0xFE, 0x3E, 0x00, 0x07, 0xC7,
+  0xE1, 0xC0, 0x60, 0xFF, 0xBF, 0xE1, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80,
+  0x60, 0x18, 0x00, 0x3F, 0xBF, 0xF9, 0xDC, 0xE7, 0xE3, 0xE3, 0x80, 0xFE,
+  0x7F, 0xE0, 0xFF, 0xEF, 0xC0, 0xE0, 0x70, 0x38, 0x1C, 0x0E, 0xF7, 0xFB,
+  0xCF, 0xC7, 0xE3, 0xF1, 0xF8, 0xFC, 0x7E, 0x38, 0x0E, 0x3C, 0x38, 0x0F,
+  0xFF, 0xC3, 0x87, 0x0E, 0x1C, 0x38, 0x70, 0xE0, 0x0E, 0x3C, 0x38, 0x0F,
+  0xFF, 0xC3, 0x87, 0x0E, 0x1C, 0x38, 0x70, 0xE1, 0xBF, 0x7C, 0xE0, 0x38,
+  0x0E, 0x03, 0x80, 0xE3, 0xB9, 0xCE, 0xE3, 0xF0, 0xFC, 0x3F, 0x8E, 0x73,
+  0x8E, 0xE3, 0xC0, 0xF8, 0x7C, 0x06, 0x03, 0x01, 0x80, 0xC0, 0x60, 0x30,
+  0x18, 0x0C, 0x07, 0x03, 0xE0, 0xF8, 0xFB, 0xFF, 0xF7, 0x7B, 0xBD, 0xDE,
+  0xEF, 0x77, 0xBB, 0xDD, 0x80, 0xEF, 0x7F, 0xBC, 0xFC, 0x7E, 0x3F, 0x1F,
+  0x8F, 0xC7, 0xE3, 0x80, 0x3E, 0x3F, 0xB8, 0xFC, 0x7E, 0x3F, 0x1F, 0x8E,
+  0xFE, 0x3E, 0x00, 0xEE, 0x7F, 0xB8, 0xFC, 0x7E, 0x3F, 0x1F, 0x8F, 0xFE,
+  0xFE, 0x70, 0x38, 0x1C, 0x00, 0x3B, 0xBF, 0xF9, 0xFC, 0x7E, 0x3F, 0x1F,
+  0x9E, 0xFF, 0x3B, 0x81, 0xC0, 0xE0, 0x70, 0xCF, 0xDF, 0xF0, 0xE0, 0xE0,
+  0xE0, 0xE0, 0xE0, 0xE0, 0x3E, 0x3F, 0x98, 0x4F, 0x03, 0xF0, 0x3D, 0x0F,
+  0xFE, 0x3E, 0x00, 0x18, 0x1C, 0x3F, 0xFF, 0xF3, 0x81, 0xC0, 0xE0, 0x70,
+  0x38, 0x0F, 0xC3, 0xE0, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE7, 0xFF,
+  0x7B, 0xC1, 0xF1, 0xF8, 0xCC, 0x67, 0x71, 0xB0, 0xD8, 0x7C, 0x1C, 0x00,
+  0xEC, 0xFD, 0xDF, 0xBB, 0x37, 0x66, 0xAC, 0xD5, 0x9A, 0xB3, 0xDE, 0x7B,
+  0x80, 0xE3, 0xBB, 0x8D, 0x87, 0xC1, 0xC1, 0xF1, 0xD8, 0xCE, 0xE3, 0x80,
+  0xC1, 0xF1, 0xD8, 0xCE, 0x67, 0x61, 0xB0, 0xF8, 0x38, 0x1C, 0x0C, 0x1E,
+  0x1E, 0x00, 0x7F, 0xBF, 0x81, 0xC1, 0xC1, 0xC1, 0xC1, 0xC1, 0xFF, 0xFF,
+  0x80, 0x1E, 0x7C, 0xC1, 0x83, 0x06, 0x0C, 0x78, 0xF0, 0x60, 0xC1, 0x83,
+  0x06, 0x0F, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xF1, 0xE0,
+  0xE1, 0xC3, 0x06, 0x0E, 0x0F, 0x1E, 0x70, 0xC1, 0x83, 0x87, 0x3C, 0x78,
+  0x31, 0x3C, 0xF3, 0xD8, 0xC0 };
+
+const GFXglyph SimMonoBold9pt7bGlyphs[] PROGMEM = {
+  {     0,   1,   1,  11,    0,    0 },   // 0x20 ' '
+  {     1,   3,  12,  11,    4,  -11 },   // 0x21 '!'
+  {     6,   8,   7,  11,    1,  -11 },   // 0x22 '"'
+  {    13,   9,  11,  11,    1,  -10 },   // 0x23 '#'
+  {    26,   8,  15,  11,    1,  -12 },   // 0x24 '$'
+  {    41,  11,  12,  11,    0,  -11 },   // 0x25 '%'
+  {    58,  11,  12,  11,    0,  -11 },   // 0x26 '&'
+  {    75,   3,   7,  11,    4,  -11 },   // 0x27 '''
+  {    78,   6,  16,  11,    3,  -12 },   // 0x28 '('
+  {    90,   6,  16,  11,    2,  -12 },   // 0x29 ')'
+  {   102,   9,   9,  11,    1,  -10 },   // 0x2A '*'
+  {   113,   9,   8,  11,    1,   -9 },   // 0x2B '+'
+  {   122,   5,   8,  11,    3,   -3 },   // 0x2C ','
+  {   127,   9,   2,  11,    1,   -6 },   // 0x2D '-'
+  {   130,   4,   4,  11,    3,   -3 },   // 0x2E '.'
+  {   132,   8,  16,  11,    1,  -12 },   // 0x2F '/'
+  {   148,   9,  11,  11,    1,  -10 },   // 0x30 '0'
+  {   161,   9,  11,  11,    1,  -10 },   // 0x31 '1'
+  {   174,   9,  11,  11,    1,  -10 },   // 0x32 '2'
+  {   187,   9,  11,  11,    1,  -10 },   // 0x33 '3'
+  {   200,   9,  11,  11,    1,  -10 },   // 0x34 '4'
+  {   213,   9,  11,  11,    1,  -10 },   // 0x35 '5'
+  {   226,   9,  11,  11,    1,  -10 },   // 0x36 '6'
+  {   239,   9,  11,  11,    1,  -10 },   // 0x37 '7'
+  {   252,   9,  11,  11,    1,  -10 },   // 0x38 '8'
+  {   265,   9,  11,  11,    1,  -10 },   // 0x39 '9'
+  {   278,   4,  10,  11,    3,   -9 },   // 0x3A ':'
+  {   283,   5,  14,  11,    3,   -9 },   // 0x3B ';'
+  {   292,   7,  10,  11,    2,  -10 },   // 0x3C '<'
+  {   301,   9,   6,  11,    1,   -8 },   // 0x3D '='
+  {   308,   7,  10,  11,    2,  -10 },   // 0x3E '>'
+  {   317,   7,  12,  11,    2,  -11 },   // 0x3F '?'
+  {   328,   9,  15,  11,    1,  -11 },   // 0x40 '@'
+  {   345,  11,  12,  11,    0,  -11 },   // 0x41 'A'
+  {   362,   8,  12,  11,    2,  -11 },   // 0x42 'B'
+  {   374,   9,  12,  11,    1,  -11 },   // 0x43 'C'
+  {   388,   9,  12,  11,    1,  -11 },   // 0x44 'D'
+  {   402,   8,  12,  11,    2,  -11 },   // 0x45 'E'
+  {   414,   8,  12,  11,    2,  -11 },   // 0x46 'F'
+  {   426,   9,  12,  11,    1,  -11 },   // 0x47 'G'
+  {   440,   9,  12,  11,    1,  -11 },   // 0x48 'H'
+  {   454,   8,  12,  11,    1,  -11 },   // 0x49 'I'
+  {   466,   8,  12,  11,    1,  -11 },   // 0x4A 'J'
+  {   478,  10,  12,  11,    1,  -11 },   // 0x4B 'K'
+  {   493,   8,  12,  11,    2,  -11 },   // 0x4C 'L'
+  {   505,   9,  12,  11,    1,  -11 },   // 0x4D 'M'
+  {   519,   9,  12,  11,    1,  -11 },   // 0x4E 'N'
+  {   533,   9,  12,  11,    1,  -11 },   // 0x4F 'O'
+  {   547,   9,  12,  11,    1,  -11 },   // 0x50 'P'
+  {   561,   9,  15,  11,    1,  -11 },   // 0x51 'Q'
+  {   578,  10,  12,  11,    1,  -11 },   // 0x52 'R'
+  {   593,   9,  12,  11,    1,  -11 },   // 0x53 'S'
+  {   607,   9,  12,  11,    1,  -11 },   // 0x54 'T'
+  {   621,   9,  12,  11,    1,  -11 },   // 0x55 'U'
+  {   635,  11,  12,  11,    0,  -11 },   // 0x56 'V'
+  {   652,  11,  12,  11,    0,  -11 },   // 0x57 'W'
+  {   669,  10,  12,  11,    0,  -11 },   // 0x58 'X'
+  {   684,  11,  12,  11,    0,  -11 },   // 0x59 'Y'
+  {   701,   9,  12,  11,    1,  -11 },   // 0x5A 'Z'
+  {   715,   5,  16,  11,    4,  -12 },   // 0x5B '['
+  {   725,   8,  16,  11,    1,  -12 },   // 0x5C
+  {   741,   5,  16,  11,    2,  -12 },   // 0x5D ']'
+  {   751,   7,   7,  11,    2,  -11 },   // 0x5E '^'
+  {   758,   9,   2,  11,    1,    2 },   // 0x5F '_'
+  {   761,   4,   3,  11,    3,  -12 },   // 0x60 '`'
+  {   763,   9,   9,  11,    1,   -8 },   // 0x61 'a'
+  {   774,   9,  13,  11,    1,  -12 },   // 0x62 'b'
+  {   789,   9,   9,  11,    1,   -8 },   // 0x63 'c'
+  {   800,   9,  13,  11,    1,  -12 },   // 0x64 'd'
+  {   815,   9,   9,  11,    1,   -8 },   // 0x65 'e'
+  {   826,  10,  13,  11,    1,  -12 },   // 0x66 'f'
+  {   843,   9,  12,  11,    1,   -8 },   // 0x67 'g'
+  {   857,   9,  13,  11,    1,  -12 },   // 0x68 'h'
+  {   872,   7,  13,  11,    1,  -12 },   // 0x69 'i'
+  {   884,   7,  16,  11,    1,  -12 },   // 0x6A 'j'
+  {   898,  10,  13,  11,    1,  -12 },   // 0x6B 'k'
+  {   915,   9,  13,  11,    1,  -12 },   // 0x6C 'l'
+  {   930,   9,   9,  11,    1,   -8 },   // 0x6D 'm'
+  {   941,   9,   9,  11,    1,   -8 },   // 0x6E 'n'
+  {   952,   9,   9,  11,    1,   -8 },   // 0x6F 'o'
+  {   963,   9,  12,  11,    1,   -8 },   // 0x70 'p'
+  {   977,   9,  12,  11,    1,   -8 },   // 0x71 'q'
+  {   991,   8,   9,  11,    2,   -8 },   // 0x72 'r'
+  {  1000,   9,   9,  11,    1,   -8 },   // 0x73 's'
+  {  1011,   9,  11,  11,    1,  -10 },   // 0x74 't'
+  {  1024,   8,   9,  11,    1,   -8 },   // 0x75 'u'
+  {  1033,   9,   9,  11,    1,   -8 },   // 0x76 'v'
+  {  1044,  11,   9,  11,    0,   -8 },   // 0x77 'w'
+  {  1057,   9,   9,  11,    1,   -8 },   // 0x78 'x'
+  {  1068,   9,  12,  11,    1,   -8 },   // 0x79 'y'
+  {  1082,   9,   9,  11,    1,   -8 },   // 0x7A 'z'
+  {  1093,   7,  16,  11,    2,  -12 },   // 0x7B '{'
+  {  1107,   3,  18,  11,    4,  -12 },   // 0x7C '|'
+  {  1114,   7,  16,  11,    2,  -12 },   // 0x7D '}'
+  {  1128,   9,   4,  11,    1,   -7 }    // 0x7E '~'
+};
+
+const GFXfont SimMonoBold9pt7b PROGMEM = {
+  (uint8_t  *)SimMonoBold9pt7bBitmaps,
+  (GFXglyph *)SimMonoBold9pt7bGlyphs,
+  0x20, 0x7E, 22 };
+
+// Approx. 1805 bytes
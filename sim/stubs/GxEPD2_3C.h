@@ -0,0 +1,7 @@
+#ifndef SIM_GXEPD2_3C_H
+#define SIM_GXEPD2_3C_H
+
+// Included by display.h; the three-colour panels are not simulated
+#include "GxEPD2_BW.h"
+
+#endif // SIM_GXEPD2_3C_H
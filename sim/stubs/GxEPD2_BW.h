@@ -0,0 +1,196 @@
+#ifndef SIM_GXEPD2_BW_H
+#define SIM_GXEPD2_BW_H
+
+// Host stand-in for GxEPD2_BW and the E290 driver class. Drawing and window
+// handling follow GxEPD2 (single full-height page); the driver writes into
+// the SimPanel model instead of SPI.
+
+#include <Adafruit_GFX.h>
+#include <SPI.h>
+#include "sim_panel.h"
+
+#define GxEPD_BLACK 0x0000
+#define GxEPD_WHITE 0xFFFF
+
+class GxEPD2_290_T94_V2 {
+public:
+  static const uint16_t WIDTH = SimPanel::WIDTH;
+  static const uint16_t HEIGHT = SimPanel::HEIGHT;
+  static const bool hasPartialUpdate = true;
+  static const bool hasFastPartialUpdate = true;
+
+  GxEPD2_290_T94_V2(int16_t cs, int16_t dc, int16_t rst, int16_t busy) {}
+
+  void init(uint32_t serial_diag_bitrate = 0) {}
+
+  void writeImage(const uint8_t bitmap[], int16_t x, int16_t y, int16_t w, int16_t h,
+                  bool invert = false, bool mirror_y = false, bool pgm = false) {
+    SimPanel::instance().write(false, bitmap, 0, 0, w, h, x, y, w, h, invert);
+  }
+  void writeImageAgain(const uint8_t bitmap[], int16_t x, int16_t y, int16_t w, int16_t h,
+                       bool invert = false, bool mirror_y = false, bool pgm = false) {
+    SimPanel::instance().write(true, bitmap, 0, 0, w, h, x, y, w, h, invert);
+  }
+  void writeImagePart(const uint8_t bitmap[], int16_t x_part, int16_t y_part, int16_t w_bitmap, int16_t h_bitmap,
+                      int16_t x, int16_t y, int16_t w, int16_t h,
+                      bool invert = false, bool mirror_y = false, bool pgm = false) {
+    SimPanel::instance().write(false, bitmap, x_part, y_part, w_bitmap, h_bitmap, x, y, w, h, invert);
+  }
+  void writeImagePartAgain(const uint8_t bitmap[], int16_t x_part, int16_t y_part, int16_t w_bitmap, int16_t h_bitmap,
+                           int16_t x, int16_t y, int16_t w, int16_t h,
+                           bool invert = false, bool mirror_y = false, bool pgm = false) {
+    SimPanel::instance().write(true, bitmap, x_part, y_part, w_bitmap, h_bitmap, x, y, w, h, invert);
+  }
+
+  void refresh(bool partial_update_mode = false) {
+    if (partial_update_mode) {
+      refresh(0, 0, WIDTH, HEIGHT);
+    } else {
+      SimPanel::instance().refreshAll();
+    }
+  }
+  void refresh(int16_t x, int16_t y, int16_t w, int16_t h) {
+    SimPanel::instance().refreshArea(x, y, w, h);
+  }
+
+  void powerOff() {}
+  void hibernate() {}
+};
+
+template <typename GxEPD2_Type, const uint16_t page_height>
+class GxEPD2_BW : public Adafruit_GFX {
+public:
+  GxEPD2_Type epd2;
+
+  GxEPD2_BW(GxEPD2_Type epd2_instance)
+    : Adafruit_GFX(GxEPD2_Type::WIDTH, GxEPD2_Type::HEIGHT), epd2(epd2_instance) {
+    memset(buffer, 0xFF, sizeof(buffer));
+    setFullWindow();
+  }
+
+  void init(uint32_t serial_diag_bitrate = 0, bool initial = true, uint16_t reset_duration = 10,
+            bool pulldown_rst_mode = false) {
+    epd2.init(serial_diag_bitrate);
+    setFullWindow();
+  }
+
+  void drawPixel(int16_t x, int16_t y, uint16_t color) override {
+    if (x < 0 || x >= width() || y < 0 || y >= height()) {
+      return;
+    }
+    int16_t t;
+    switch (getRotation()) {
+      case 1:
+        t = x; x = y; y = t;
+        x = GxEPD2_Type::WIDTH - x - 1;
+        break;
+      case 2:
+        x = GxEPD2_Type::WIDTH - x - 1;
+        y = GxEPD2_Type::HEIGHT - y - 1;
+        break;
+      case 3:
+        t = x; x = y; y = t;
+        y = GxEPD2_Type::HEIGHT - y - 1;
+        break;
+    }
+    // Partial window clips drawing, as with the library's window-sized buffer
+    if (x < pw_x || x >= pw_x + pw_w || y < pw_y || y >= pw_y + pw_h) {
+      return;
+    }
+    uint16_t i = x / 8 + y * ROW_BYTES;
+    if (color) {
+      buffer[i] |= 1 << (7 - x % 8);
+    } else {
+      buffer[i] &= ~(1 << (7 - x % 8));
+    }
+  }
+
+  void fillScreen(uint16_t color) override {
+    if (!using_partial_mode) {
+      memset(buffer, color ? 0xFF : 0x00, sizeof(buffer));
+    } else {
+      Adafruit_GFX::fillScreen(color);
+    }
+  }
+
+  void setFullWindow() {
+    using_partial_mode = false;
+    pw_x = 0;
+    pw_y = 0;
+    pw_w = GxEPD2_Type::WIDTH;
+    pw_h = GxEPD2_Type::HEIGHT;
+  }
+
+  void setPartialWindow(int16_t x, int16_t y, int16_t w, int16_t h) {
+    rotateWindow(x, y, w, h);
+    using_partial_mode = true;
+    pw_x = x;
+    pw_y = y;
+    pw_w = w;
+    pw_h = h;
+  }
+
+  void display(bool partial_update_mode = false) {
+    if (using_partial_mode) {
+      displayWindowNative(pw_x, pw_y, pw_w, pw_h);
+      return;
+    }
+    epd2.writeImage(buffer, 0, 0, GxEPD2_Type::WIDTH, GxEPD2_Type::HEIGHT);
+    epd2.refresh(partial_update_mode);
+    epd2.writeImageAgain(buffer, 0, 0, GxEPD2_Type::WIDTH, GxEPD2_Type::HEIGHT);
+  }
+
+  void displayWindow(int16_t x, int16_t y, int16_t w, int16_t h) {
+    rotateWindow(x, y, w, h);
+    displayWindowNative(x, y, w, h);
+  }
+
+  // Single page: the first pass is the only one
+  void firstPage() {}
+  bool nextPage() {
+    display(using_partial_mode);
+    return false;
+  }
+
+  void powerOff() { epd2.powerOff(); }
+  void hibernate() { epd2.hibernate(); }
+
+private:
+  static const uint16_t ROW_BYTES = GxEPD2_Type::WIDTH / 8;
+
+  uint8_t buffer[ROW_BYTES * GxEPD2_Type::HEIGHT];
+  bool using_partial_mode = false;
+  int16_t pw_x = 0, pw_y = 0, pw_w = 0, pw_h = 0;
+
+  void rotateWindow(int16_t& x, int16_t& y, int16_t& w, int16_t& h) {
+    int16_t t;
+    switch (getRotation()) {
+      case 1:
+        t = x; x = y; y = t;
+        t = w; w = h; h = t;
+        x = GxEPD2_Type::WIDTH - x - w;
+        break;
+      case 2:
+        x = GxEPD2_Type::WIDTH - x - w;
+        y = GxEPD2_Type::HEIGHT - y - h;
+        break;
+      case 3:
+        t = x; x = y; y = t;
+        t = w; w = h; h = t;
+        y = GxEPD2_Type::HEIGHT - y - h;
+        break;
+    }
+    // Controller addresses whole bytes horizontally
+    w += x % 8;
+    x -= x % 8;
+    w = 8 * ((w + 7) / 8);
+  }
+
+  void displayWindowNative(int16_t x, int16_t y, int16_t w, int16_t h) {
+    epd2.writeImagePart(buffer, x, y, GxEPD2_Type::WIDTH, GxEPD2_Type::HEIGHT, x, y, w, h);
+    epd2.refresh(x, y, w, h);
+    epd2.writeImagePartAgain(buffer, x, y, GxEPD2_Type::WIDTH, GxEPD2_Type::HEIGHT, x, y, w, h);
+  }
+};
+
+#endif // SIM_GXEPD2_BW_H
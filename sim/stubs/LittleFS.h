@@ -0,0 +1,129 @@
+#ifndef SIM_LITTLEFS_H
+#define SIM_LITTLEFS_H
+
+// LittleFS stand-in for host builds: the filesystem is a directory on the
+// host (simRoot), files are stdio streams. Only what src/ uses is provided.
+
+#include <Arduino.h>
+#include <memory>
+#include <string>
+#include <dirent.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#define FILE_READ "r"
+#define FILE_WRITE "w"
+#define FILE_APPEND "a"
+
+namespace fs {
+
+class File {
+private:
+  struct Handle {
+    FILE* stream = nullptr;
+    DIR* dir = nullptr;
+    std::string path;
+    std::string name;
+    ~Handle() {
+      if (stream) fclose(stream);
+      if (dir) closedir(dir);
+    }
+  };
+  std::shared_ptr<Handle> handle;
+
+public:
+  File() {}
+
+  static File openPath(const std::string& hostPath, const std::string& name, const char* mode) {
+    File file;
+    struct stat st;
+    bool isDir = stat(hostPath.c_str(), &st) == 0 && S_ISDIR(st.st_mode);
+    std::shared_ptr<Handle> h(new Handle());
+    h->path = hostPath;
+    h->name = name;
+    if (isDir) {
+      h->dir = opendir(hostPath.c_str());
+      if (!h->dir) return file;
+    } else {
+      // Arduino-ESP32 opens "a" files readable as well; "a+" gives the same
+      h->stream = fopen(hostPath.c_str(), strcmp(mode, FILE_APPEND) == 0 ? "a+b" :
+                                          strcmp(mode, FILE_WRITE) == 0 ? "w+b" : "rb");
+      if (!h->stream) return file;
+    }
+    file.handle = h;
+    return file;
+  }
+
+  operator bool() const { return handle && (handle->stream || handle->dir); }
+  bool isDirectory() const { return handle && handle->dir; }
+  const char* name() const { return handle ? handle->name.c_str() : ""; }
+
+  size_t size() const {
+    struct stat st;
+    if (!handle || stat(handle->path.c_str(), &st) != 0) return 0;
+    if (handle->stream) fflush(handle->stream);
+    return stat(handle->path.c_str(), &st) == 0 ? st.st_size : 0;
+  }
+
+  size_t write(const uint8_t* data, size_t length) {
+    return handle && handle->stream ? fwrite(data, 1, length, handle->stream) : 0;
+  }
+
+  size_t read(uint8_t* data, size_t length) {
+    return handle && handle->stream ? fread(data, 1, length, handle->stream) : 0;
+  }
+
+  bool seek(uint32_t position) {
+    return handle && handle->stream && fseek(handle->stream, position, SEEK_SET) == 0;
+  }
+
+  void close() { handle.reset(); }
+
+  File openNextFile() {
+    if (!handle || !handle->dir) return File();
+    struct dirent* entry;
+    while ((entry = readdir(handle->dir)) != nullptr) {
+      if (strcmp(entry->d_name, ".") != 0 && strcmp(entry->d_name, "..") != 0) {
+        return openPath(handle->path + "/" + entry->d_name, entry->d_name, FILE_READ);
+      }
+    }
+    return File();
+  }
+};
+
+class LittleFSFS {
+private:
+  std::string root = "sim_fs";
+
+  std::string hostPath(const char* path) const { return root + path; }
+
+public:
+  void setRoot(const char* dir) { root = dir; }   // Host only
+
+  bool begin(bool formatOnFail = false) {
+    (void)formatOnFail;
+    ::mkdir(root.c_str(), 0755);
+    return true;
+  }
+
+  File open(const char* path, const char* mode = FILE_READ) {
+    const char* slash = strrchr(path, '/');
+    return File::openPath(hostPath(path), slash ? slash + 1 : path, mode);
+  }
+
+  bool exists(const char* path) {
+    struct stat st;
+    return stat(hostPath(path).c_str(), &st) == 0;
+  }
+
+  bool mkdir(const char* path) { return ::mkdir(hostPath(path).c_str(), 0755) == 0; }
+  bool remove(const char* path) { return ::unlink(hostPath(path).c_str()) == 0; }
+};
+
+} // namespace fs
+
+using fs::File;
+
+extern fs::LittleFSFS LittleFS;
+
+#endif // SIM_LITTLEFS_H
@@ -0,0 +1,136 @@
+#ifndef SIM_NIMBLE_DEVICE_H
+#define SIM_NIMBLE_DEVICE_H
+
+// NimBLE stand-in for host builds. There is no radio: scans and the GAP calls
+// succeed (so the energy accounting sees the radio on) but report nothing.
+// Advertisements are made up by the simulator as NimBLEAdvertisedDevice
+// objects and handed to VictronBLE::handleAdvertisement.
+
+#include <stdint.h>
+#include <string.h>
+#include <string>
+
+#define ESP_PWR_LVL_P9 9
+
+typedef struct {
+  uint8_t type;
+  uint8_t val[6];
+} ble_addr_t;
+
+class NimBLEAddress {
+private:
+  uint8_t address[6];
+
+public:
+  NimBLEAddress() { memset(address, 0, sizeof(address)); }
+  explicit NimBLEAddress(const uint8_t* native) { memcpy(address, native, sizeof(address)); }
+  const uint8_t* getNative() const { return address; }
+};
+
+class NimBLEAdvertisedDevice {
+private:
+  NimBLEAddress address;
+  std::string manufacturerData;
+  int rssi;
+
+public:
+  // native: controller byte order; data: manufacturer data including the company ID
+  NimBLEAdvertisedDevice(const uint8_t* native, const std::string& data, int rssiValue)
+    : address(native), manufacturerData(data), rssi(rssiValue) {}
+
+  NimBLEAddress getAddress() const { return address; }
+  bool haveManufacturerData() const { return !manufacturerData.empty(); }
+  std::string getManufacturerData() const { return manufacturerData; }
+  int getRSSI() const { return rssi; }
+};
+
+class NimBLEAdvertisedDeviceCallbacks {
+public:
+  virtual ~NimBLEAdvertisedDeviceCallbacks() {}
+  virtual void onResult(NimBLEAdvertisedDevice* advertisedDevice) = 0;
+};
+
+class NimBLEScan {
+public:
+  void setAdvertisedDeviceCallbacks(NimBLEAdvertisedDeviceCallbacks*, bool = false) {}
+  void setInterval(uint16_t) {}
+  void setWindow(uint16_t) {}
+  void setActiveScan(bool) {}
+  void setDuplicateFilter(bool) {}
+  bool start(uint32_t, void (*)(int), bool) { return true; }
+  bool stop() { return true; }
+};
+
+class NimBLEDevice {
+public:
+  static void init(const std::string&) {}
+  static void setPower(int) {}
+  static NimBLEScan* getScan() { return nullptr; }
+};
+
+// Raw GAP interface
+#define BLE_ADDR_PUBLIC 0
+#define BLE_ADDR_RANDOM 1
+#define BLE_OWN_ADDR_PUBLIC 0
+#define BLE_HCI_SCAN_FILT_NO_WL 0
+#define BLE_HCI_SCAN_FILT_USE_WL 1
+#define BLE_HS_FOREVER 0x7fffffff
+#define BLE_HS_ENOTSUP 8
+#define BLE_HS_ADV_TYPE_MFG_DATA 0xff
+#define BLE_GAP_EVENT_DISC 7
+#define BLE_GAP_EVENT_DISC_COMPLETE 8
+
+struct ble_gap_disc_params {
+  uint16_t itvl;
+  uint16_t window;
+  uint8_t filter_policy;
+  uint8_t limited;
+  uint8_t passive;
+  uint8_t filter_duplicates;
+};
+
+struct ble_gap_disc_desc {
+  uint8_t event_type;
+  uint8_t length_data;
+  ble_addr_t addr;
+  int8_t rssi;
+  const uint8_t* data;
+};
+
+struct ble_gap_event {
+  uint8_t type;
+  union {
+    struct ble_gap_disc_desc disc;
+    struct {
+      int reason;
+    } disc_complete;
+  };
+};
+
+typedef int ble_gap_event_fn(struct ble_gap_event* event, void* arg);
+
+inline int ble_gap_wl_set(const ble_addr_t*, uint8_t) { return 0; }
+// The raw scan in progress, for simulators that reach the scanner through it
+struct SimGapScan {
+  ble_gap_event_fn* handler;
+  void* arg;
+};
+
+inline SimGapScan& simGapScan() {
+  static SimGapScan scan = {nullptr, nullptr};
+  return scan;
+}
+
+inline int ble_gap_disc(uint8_t, int32_t, const struct ble_gap_disc_params*, ble_gap_event_fn* handler, void* arg) {
+  simGapScan().handler = handler;
+  simGapScan().arg = arg;
+  return 0;
+}
+
+inline int ble_gap_disc_cancel() {
+  simGapScan().handler = nullptr;
+  simGapScan().arg = nullptr;
+  return 0;
+}
+
+#endif // SIM_NIMBLE_DEVICE_H
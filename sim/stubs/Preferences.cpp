@@ -0,0 +1,58 @@
+#include <Preferences.h>
+#include <map>
+
+// Namespace and key joined by a NUL, which neither can contain
+static std::map<std::string, std::string>& storage() {
+  static std::map<std::string, std::string> entries;
+  return entries;
+}
+
+static std::string entryName(const std::string& space, const char* key) {
+  return space + '\0' + key;
+}
+
+bool Preferences::lookup(const char* key, std::string& value) const {
+  std::map<std::string, std::string>::const_iterator it = storage().find(entryName(space, key));
+  if (it == storage().end()) {
+    return false;
+  }
+  value = it->second;
+  return true;
+}
+
+void Preferences::store(const char* key, const std::string& value) {
+  storage()[entryName(space, key)] = value;
+}
+
+bool Preferences::clear() {
+  std::string prefix = space + '\0';
+  std::map<std::string, std::string>::iterator it = storage().lower_bound(prefix);
+  while (it != storage().end() && it->first.compare(0, prefix.size(), prefix) == 0) {
+    storage().erase(it++);
+  }
+  return true;
+}
+
+bool Preferences::remove(const char* key) {
+  return storage().erase(entryName(space, key)) > 0;
+}
+
+String Preferences::getString(const char* key, const String& defaultValue) const {
+  std::string value;
+  return lookup(key, value) ? String(value.c_str()) : defaultValue;
+}
+
+size_t Preferences::putString(const char* key, const char* value) {
+  store(key, value);
+  return strlen(value);
+}
+
+uint8_t Preferences::getUChar(const char* key, uint8_t defaultValue) const {
+  std::string value;
+  return lookup(key, value) && value.size() == 1 ? (uint8_t)value[0] : defaultValue;
+}
+
+size_t Preferences::putUChar(const char* key, uint8_t value) {
+  store(key, std::string(1, (char)value));
+  return 1;
+}
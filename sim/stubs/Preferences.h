@@ -0,0 +1,32 @@
+#ifndef SIM_PREFERENCES_H
+#define SIM_PREFERENCES_H
+
+// NVS preferences stand-in: an in-memory store that outlives the objects
+// using it, as flash does, but not the process.
+
+#include <Arduino.h>
+#include <string>
+
+class Preferences {
+private:
+  std::string space;
+
+  bool lookup(const char* key, std::string& value) const;
+  void store(const char* key, const std::string& value);
+
+public:
+  bool begin(const char* name, bool readOnly = false) {
+    space = name;
+    return true;
+  }
+  void end() {}
+  bool clear();
+  bool remove(const char* key);
+
+  String getString(const char* key, const String& defaultValue = String()) const;
+  size_t putString(const char* key, const char* value);
+  uint8_t getUChar(const char* key, uint8_t defaultValue = 0) const;
+  size_t putUChar(const char* key, uint8_t value);
+};
+
+#endif // SIM_PREFERENCES_H
@@ -0,0 +1,78 @@
+#include <WebServer.h>
+#include <deque>
+
+struct QueuedRequest {
+  std::string path;
+  HTTPMethod method;
+  std::string args;
+};
+
+static std::deque<QueuedRequest> pending;
+static SimHttpStats stats = {0, 0, 0, 0};
+
+void WebServer::simQueueRequest(const char* path, HTTPMethod method, const char* args) {
+  QueuedRequest request = {path, method, args};
+  pending.push_back(request);
+}
+
+const SimHttpStats& WebServer::simStats() {
+  return stats;
+}
+
+void WebServer::handleClient() {
+  if (!running || pending.empty()) {
+    return;
+  }
+  QueuedRequest request = pending.front();
+  pending.pop_front();
+  stats.requests++;
+
+  currentArgs = request.args;
+  currentClient = WiFiClient::simConnected();
+  for (size_t i = 0; i < routes.size(); i++) {
+    const Route& route = routes[i];
+    if (route.path == request.path && (route.method == HTTP_ANY || route.method == request.method)) {
+      route.handler();
+      return;
+    }
+  }
+  stats.notFound++;
+  send(404, "text/plain", "Not found");
+}
+
+void WebServer::send(int code, const char*, const String& content) {
+  stats.lastStatus = code;
+  sendContent(content.c_str(), content.length());
+}
+
+void WebServer::sendContent(const char* content, size_t length) {
+  stats.responseBytes += length;
+  currentClient.write((const uint8_t*)content, length);
+}
+
+// Arguments are matched on the raw text; the simulator does not URL-encode
+bool WebServer::hasArg(const char* name) const {
+  std::string key = std::string(name) + "=";
+  size_t pos = 0;
+  while ((pos = currentArgs.find(key, pos)) != std::string::npos) {
+    if (pos == 0 || currentArgs[pos - 1] == '&') {
+      return true;
+    }
+    pos++;
+  }
+  return false;
+}
+
+String WebServer::arg(const char* name) const {
+  std::string key = std::string(name) + "=";
+  size_t pos = 0;
+  while ((pos = currentArgs.find(key, pos)) != std::string::npos) {
+    if (pos == 0 || currentArgs[pos - 1] == '&') {
+      size_t start = pos + key.size();
+      size_t end = currentArgs.find('&', start);
+      return String(currentArgs.substr(start, end == std::string::npos ? std::string::npos : end - start).c_str());
+    }
+    pos++;
+  }
+  return String();
+}
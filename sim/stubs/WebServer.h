@@ -0,0 +1,66 @@
+#ifndef SIM_WEBSERVER_H
+#define SIM_WEBSERVER_H
+
+// WebServer stand-in. Routes are registered as on the device; requests come
+// from a queue the simulator fills (simQueueRequest) and are served one per
+// handleClient() call, with the response written to a counting client.
+
+#include <Arduino.h>
+#include <WiFi.h>
+#include <functional>
+#include <string>
+#include <vector>
+
+enum HTTPMethod { HTTP_ANY, HTTP_GET, HTTP_POST };
+
+#define CONTENT_LENGTH_UNKNOWN ((size_t)-1)
+
+struct SimHttpStats {
+  uint32_t requests;
+  uint32_t notFound;
+  size_t responseBytes;
+  int lastStatus;
+};
+
+class WebServer {
+private:
+  struct Route {
+    std::string path;
+    HTTPMethod method;
+    std::function<void()> handler;
+  };
+  std::vector<Route> routes;
+  bool running;
+  std::string currentArgs;        // "name=value&..." of the request being served
+  WiFiClient currentClient;
+
+public:
+  explicit WebServer(int port = 80) : running(false) {}
+
+  void on(const char* uri, std::function<void()> handler) { on(uri, HTTP_ANY, handler); }
+  void on(const char* uri, HTTPMethod method, std::function<void()> handler) {
+    Route route = {uri, method, handler};
+    routes.push_back(route);
+  }
+  void begin() { running = true; }
+  void stop() { running = false; }
+  void handleClient();
+
+  void send(int code, const char* contentType, const String& content);
+  void send(int code, const char* contentType, const char* content) { send(code, contentType, String(content)); }
+  void setContentLength(size_t) {}
+  void sendHeader(const char*, const char*, bool = false) {}
+  void sendContent(const char* content, size_t length);
+  void sendContent(const char* content) { sendContent(content, strlen(content)); }
+  void sendContent(const String& content) { sendContent(content.c_str(), content.length()); }
+
+  bool hasArg(const char* name) const;
+  String arg(const char* name) const;
+  WiFiClient client() { return currentClient; }
+
+  // Requests for whichever server is running, served in order
+  static void simQueueRequest(const char* path, HTTPMethod method = HTTP_GET, const char* args = "");
+  static const SimHttpStats& simStats();
+};
+
+#endif // SIM_WEBSERVER_H
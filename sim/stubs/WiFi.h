@@ -0,0 +1,95 @@
+#ifndef SIM_WIFI_H
+#define SIM_WIFI_H
+
+// WiFi stand-in: the access point only records whether it is up, and clients
+// are byte sinks that stay connected until stopped.
+
+#include <Arduino.h>
+#include <memory>
+
+typedef enum {
+  WIFI_OFF = 0,
+  WIFI_STA = 1,
+  WIFI_AP = 2
+} wifi_mode_t;
+
+class IPAddress {
+private:
+  uint8_t octets[4];
+
+public:
+  IPAddress(uint8_t a = 0, uint8_t b = 0, uint8_t c = 0, uint8_t d = 0) : octets{a, b, c, d} {}
+  String toString() const {
+    char text[16];
+    snprintf(text, sizeof(text), "%u.%u.%u.%u", octets[0], octets[1], octets[2], octets[3]);
+    return String(text);
+  }
+};
+
+class WiFiClient : public Print {
+private:
+  struct Connection {
+    bool open = true;
+    size_t bytesWritten = 0;
+  };
+  std::shared_ptr<Connection> connection;
+
+public:
+  WiFiClient() {}
+
+  // A connected client, as the web server hands out for the current request
+  static WiFiClient simConnected() {
+    WiFiClient client;
+    client.connection = std::make_shared<Connection>();
+    return client;
+  }
+
+  bool connected() const { return connection && connection->open; }
+  void stop() {
+    if (connection) connection->open = false;
+  }
+  size_t getBytesWritten() const { return connection ? connection->bytesWritten : 0; }
+
+  size_t write(uint8_t) override {
+    if (!connected()) return 0;
+    connection->bytesWritten++;
+    return 1;
+  }
+  size_t write(const uint8_t* buffer, size_t size) {
+    if (!connected()) return 0;
+    connection->bytesWritten += size;
+    return size;
+  }
+  using Print::write;
+
+  operator bool() const { return connected(); }
+};
+
+class WiFiClass {
+private:
+  wifi_mode_t currentMode = WIFI_OFF;
+  bool apRunning = false;
+
+public:
+  bool mode(wifi_mode_t m) {
+    currentMode = m;
+    if (m == WIFI_OFF) apRunning = false;
+    return true;
+  }
+  wifi_mode_t getMode() const { return currentMode; }
+  bool softAP(const char*, const char* = nullptr) {
+    apRunning = currentMode == WIFI_AP;
+    return apRunning;
+  }
+  IPAddress softAPIP() const { return apRunning ? IPAddress(192, 168, 4, 1) : IPAddress(); }
+  bool softAPdisconnect(bool wifiOff = false) {
+    apRunning = false;
+    if (wifiOff) currentMode = WIFI_OFF;
+    return true;
+  }
+  bool isAccessPointUp() const { return apRunning; }
+};
+
+extern WiFiClass WiFi;
+
+#endif // SIM_WIFI_H
@@ -0,0 +1,27 @@
+// Host allocator hooks for AllocCounter. The String stand-in and the rest of
+// the C++ library allocate through operator new, so that is what is counted.
+
+#include <stdlib.h>
+#include <new>
+#include "alloc_counter.h"
+
+void* operator new(size_t size) {
+  AllocCounter::record();
+  void* ptr = malloc(size ? size : 1);
+  if (!ptr) {
+    throw std::bad_alloc();
+  }
+  return ptr;
+}
+
+void* operator new[](size_t size) {
+  return operator new(size);
+}
+
+void operator delete(void* ptr) noexcept {
+  free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept {
+  free(ptr);
+}
@@ -0,0 +1,9 @@
+#ifndef SIM_DRIVER_GPIO_H
+#define SIM_DRIVER_GPIO_H
+
+typedef enum {
+  GPIO_NUM_0 = 0,
+  GPIO_NUM_21 = 21
+} gpio_num_t;
+
+#endif // SIM_DRIVER_GPIO_H
@@ -0,0 +1,79 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "esp_sleep.h"
+
+static esp_sleep_wakeup_cause_t wakeupCause = ESP_SLEEP_WAKEUP_UNDEFINED;
+static void (*deepSleepHook)() = nullptr;
+
+// Bounds of the RTC_DATA_ATTR section, provided by the linker when it exists
+extern uint8_t __start_rtc_data[] __attribute__((weak));
+extern uint8_t __stop_rtc_data[] __attribute__((weak));
+
+uint8_t* simRtcMemory(size_t& size) {
+  size = __start_rtc_data && __stop_rtc_data ? __stop_rtc_data - __start_rtc_data : 0;
+  return __start_rtc_data;
+}
+
+// Ahead of the default-priority static initialisers, which run after this as they would on a wake
+__attribute__((constructor(101))) static void loadRtcMemory() {
+  const char* path = getenv("SIM_RTC_MEMORY");
+  size_t size;
+  uint8_t* memory = simRtcMemory(size);
+  if (!path || size == 0) {
+    return;
+  }
+  FILE* file = fopen(path, "rb");
+  if (!file) {
+    return; // First boot: RTC memory as after power-on
+  }
+  if (fread(memory, 1, size, file) != size || fgetc(file) != EOF) {
+    memset(memory, 0, size);
+    fprintf(stderr, "%s: not RTC memory of this build, ignored\n", path);
+  }
+  fclose(file);
+}
+
+static void saveRtcMemory() {
+  const char* path = getenv("SIM_RTC_MEMORY");
+  size_t size;
+  const uint8_t* memory = simRtcMemory(size);
+  if (!path || size == 0) {
+    return;
+  }
+  FILE* file = fopen(path, "wb");
+  if (!file || fwrite(memory, 1, size, file) != size) {
+    fprintf(stderr, "cannot write RTC memory to %s\n", path);
+  }
+  if (file) {
+    fclose(file);
+  }
+}
+
+esp_sleep_wakeup_cause_t esp_sleep_get_wakeup_cause() {
+  return wakeupCause;
+}
+
+esp_err_t esp_sleep_enable_ext0_wakeup(gpio_num_t, int) {
+  return ESP_OK;
+}
+
+esp_err_t esp_sleep_enable_timer_wakeup(uint64_t) {
+  return ESP_OK;
+}
+
+void esp_deep_sleep_start() {
+  saveRtcMemory();
+  if (deepSleepHook) {
+    deepSleepHook();
+  }
+  exit(0);
+}
+
+void simSetWakeupCause(esp_sleep_wakeup_cause_t cause) {
+  wakeupCause = cause;
+}
+
+void simSetDeepSleepHook(void (*hook)()) {
+  deepSleepHook = hook;
+}
@@ -0,0 +1,40 @@
+#ifndef SIM_ESP_SLEEP_H
+#define SIM_ESP_SLEEP_H
+
+// Deep sleep stand-in. The wakeup cause is whatever the simulator sets;
+// entering deep sleep ends the run through the simulator's hook.
+//
+// RTC memory: with SIM_RTC_MEMORY naming a file in the environment, deep
+// sleep writes the RTC_DATA_ATTR variables to it, and a process started with
+// the same setting loads them back before any static initialiser runs, as the
+// chip keeps RTC memory through a wake that restarts everything else. Linux
+// hosts only; elsewhere RTC memory does not outlive the process.
+
+#include <stdint.h>
+#include <stddef.h>
+#include "driver/gpio.h"
+
+typedef enum {
+  ESP_SLEEP_WAKEUP_UNDEFINED,
+  ESP_SLEEP_WAKEUP_EXT0,
+  ESP_SLEEP_WAKEUP_EXT1,
+  ESP_SLEEP_WAKEUP_TIMER
+} esp_sleep_wakeup_cause_t;
+
+typedef int esp_err_t;
+#define ESP_OK 0
+
+esp_sleep_wakeup_cause_t esp_sleep_get_wakeup_cause();
+esp_err_t esp_sleep_enable_ext0_wakeup(gpio_num_t pin, int level);
+esp_err_t esp_sleep_enable_timer_wakeup(uint64_t us);
+void esp_deep_sleep_start() __attribute__((noreturn));
+
+void simSetWakeupCause(esp_sleep_wakeup_cause_t cause);
+
+// Called by esp_deep_sleep_start before the process exits, after RTC memory is saved
+void simSetDeepSleepHook(void (*hook)());
+
+// The RTC_DATA_ATTR variables as one block; size 0 where the host has no section for them
+uint8_t* simRtcMemory(size_t& size);
+
+#endif // SIM_ESP_SLEEP_H
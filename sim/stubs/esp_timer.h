@@ -0,0 +1,11 @@
+#ifndef SIM_ESP_TIMER_H
+#define SIM_ESP_TIMER_H
+
+#include <Arduino.h>
+
+// Microseconds since boot on the virtual clock
+inline int64_t esp_timer_get_time() {
+  return (int64_t)millis() * 1000;
+}
+
+#endif // SIM_ESP_TIMER_H
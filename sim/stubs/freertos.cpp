@@ -0,0 +1,81 @@
+#include <Arduino.h>
+#include "freertos/task.h"
+
+struct SimTask {
+  uint32_t notification;
+};
+
+static SimTask mainTask = {0};
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t, const char*, uint32_t, void*, UBaseType_t,
+                                   TaskHandle_t* created, BaseType_t) {
+  SimTask* task = new SimTask();
+  task->notification = 0;
+  if (created) {
+    *created = task;
+  }
+  return pdPASS;
+}
+
+void vTaskDelete(TaskHandle_t task) {
+  if (task && task != &mainTask) {
+    delete task;
+  }
+}
+
+static bool mainTaskNotified() {
+  return mainTask.notification != 0;
+}
+
+TaskHandle_t xTaskGetCurrentTaskHandle() {
+  return &mainTask;
+}
+
+BaseType_t xTaskNotify(TaskHandle_t task, uint32_t value, eNotifyAction action) {
+  if (!task) {
+    return pdFAIL;
+  }
+  if (action == eSetBits) {
+    task->notification |= value;
+  } else if (action == eIncrement) {
+    task->notification++;
+  } else if (action != eNoAction) {
+    task->notification = value;
+  }
+  return pdPASS;
+}
+
+BaseType_t xTaskNotifyFromISR(TaskHandle_t task, uint32_t value, eNotifyAction action, BaseType_t* woken) {
+  if (woken) {
+    *woken = pdFALSE;
+  }
+  return xTaskNotify(task, value, action);
+}
+
+BaseType_t xTaskNotifyWait(uint32_t clearOnEntry, uint32_t clearOnExit, uint32_t* value, TickType_t timeout) {
+  mainTask.notification &= ~clearOnEntry;
+  if (mainTask.notification == 0 && timeout != portMAX_DELAY) {
+    simBlock(timeout, mainTaskNotified);
+  }
+  if (mainTask.notification == 0) {
+    return pdFALSE;
+  }
+  if (value) {
+    *value = mainTask.notification;
+  }
+  mainTask.notification &= ~clearOnExit;
+  return pdTRUE;
+}
+
+void xTaskNotifyGive(TaskHandle_t task) {
+  xTaskNotify(task, 0, eIncrement);
+}
+
+uint32_t ulTaskNotifyTake(BaseType_t clearOnExit, TickType_t timeout) {
+  if (mainTask.notification == 0 && timeout != portMAX_DELAY) {
+    simBlock(timeout, mainTaskNotified);
+  }
+  uint32_t value = mainTask.notification;
+  mainTask.notification = clearOnExit ? 0 : (value > 0 ? value - 1 : 0);
+  return value;
+}
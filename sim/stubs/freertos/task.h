@@ -0,0 +1,33 @@
+#ifndef SIM_FREERTOS_TASK_H
+#define SIM_FREERTOS_TASK_H
+
+#include "FreeRTOS.h"
+
+typedef void (*TaskFunction_t)(void*);
+typedef struct SimTask* TaskHandle_t;
+
+enum eNotifyAction {
+  eNoAction,
+  eSetBits,
+  eIncrement,
+  eSetValueWithOverwrite,
+  eSetValueWithoutOverwrite
+};
+
+// Tasks are created but never run: the simulator does their work itself
+// (VictronBLE: it calls processPendingAdvertisements after each packet)
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t code, const char* name, uint32_t stackDepth, void* param,
+                                   UBaseType_t priority, TaskHandle_t* created, BaseType_t core);
+void vTaskDelete(TaskHandle_t task);
+
+// The one thread is the main task. Notifications sent to it are kept until it
+// waits; a wait with nothing pending blocks on the virtual clock (simBlock),
+// so background work can notify it before the timeout.
+TaskHandle_t xTaskGetCurrentTaskHandle();
+BaseType_t xTaskNotify(TaskHandle_t task, uint32_t value, eNotifyAction action);
+BaseType_t xTaskNotifyFromISR(TaskHandle_t task, uint32_t value, eNotifyAction action, BaseType_t* woken);
+BaseType_t xTaskNotifyWait(uint32_t clearOnEntry, uint32_t clearOnExit, uint32_t* value, TickType_t timeout);
+void xTaskNotifyGive(TaskHandle_t task);
+uint32_t ulTaskNotifyTake(BaseType_t clearOnExit, TickType_t timeout);
+
+#endif // SIM_FREERTOS_TASK_H
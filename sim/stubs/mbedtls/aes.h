@@ -0,0 +1,27 @@
+#ifndef SIM_MBEDTLS_AES_H
+#define SIM_MBEDTLS_AES_H
+
+// The slice of the mbedTLS AES API the firmware uses, for host builds: an
+// AES-128 key schedule and CTR mode (encryption and decryption are the same
+// operation). Byte-oriented and unoptimised; fast enough for replaying captures.
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define MBEDTLS_ERR_AES_INVALID_KEY_LENGTH -0x0020
+
+typedef struct mbedtls_aes_context {
+  uint8_t roundKeys[176];
+  int ready;
+} mbedtls_aes_context;
+
+void mbedtls_aes_init(mbedtls_aes_context* ctx);
+void mbedtls_aes_free(mbedtls_aes_context* ctx);
+int mbedtls_aes_setkey_enc(mbedtls_aes_context* ctx, const unsigned char* key, unsigned int keybits);
+int mbedtls_aes_crypt_ecb(mbedtls_aes_context* ctx, int mode, const unsigned char input[16], unsigned char output[16]);
+int mbedtls_aes_crypt_ctr(mbedtls_aes_context* ctx, size_t length, size_t* nc_off, unsigned char nonce_counter[16],
+                          unsigned char stream_block[16], const unsigned char* input, unsigned char* output);
+
+#define MBEDTLS_AES_ENCRYPT 1
+
+#endif // SIM_MBEDTLS_AES_H
@@ -0,0 +1,87 @@
+#include "sim_panel.h"
+#include <Arduino.h>
+#include <string.h>
+
+SimPanel& SimPanel::instance() {
+  static SimPanel panel;
+  return panel;
+}
+
+void SimPanel::reset() {
+  memset(ram, 0xFF, FRAME_BYTES);
+  memset(previousRam, 0xFF, FRAME_BYTES);
+  memset(screen, 0xFF, FRAME_BYTES);
+  bytesWritten = 0;
+  fullRefreshes = 0;
+  partialRefreshes = 0;
+  refreshedPixels = 0;
+  busyMs = 0;
+}
+
+void SimPanel::write(bool again, const uint8_t* bitmap, int16_t x_part, int16_t y_part, int16_t w_bitmap,
+                     int16_t h_bitmap, int16_t x, int16_t y, int16_t w, int16_t h, bool invert) {
+  uint8_t* target = again ? previousRam : ram;
+  int16_t bitmapRowBytes = (w_bitmap + 7) / 8;
+
+  x_part -= x_part % 8;
+  x -= x % 8;
+  w = 8 * ((w + 7) / 8);
+
+  for (int16_t row = 0; row < h; row++) {
+    int16_t srcRow = y_part + row;
+    int16_t dstRow = y + row;
+    if (srcRow >= h_bitmap || dstRow < 0 || dstRow >= HEIGHT) {
+      continue;
+    }
+    for (int16_t col = 0; col < w / 8; col++) {
+      int16_t srcCol = x_part / 8 + col;
+      int16_t dstCol = x / 8 + col;
+      if (srcCol >= bitmapRowBytes || dstCol < 0 || dstCol >= ROW_BYTES) {
+        continue;
+      }
+      uint8_t data = bitmap[srcRow * bitmapRowBytes + srcCol];
+      target[dstRow * ROW_BYTES + dstCol] = invert ? ~data : data;
+      bytesWritten++;
+    }
+  }
+}
+
+void SimPanel::refreshAll() {
+  memcpy(screen, ram, FRAME_BYTES);
+  fullRefreshes++;
+  refreshedPixels += (uint32_t)WIDTH * HEIGHT;
+  waitBusy(fullRefreshMs);
+}
+
+void SimPanel::refreshArea(int16_t x, int16_t y, int16_t w, int16_t h) {
+  int16_t x0 = x < 0 ? 0 : x - x % 8;
+  int16_t x1 = x + w > WIDTH ? WIDTH : x + w;
+  int16_t y0 = y < 0 ? 0 : y;
+  int16_t y1 = y + h > HEIGHT ? HEIGHT : y + h;
+  if (x1 <= x0 || y1 <= y0) {
+    return;
+  }
+
+  for (int16_t row = y0; row < y1; row++) {
+    for (int16_t col = x0 / 8; col < (x1 + 7) / 8; col++) {
+      screen[row * ROW_BYTES + col] = ram[row * ROW_BYTES + col];
+    }
+  }
+  partialRefreshes++;
+  refreshedPixels += (uint32_t)(x1 - x0) * (y1 - y0);
+  waitBusy(partialRefreshMs);
+}
+
+void SimPanel::waitBusy(uint32_t ms) {
+  if (ms > 0) {
+    busyMs += ms;
+    delay(ms);
+  }
+}
+
+bool SimPanel::isBlack(int16_t x, int16_t y) const {
+  // Inverse of the rotation 1 mapping used by GxEPD2 and GFXcanvas1
+  int16_t nativeX = WIDTH - 1 - y;
+  int16_t nativeY = x;
+  return !(screen[nativeY * ROW_BYTES + nativeX / 8] & (0x80 >> (nativeX & 7)));
+}
@@ -0,0 +1,52 @@
+#ifndef SIM_PANEL_H
+#define SIM_PANEL_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+// Model of the E290 panel controller: image RAM written over SPI, the
+// "previous" RAM used for differential updates, and the pixels actually
+// visible after the last refresh. Native layout, 128x296, set bit = white.
+struct SimPanel {
+  static const uint16_t WIDTH = 128;
+  static const uint16_t HEIGHT = 296;
+  static const uint16_t ROW_BYTES = WIDTH / 8;
+  static const size_t FRAME_BYTES = (size_t)ROW_BYTES * HEIGHT;
+
+  uint8_t ram[FRAME_BYTES];
+  uint8_t previousRam[FRAME_BYTES];
+  uint8_t screen[FRAME_BYTES];
+
+  // Traffic and refresh counters since the last reset()
+  uint32_t bytesWritten;
+  uint32_t fullRefreshes;
+  uint32_t partialRefreshes;
+  uint32_t refreshedPixels;   // Area covered by refreshes, not pixels that flipped
+  uint32_t busyMs;            // Virtual time spent waiting for refreshes
+
+  // How long the controller holds BUSY for each kind of refresh. The driver
+  // waits it out with delay(), so it passes on the virtual clock; 0 (the
+  // default) makes refreshes instantaneous.
+  uint32_t fullRefreshMs;
+  uint32_t partialRefreshMs;
+
+  SimPanel() : fullRefreshMs(0), partialRefreshMs(0) { reset(); }
+
+  static SimPanel& instance();
+  void reset();
+
+  // Copy a w x h area of a bitmap (w_bitmap wide, origin x_part/y_part) to
+  // x/y in controller RAM; x is aligned down to a byte as the driver does
+  void write(bool again, const uint8_t* bitmap, int16_t x_part, int16_t y_part, int16_t w_bitmap,
+             int16_t h_bitmap, int16_t x, int16_t y, int16_t w, int16_t h, bool invert);
+  void refreshAll();
+  void refreshArea(int16_t x, int16_t y, int16_t w, int16_t h);
+
+  // Visible pixel in logical rotation 1 coordinates (296x128), true = black
+  bool isBlack(int16_t x, int16_t y) const;
+
+private:
+  void waitBusy(uint32_t ms);
+};
+
+#endif // SIM_PANEL_H
@@ -0,0 +1,174 @@
+// Replays a load trace through the real Display class twice: once with
+// TTG/TTC from the instantaneous current (the previous calculation) and once
+// from TimeEstimator, and counts the panel refreshes each one causes.
+// Exits 1 if the estimator does not save refreshes.
+//
+//   ttg_replay [-v] [trace.csv]
+//
+// The trace uses the sample log CSV columns (seq,boot,time_s,voltage_v,
+// current_a,soc_pct,consumed_ah), so a /log.csv download replays as is; the
+// default is sim/ttg/load_trace.csv, a 10 s trace of a camper load (fridge
+// compressor cycles, water pump, inverter loads, solar under cloud).
+
+#include <Arduino.h>
+#include <vector>
+#include "display.h"
+#include "time_estimator.h"
+#include "config.h"
+#include "sim_panel.h"
+
+#define REPLAY_START_MS 3600000UL   // Virtual clock at the first reading
+
+struct TraceRow {
+  unsigned long timeS;
+  float voltage;
+  float current;
+  float soc;
+  float consumedAh;
+};
+
+struct ReplayResult {
+  uint32_t refreshes;      // Panel refreshes, full and partial
+  uint32_t fullRefreshes;  // Of those, full ones (ghosting budget used up)
+  uint32_t timeChanges;    // Readings whose TTG/TTC moved past the display's change threshold
+  uint32_t validityFlips;  // Time shown / not shown changes
+  float meanConfidence;
+};
+
+// As Display::hasSignificantChange judges the time fields
+static bool timeChanged(uint16_t newMinutes, uint16_t oldMinutes) {
+  int threshold = max(TIME_CHANGE_THRESHOLD, (int)(oldMinutes * TIME_CHANGE_FRACTION));
+  return abs((int)newMinutes - (int)oldMinutes) > threshold;
+}
+
+static bool loadTrace(const char* path, std::vector<TraceRow>& rows) {
+  FILE* f = fopen(path, "r");
+  if (!f) {
+    return false;
+  }
+  char line[160];
+  while (fgets(line, sizeof(line), f)) {
+    TraceRow row;
+    unsigned long seq;
+    unsigned boot;
+    if (sscanf(line, "%lu,%u,%lu,%f,%f,%f,%f", &seq, &boot, &row.timeS, &row.voltage, &row.current,
+               &row.soc, &row.consumedAh) == 7) {
+      rows.push_back(row);
+    }
+  }
+  fclose(f);
+  return !rows.empty();
+}
+
+static ReplayResult replay(const std::vector<TraceRow>& rows, bool smoothed) {
+  ReplayResult result;
+  memset(&result, 0, sizeof(result));
+  
+  SimPanel::instance().reset();
+  simSetMillis(REPLAY_START_MS);
+  Display display;
+  display.begin(false);
+  uint32_t refreshesAtStart = SimPanel::instance().fullRefreshes + SimPanel::instance().partialRefreshes;
+  
+  TimeEstimator estimator;
+  BatteryData previous;
+  uint32_t confidenceSum = 0;
+  
+  for (size_t i = 0; i < rows.size(); i++) {
+    const TraceRow& row = rows[i];
+    unsigned long now = REPLAY_START_MS + (row.timeS - rows[0].timeS) * 1000UL;
+    
+    // Refreshes that come due before this reading, as the main loop would run them
+    unsigned long wait;
+    while (millis() < now && (wait = display.msUntilRefresh(millis())) < now - millis()) {
+      simAdvanceMillis(wait);
+      display.refresh();
+    }
+    simSetMillis(max(now, millis())); // Panel waveforms advance the clock too
+    now = millis();
+    
+    BatteryData data;
+    data.voltage = row.voltage;
+    data.current = row.current;
+    data.power = row.voltage * row.current;
+    data.soc = row.soc;
+    data.consumed_ah = row.consumedAh;
+    data.rssi = -70;
+    data.data_valid = true;
+    data.last_update = now;
+    
+    TimeEstimate estimate;
+    if (smoothed) {
+      estimator.update(row.current, row.soc, BATTERY_CAPACITY_AH, now);
+      estimate = estimator.estimate(BATTERY_CAPACITY_AH);
+    } else {
+      estimate.current = row.current;
+      estimate.remainingAh = row.soc / 100.0f * BATTERY_CAPACITY_AH;
+      estimate.capacityAh = BATTERY_CAPACITY_AH;
+      estimate.confidence = 100;
+      estimate.valid = true;
+    }
+    applyTimeEstimate(data, estimate);
+    confidenceSum += data.time_confidence;
+    
+    if (i > 0) {
+      if (data.time_calculation_valid != previous.time_calculation_valid) {
+        result.validityFlips++;
+      } else if (data.time_calculation_valid &&
+                 (timeChanged(data.calculated_time_remaining_minutes, previous.calculated_time_remaining_minutes) ||
+                  timeChanged(data.calculated_time_to_full_minutes, previous.calculated_time_to_full_minutes))) {
+        result.timeChanges++;
+      }
+    }
+    previous = data;
+    
+    display.updateData(data);
+    if (display.msUntilRefresh(now) == 0) {
+      display.refresh();
+    }
+  }
+  
+  result.refreshes = SimPanel::instance().fullRefreshes + SimPanel::instance().partialRefreshes - refreshesAtStart;
+  RefreshStats stats;
+  display.getRefreshStats(stats);
+  result.fullRefreshes = stats.fullRefreshes;
+  result.meanConfidence = (float)confidenceSum / rows.size();
+  return result;
+}
+
+int main(int argc, char** argv) {
+  const char* path = "sim/ttg/load_trace.csv";
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "-v") == 0) {
+      Serial.enabled = true;
+    } else if (argv[i][0] != '-') {
+      path = argv[i];
+    } else {
+      fprintf(stderr, "usage: %s [-v] [trace.csv]\n", argv[0]);
+      return 2;
+    }
+  }
+  
+  std::vector<TraceRow> rows;
+  if (!loadTrace(path, rows)) {
+    fprintf(stderr, "cannot read %s\n", path);
+    return 2;
+  }
+  float hours = (rows.back().timeS - rows[0].timeS) / 3600.0f;
+  printf("%s: %u readings over %.1f h\n", path, (unsigned)rows.size(), hours);
+  
+  ReplayResult instant = replay(rows, false);
+  ReplayResult smooth = replay(rows, true);
+  
+  printf("%-14s %10s %6s %12s %14s %11s\n", "TTG/TTC from", "refreshes", "full", "time jumps", "shown/hidden",
+         "confidence");
+  printf("%-14s %10u %6u %12u %14u %10.0f%%\n", "instantaneous", instant.refreshes, instant.fullRefreshes,
+         instant.timeChanges, instant.validityFlips, instant.meanConfidence);
+  printf("%-14s %10u %6u %12u %14u %10.0f%%\n", "estimator", smooth.refreshes, smooth.fullRefreshes,
+         smooth.timeChanges, smooth.validityFlips, smooth.meanConfidence);
+  
+  int saved = (int)instant.refreshes - (int)smooth.refreshes;
+  printf("saved %d refreshes (%.0f%%), %.1f per hour\n", saved,
+         instant.refreshes ? 100.0f * saved / instant.refreshes : 0.0f, saved / hours);
+  return saved > 0 ? 0 : 1;
+}
@@ -0,0 +1,297 @@
+// Checks that what sampling mode keeps in RTC memory survives a deep-sleep
+// wake. The stubs gather the RTC_DATA_ATTR variables in one section; deep
+// sleep writes it to a file, and the next process loads it back before any
+// static initialiser runs (esp_sleep.h), as the chip keeps RTC memory while
+// everything else starts over. A static initialiser that touches retained
+// state, such as a constructor in a retained struct, shows up as changed
+// bytes and as a time estimate that starts again from nothing.
+//
+//   wake_check [-v] [-f file]
+//
+//   -v  print the firmware's serial output
+//   -f  file standing in for RTC memory (default sim_rtc.bin)
+//
+// The first run decodes WARMUP_S of a synthetic SmartShunt, enters sampling
+// mode and sleeps. Deep sleep starts the program again as the timer wakeup,
+// which checks what it finds in RTC memory and takes a sample through
+// SamplingMode::runCycle(). The wakes, one process each:
+//
+//   1      the SmartShunt is heard: a full sample, drawn on the panel, with
+//          the estimate carried on
+//   2..    it has gone quiet: each sample is missed, and the panel is left
+//          alone until SAMPLE_MAX_MISSES in a row put up NO DATA
+//   last   a firmware update changed RetainedState: a wrong size or magic
+//          is not taken for a sample wakeup
+//
+// Exits 1 if anything did not survive or went otherwise. Linux hosts only.
+
+#include <Arduino.h>
+#include <unistd.h>
+#include <vector>
+#include "capture_source.h"
+
+// Built into this program rather than linked from src/, so the checks can
+// read the retained state itself
+#include "sampling_mode.cpp"
+
+#define WARMUP_S 1200             // Decoded before sampling mode is entered
+#define FIRST_ADV_MS 5000         // Virtual clock at the first packet of the first run
+#define WAKE_FIRST_ADV_MS 400     // Virtual clock at the first packet after the wake
+#define UPDATE_WAKE (SAMPLE_MAX_MISSES + 2) // Wakes to the state of the firmware before
+#define DEFAULT_RTC_FILE "sim_rtc.bin"
+
+static std::vector<CapturedAdvertisement> advs;
+static size_t nextAdv = 0;
+static long advOffsetMs = 0;      // Virtual clock minus capture time
+static const char* rtcPath = DEFAULT_RTC_FILE;
+static bool verbose = false;
+static int failures = 0;
+
+// Confidence of the time estimate when the first run went to sleep
+static unsigned sleepConfidence = 0;
+
+// This process's wake, counting from 1, and the capture time it woke at
+static unsigned wake = 0;
+static unsigned long wakeCaptureMs = 0;
+
+// What the panel showed before a sample, to tell a missed one left it alone
+static Display::Snapshot panelBefore;
+
+static void check(bool ok, const char* what) {
+  printf("%-44s %s\n", what, ok ? "ok" : "FAILED");
+  if (!ok) {
+    failures++;
+  }
+}
+
+static unsigned long advTime(size_t i) {
+  return advs[i].header.timeMs + advOffsetMs;
+}
+
+// The scan callback and the decode task, back to back
+static void deliverAdvertisement(VictronBLE* ble, const CapturedAdvertisement& adv) {
+  std::string data("\xE1\x02", 2);
+  data.append((const char*)adv.payload, adv.length);
+  NimBLEAdvertisedDevice device(adv.header.mac, data, adv.header.rssi);
+  ble->handleAdvertisement(&device);
+  ble->processPendingAdvertisements();
+}
+
+// After the wake the scanner is runCycle()'s own; the raw scan's argument is
+// that VictronBLE, whose decode task does not run here
+static void runBackground(unsigned long untilMs) {
+  while (nextAdv < advs.size() && advTime(nextAdv) <= untilMs) {
+    simSetMillis(max(millis(), advTime(nextAdv)));
+    VictronBLE* ble = static_cast<VictronBLE*>(simGapScan().arg);
+    if (ble) {
+      deliverAdvertisement(ble, advs[nextAdv]);
+    }
+    nextAdv++;
+  }
+  if (untilMs > millis()) {
+    simSetMillis(untilMs);
+  }
+}
+
+static unsigned retainedConfidence() {
+  return retained.decoders[0].timeEstimator.estimate(BATTERY_CAPACITY_AH).confidence;
+}
+
+// The timer wakeup: this program again, with the same RTC memory file
+static void startWakeup(unsigned next, unsigned confidence, unsigned long captureMs) {
+  if (failures > 0) {
+    exit(1);
+  }
+  char nextText[8];
+  char confidenceText[8];
+  char captureText[16];
+  snprintf(nextText, sizeof(nextText), "%u", next);
+  snprintf(confidenceText, sizeof(confidenceText), "%u", confidence);
+  snprintf(captureText, sizeof(captureText), "%lu", captureMs);
+  fflush(stdout);
+  const char* args[] = {"wake_check", "--woken", nextText, confidenceText, captureText,
+                        verbose ? "-v" : nullptr, nullptr};
+  execv("/proc/self/exe", (char* const*)args);
+  perror("cannot start the wakeup");
+  exit(1);
+}
+
+static bool panelRefreshed() {
+  const SimPanel& panel = SimPanel::instance();
+  return panel.fullRefreshes + panel.partialRefreshes > 0;
+}
+
+// ---- First run: decode, enter sampling mode ----
+
+static void wakeUp() {
+  printf("sleep: estimate confidence %u%% after %u s of readings\n", sleepConfidence, WARMUP_S);
+  check(retained.decoders[0].timeEstimator.isStarted(), "estimator retained at sleep");
+  startWakeup(1, sleepConfidence, (unsigned long)(WARMUP_S + SAMPLE_INTERVAL_S) * 1000UL);
+}
+
+static int firstRun(const DeviceKey& key) {
+  unlink(rtcPath);
+  synthesizeCapture(key, WARMUP_S, advs);
+  advOffsetMs = FIRST_ADV_MS;
+
+  ConfigServer* config = new ConfigServer();
+  config->begin();
+  DeviceConfig device;
+  memset(&device, 0, sizeof(device));
+  strcpy(device.mac_address, key.mac);
+  strcpy(device.encryption_key, key.key);
+  config->saveConfig(&device, 1);
+
+  VictronBLE* ble = new VictronBLE();
+  ble->addDevice(key.mac, key.key);
+  if (!ble->begin()) {
+    fprintf(stderr, "BLE did not start\n");
+    return 1;
+  }
+  ble->startScanning();
+  for (; nextAdv < advs.size(); nextAdv++) {
+    simSetMillis(advTime(nextAdv));
+    deliverAdvertisement(ble, advs[nextAdv]);
+  }
+  sleepConfidence = ble->getDeviceData(0).time_confidence;
+
+  simSetDeepSleepHook(wakeUp);
+  SamplingMode::enter(ble, nullptr, config);
+  return 1; // enter() does not return
+}
+
+// ---- The timer wakeups ----
+
+static void sampleTaken() {
+  unsigned confidence = retainedConfidence();
+  printf("sample %u: estimate confidence %u%%\n", retained.cycles, confidence);
+  check(retained.cycles == 1 && retained.misses == 0, "sample taken");
+  check(retained.decoders[0].latest.data_valid, "reading retained after the sample");
+  // A restarted estimate has confidence 0 after its first reading
+  check(retained.decoders[0].timeEstimator.isStarted() && confidence > 0, "estimate carried on through the sample");
+  check(panelRefreshed() && retained.panel.valid, "sample drawn on the panel");
+  startWakeup(wake + 1, confidence, wakeCaptureMs + SAMPLE_INTERVAL_S * 1000UL);
+}
+
+static void sampleMissed() {
+  const SimPanel& panel = SimPanel::instance();
+  printf("sample %u: missed, %u in a row, %u bytes to the panel\n", retained.cycles, retained.misses,
+         panel.bytesWritten);
+  check(retained.cycles == wake && retained.misses == wake - 1, "sample missed");
+  check(retained.decoders[0].latest.data_valid, "reading retained after the miss");
+  if (retained.misses < SAMPLE_MAX_MISSES) {
+    check(panel.bytesWritten == 0 && !panelRefreshed() &&
+          memcmp(&retained.panel, &panelBefore, sizeof(panelBefore)) == 0,
+          "panel left alone");
+  } else {
+    // The NO DATA screen cannot be redrawn from field text, so it is not kept
+    check(panelRefreshed() && !retained.panel.valid, "NO DATA after SAMPLE_MAX_MISSES");
+  }
+  startWakeup(wake + 1, retainedConfidence(), wakeCaptureMs + SAMPLE_INTERVAL_S * 1000UL);
+}
+
+// The new firmware finds the old one's RTC memory
+static int firmwareUpdated() {
+  uint32_t magic = retained.magic;
+  uint16_t size = retained.size;
+  retained.size = size + 4;
+  check(!SamplingMode::isSampleWakeup(), "RetainedState of another size ignored");
+  retained.size = size;
+  retained.magic = ~magic;
+  check(!SamplingMode::isSampleWakeup(), "RetainedState with another magic ignored");
+  retained.magic = magic;
+  return failures > 0 ? 1 : 0;
+}
+
+static bool rtcMatchesFile() {
+  size_t size;
+  const uint8_t* memory = simRtcMemory(size);
+  std::vector<uint8_t> saved(size);
+  FILE* file = fopen(rtcPath, "rb");
+  bool read = file && fread(saved.data(), 1, size, file) == size;
+  if (file) {
+    fclose(file);
+  }
+  if (!read) {
+    printf("cannot read %s\n", rtcPath);
+    return false;
+  }
+  size_t changed = 0;
+  for (size_t i = 0; i < size; i++) {
+    changed += memory[i] != saved[i];
+  }
+  printf("wake: %zu of %zu bytes of RTC memory changed by start-up\n", changed, size);
+  return changed == 0;
+}
+
+static int woken(const DeviceKey& key, unsigned expectedConfidence, unsigned long captureMs) {
+  simSetWakeupCause(ESP_SLEEP_WAKEUP_TIMER);
+  check(rtcMatchesFile(), "RTC memory untouched by static initialisers");
+  check(SamplingMode::isSampleWakeup(), "sample wakeup recognised");
+  check(retained.decoders[0].latest.data_valid, "reading retained");
+  check(retained.decoders[0].timeEstimator.isStarted() && retainedConfidence() == expectedConfidence,
+        "estimator retained");
+  if (failures > 0) {
+    return 1;
+  }
+  if (wake == UPDATE_WAKE) {
+    return firmwareUpdated();
+  }
+
+  if (wake == 1) {
+    // The SmartShunt carried on while the gauge slept
+    synthesizeCapture(key, captureMs / 1000 + 60, advs);
+    while (nextAdv < advs.size() && advs[nextAdv].header.timeMs < captureMs) {
+      nextAdv++;
+    }
+    simSetDeepSleepHook(sampleTaken);
+  } else {
+    // Then it went quiet
+    memcpy(&panelBefore, &retained.panel, sizeof(panelBefore));
+    simSetDeepSleepHook(sampleMissed);
+  }
+  advOffsetMs = WAKE_FIRST_ADV_MS - (long)captureMs;
+  wakeCaptureMs = captureMs;
+  simSetBackgroundHook(runBackground);
+  SamplingMode::runCycle();
+  return 1; // runCycle() does not return
+}
+
+int main(int argc, char** argv) {
+  unsigned expectedConfidence = 0;
+  unsigned long captureMs = 0;
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "-v") == 0) {
+      verbose = true;
+    } else if (strcmp(argv[i], "-f") == 0 && i + 1 < argc) {
+      rtcPath = argv[++i];
+    } else if (strcmp(argv[i], "--woken") == 0 && i + 3 < argc) {
+      wake = strtoul(argv[++i], nullptr, 10);
+      expectedConfidence = strtoul(argv[++i], nullptr, 10);
+      captureMs = strtoul(argv[++i], nullptr, 10);
+    } else {
+      fprintf(stderr, "usage: %s [-v] [-f file]\n", argv[0]);
+      return 2;
+    }
+  }
+  Serial.enabled = verbose;
+
+  size_t rtcSize;
+  simRtcMemory(rtcSize);
+  if (rtcSize == 0) {
+    fprintf(stderr, "RTC memory cannot be kept across processes on this host\n");
+    return 1;
+  }
+
+  // The wakeup finds the file through the environment it inherits
+  if (wake > 0) {
+    rtcPath = getenv("SIM_RTC_MEMORY") ? getenv("SIM_RTC_MEMORY") : rtcPath;
+  } else {
+    setenv("SIM_RTC_MEMORY", rtcPath, 1);
+  }
+
+  DeviceKey key;
+  strcpy(key.mac, INSTANT_READOUT_MAC_ADDRESS);
+  strcpy(key.key, INSTANT_READOUT_ENCRYPTION_KEY);
+  return wake > 0 ? woken(key, expectedConfidence, captureMs) : firstRun(key);
+}
@@ -0,0 +1,122 @@
+#include "adv_capture.h"
+
+#if ADV_CAPTURE
+
+#include "capture_format.h"
+#include "device_table.h"
+
+#if ADV_CAPTURE == ADV_CAPTURE_FLASH
+#include <LittleFS.h>
+#endif
+
+static_assert(ADV_PAYLOAD_MAX <= CAPTURE_PAYLOAD_MAX, "capture frames cannot hold a full advertisement");
+
+static bool ready = false;
+static uint32_t frameCount = 0;
+static uint32_t byteCount = 0;
+static uint32_t droppedCount = 0;
+
+#if ADV_CAPTURE == ADV_CAPTURE_FLASH
+// Frames collected between flash writes
+static uint8_t buffer[CAPTURE_BUFFER_BYTES];
+static size_t buffered = 0;
+static unsigned long lastWrite = 0;
+
+static void writeBuffer() {
+  if (buffered == 0) {
+    return;
+  }
+  File file = LittleFS.open(CAPTURE_FILE, FILE_APPEND);
+  if (file && file.write(buffer, buffered) == buffered) {
+    byteCount += buffered;
+  } else {
+    droppedCount++;
+  }
+  buffered = 0;
+  lastWrite = millis();
+}
+#endif
+
+bool AdvCapture::begin() {
+#if ADV_CAPTURE == ADV_CAPTURE_FLASH
+  if (!LittleFS.begin(true)) {
+    Serial.println("Capture: LittleFS mount failed");
+    return false;
+  }
+  LittleFS.remove(CAPTURE_FILE);
+  buffered = 0;
+  lastWrite = millis();
+  Serial.printf("Capture: recording to %s\n", CAPTURE_FILE);
+#else
+  Serial.println("Capture: recording to serial");
+#endif
+  frameCount = 0;
+  byteCount = 0;
+  droppedCount = 0;
+  ready = true;
+  return true;
+}
+
+void AdvCapture::record(uint64_t mac, const uint8_t* payload, size_t length, int8_t rssi, unsigned long timestamp) {
+  if (!ready) {
+    return;
+  }
+  
+  CaptureHeader header;
+  header.timeMs = timestamp;
+  for (int b = 0; b < 6; b++) {
+    header.mac[b] = (mac >> (8 * b)) & 0xFF;
+  }
+  header.rssi = rssi;
+  
+  uint8_t frame[CAPTURE_FRAME_MAX];
+  size_t frameLen = captureEncodeFrame(header, payload, length, frame);
+  if (frameLen == 0) {
+    return;
+  }
+  
+#if ADV_CAPTURE == ADV_CAPTURE_FLASH
+  if (byteCount + buffered + frameLen > CAPTURE_MAX_BYTES) {
+    droppedCount++;
+    return;
+  }
+  if (buffered + frameLen > sizeof(buffer)) {
+    writeBuffer();
+  }
+  memcpy(buffer + buffered, frame, frameLen);
+  buffered += frameLen;
+  
+  // Packets arrive every second or so; a quiet spell still reaches flash soon
+  if (millis() - lastWrite >= CAPTURE_FLUSH_INTERVAL_MS) {
+    writeBuffer();
+  }
+#else
+  // One line, written in one call so other output cannot land inside it
+  static const char hex[] = "0123456789abcdef";
+  char line[sizeof(CAPTURE_LINE_PREFIX) + 2 * CAPTURE_FRAME_MAX + 1];
+  size_t used = sizeof(CAPTURE_LINE_PREFIX) - 1;
+  memcpy(line, CAPTURE_LINE_PREFIX, used);
+  for (size_t i = 0; i < frameLen; i++) {
+    line[used++] = hex[frame[i] >> 4];
+    line[used++] = hex[frame[i] & 0x0F];
+  }
+  line[used++] = '\n';
+  Serial.write((const uint8_t*)line, used);
+  byteCount += frameLen;
+#endif
+  frameCount++;
+}
+
+uint32_t AdvCapture::getFrameCount() {
+  return frameCount;
+}
+
+uint32_t AdvCapture::getByteCount() {
+  return byteCount;
+}
+
+uint32_t AdvCapture::getDroppedCount() {
+  return droppedCount;
+}
+
+#endif // ADV_CAPTURE
@@ -0,0 +1,34 @@
+#ifndef ADV_CAPTURE_H
+#define ADV_CAPTURE_H
+
+#include <Arduino.h>
+#include "config.h"
+
+#if ADV_CAPTURE
+// Records every advertisement from a configured device, still encrypted and
+// duplicates included, for replay on a host (sim/replay). Frames follow
+// capture_format.h. On serial each frame is printed as one hex line among
+// the log output; on flash they are appended to CAPTURE_FILE, a new capture
+// each boot, until it reaches CAPTURE_MAX_BYTES.
+//
+// Recording happens on the decode task only, which also does the flash writes.
+namespace AdvCapture {
+  bool begin();
+  void record(uint64_t mac, const uint8_t* payload, size_t length, int8_t rssi, unsigned long timestamp);
+
+  // Statistics since begin()
+  uint32_t getFrameCount();
+  uint32_t getByteCount();
+  uint32_t getDroppedCount(); // Flash full or write failed
+}
+#else
+namespace AdvCapture {
+  inline bool begin() { return false; }
+  inline void record(uint64_t, const uint8_t*, size_t, int8_t, unsigned long) {}
+  inline uint32_t getFrameCount() { return 0; }
+  inline uint32_t getByteCount() { return 0; }
+  inline uint32_t getDroppedCount() { return 0; }
+}
+#endif
+
+#endif // ADV_CAPTURE_H
@@ -0,0 +1,62 @@
+#include "alloc_counter.h"
+#include <stddef.h>
+
+#ifdef ARDUINO_ARCH_ESP32
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+
+static TaskHandle_t countingTask = nullptr;
+#endif
+
+static volatile bool counting = false;
+static volatile uint32_t allocations = 0;
+
+void AllocCounter::begin() {
+#ifdef ARDUINO_ARCH_ESP32
+  countingTask = xTaskGetCurrentTaskHandle();
+#endif
+  allocations = 0;
+  counting = true;
+}
+
+uint32_t AllocCounter::end() {
+  counting = false;
+  return allocations;
+}
+
+void AllocCounter::record() {
+  if (!counting) {
+    return;
+  }
+#ifdef ARDUINO_ARCH_ESP32
+  // Other tasks (BLE host, decode) allocate concurrently; only count our own
+  if (xTaskGetCurrentTaskHandle() != countingTask) {
+    return;
+  }
+#endif
+  allocations++;
+}
+
+#ifdef ARDUINO_ARCH_ESP32
+// Link-time wrappers; String, operator new and the IDF all allocate through these
+extern "C" {
+void* __real_malloc(size_t size);
+void* __real_calloc(size_t count, size_t size);
+void* __real_realloc(void* ptr, size_t size);
+
+void* __wrap_malloc(size_t size) {
+  AllocCounter::record();
+  return __real_malloc(size);
+}
+
+void* __wrap_calloc(size_t count, size_t size) {
+  AllocCounter::record();
+  return __real_calloc(count, size);
+}
+
+void* __wrap_realloc(void* ptr, size_t size) {
+  AllocCounter::record();
+  return __real_realloc(ptr, size);
+}
+}
+#endif
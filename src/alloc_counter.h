@@ -0,0 +1,17 @@
+#ifndef ALLOC_COUNTER_H
+#define ALLOC_COUNTER_H
+
+#include <stdint.h>
+
+// Counts heap allocations made by the calling task between begin() and
+// end(). On the device malloc/calloc/realloc are wrapped at link time
+// (-Wl,--wrap in platformio.ini); host builds hook operator new instead.
+namespace AllocCounter {
+  void begin();
+  uint32_t end();
+
+  // Called by the allocator hooks
+  void record();
+}
+
+#endif // ALLOC_COUNTER_H
@@ -0,0 +1,45 @@
+#include "boot_profiler.h"
+
+static const char* const phaseNames[BOOT_PHASE_COUNT] = {
+  "serial", "config", "display", "ble", "first adv", "first sample", "first render"
+};
+
+// Microseconds since start-up; 0 = not reached yet
+static volatile uint32_t phaseMicros[BOOT_PHASE_COUNT];
+static bool reported = false;
+
+void BootProfiler::mark(BootPhase phase) {
+  if (phaseMicros[phase] == 0) {
+    uint32_t now = micros();
+    phaseMicros[phase] = now ? now : 1;
+  }
+}
+
+bool BootProfiler::isMarked(BootPhase phase) {
+  return phaseMicros[phase] != 0;
+}
+
+void BootProfiler::report() {
+  if (reported) {
+    return;
+  }
+  reported = true;
+  
+  // Phases may complete out of order (display init overlaps scanning), so
+  // each line shows the time since start-up and the gap to the previous line
+  uint32_t previous = 0;
+  Serial.println("Boot profile (ms since start-up):");
+  for (int i = 0; i < BOOT_PHASE_COUNT; i++) {
+    uint32_t at = phaseMicros[i];
+    if (at == 0) {
+      Serial.printf("  %-12s -\n", phaseNames[i]);
+      continue;
+    }
+    Serial.printf("  %-12s %7.1f  %+7.1f\n", phaseNames[i], at / 1000.0f, ((int32_t)(at - previous)) / 1000.0f);
+    previous = at;
+  }
+  
+  if (phaseMicros[BOOT_FIRST_RENDER] != 0) {
+    Serial.printf("Boot: time to first data %lu ms\n", (unsigned long)(phaseMicros[BOOT_FIRST_RENDER] / 1000));
+  }
+}
@@ -0,0 +1,28 @@
+#ifndef BOOT_PROFILER_H
+#define BOOT_PROFILER_H
+
+#include <Arduino.h>
+
+// Milestones from power-on to the first reading on screen, in boot order
+enum BootPhase {
+  BOOT_SERIAL,         // Serial console up
+  BOOT_CONFIG,         // Device config loaded from NVS
+  BOOT_DISPLAY,        // Panel initialised
+  BOOT_BLE,            // Stack up and scanning
+  BOOT_FIRST_ADV,      // First advertisement from a configured device
+  BOOT_FIRST_SAMPLE,   // First packet decrypted and parsed
+  BOOT_FIRST_RENDER,   // First data screen on the panel
+  BOOT_PHASE_COUNT
+};
+
+// Records when each boot phase first completes. Marks may come from any
+// task; only the first mark of a phase counts, later ones are ignored.
+namespace BootProfiler {
+  void mark(BootPhase phase);
+  bool isMarked(BootPhase phase);
+
+  // Print the phase timeline once; time to first data is the headline
+  void report();
+}
+
+#endif // BOOT_PROFILER_H
@@ -0,0 +1,136 @@
+#ifndef CAPTURE_FORMAT_H
+#define CAPTURE_FORMAT_H
+
+// Advertisement capture format, shared by the firmware and the replay tool
+// (sim/replay). No Arduino dependencies.
+//
+// A capture is a sequence of frames, each
+//   sync (0xC5) | length (body bytes) | body | CRC-32 of length + body
+// with the body a little-endian CaptureHeader followed by the manufacturer
+// data after the company ID, still encrypted. Framing and resync work as in
+// the sample log; on serial each frame is one "CAP " line of hex.
+
+#include "log_format.h"
+
+#define CAPTURE_FRAME_SYNC 0xC5
+#define CAPTURE_PAYLOAD_MAX 29     // Legacy advertising; matches ADV_PAYLOAD_MAX
+#define CAPTURE_LINE_PREFIX "CAP "
+
+struct __attribute__((packed)) CaptureHeader {
+  uint32_t timeMs;           // millis() when the scan callback saw the packet
+  uint8_t mac[6];            // Controller byte order, least significant first
+  int8_t rssi;
+};
+
+static_assert(sizeof(CaptureHeader) == 11, "capture header layout changed");
+
+#define CAPTURE_BODY_MIN (sizeof(CaptureHeader) + 1)
+#define CAPTURE_BODY_MAX (sizeof(CaptureHeader) + CAPTURE_PAYLOAD_MAX)
+#define CAPTURE_FRAME_MAX (2 + CAPTURE_BODY_MAX + 4)
+
+// Writes one frame into out (CAPTURE_FRAME_MAX) and returns its length, 0 if
+// the payload is empty or too long
+inline size_t captureEncodeFrame(const CaptureHeader& header, const uint8_t* payload, size_t payloadLen,
+                                 uint8_t* out) {
+  if (payloadLen == 0 || payloadLen > CAPTURE_PAYLOAD_MAX) {
+    return 0;
+  }
+  size_t bodyLen = sizeof(CaptureHeader) + payloadLen;
+  out[0] = CAPTURE_FRAME_SYNC;
+  out[1] = bodyLen;
+  memcpy(out + 2, &header, sizeof(CaptureHeader));
+  memcpy(out + 2 + sizeof(CaptureHeader), payload, payloadLen);
+  uint32_t crc = logCrc32(out + 1, 1 + bodyLen);
+  memcpy(out + 2 + bodyLen, &crc, 4);
+  return 2 + bodyLen + 4;
+}
+
+// One captured advertisement
+struct CapturedAdvertisement {
+  CaptureHeader header;
+  uint8_t payload[CAPTURE_PAYLOAD_MAX];
+  uint8_t length;
+};
+
+// Incremental frame decoder: feed bytes as they are read, in any chunk size
+class CaptureFrameParser {
+private:
+  uint8_t frame[CAPTURE_FRAME_MAX];
+  size_t have;
+  uint32_t skippedBytes;
+
+  static bool validLength(uint8_t length) {
+    return length >= CAPTURE_BODY_MIN && length <= CAPTURE_BODY_MAX;
+  }
+
+public:
+  CaptureFrameParser() : have(0), skippedBytes(0) {}
+
+  // Consumes input up to the end of the next good frame and returns the bytes
+  // used; complete is set when adv holds that frame. Call again with no input
+  // at the end of the stream to drain frames left behind by a resync.
+  size_t feed(const uint8_t* data, size_t length, CapturedAdvertisement& adv, bool& complete) {
+    size_t used = 0;
+    complete = extract(adv);
+    while (used < length && !complete) {
+      frame[have++] = data[used++];
+      complete = extract(adv);
+    }
+    return used;
+  }
+
+  uint32_t getSkippedBytes() const { return skippedBytes; }
+
+private:
+  // Takes the frame at the start of the buffer if it is complete and good. A
+  // resync can leave a whole frame behind, so keep checking until more input
+  // is needed.
+  bool extract(CapturedAdvertisement& adv) {
+    while (have > 0) {
+      if (frame[0] != CAPTURE_FRAME_SYNC) {
+        have = 0;
+        skippedBytes++;
+        return false;
+      }
+      if (have < 2) {
+        return false;
+      }
+      if (!validLength(frame[1])) {
+        resync();
+        continue;
+      }
+      size_t bodyLen = frame[1];
+      size_t frameLen = 2 + bodyLen + 4;
+      if (have < frameLen) {
+        return false;
+      }
+
+      uint32_t crc;
+      memcpy(&crc, frame + 2 + bodyLen, 4);
+      if (crc != logCrc32(frame + 1, 1 + bodyLen)) {
+        resync();
+        continue;
+      }
+      memcpy(&adv.header, frame + 2, sizeof(CaptureHeader));
+      adv.length = bodyLen - sizeof(CaptureHeader);
+      memcpy(adv.payload, frame + 2 + sizeof(CaptureHeader), adv.length);
+      have -= frameLen;
+      memmove(frame, frame + frameLen, have);
+      return true;
+    }
+    return false;
+  }
+
+  // Drop the first byte of a bad frame and rescan the rest for a sync byte
+  void resync() {
+    size_t start = 1;
+    while (start < have && frame[start] != CAPTURE_FRAME_SYNC) {
+      start++;
+    }
+    skippedBytes += start;
+    have -= start;
+    memmove(frame, frame + start, have);
+  }
+};
+
+#endif // CAPTURE_FORMAT_H
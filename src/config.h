@@ -10,15 +10,40 @@
 #define INSTANT_READOUT_ENCRYPTION_KEY "64cd146fe6771ef40610ecf50f3bb06a"
 #define INSTANT_READOUT_MAC_ADDRESS "d6ec4c9e6307"
 
+// Multi-device monitoring
+#define MAX_VICTRON_DEVICES 4            // SmartShunts monitored at once
+#define DATA_STALE_TIMEOUT 60000         // Reading considered lost after 1 minute
+
+// BLE scanning
+#define BLE_SCAN_INTERVAL_MS 100
+#define BLE_SCAN_WINDOW_MS 50
+#define VICTRON_RAW_SCAN 1               // 1 = raw GAP handler + controller whitelist, 0 = NimBLEScan callbacks
+
+// BLE decode pipeline
+#define ADV_RING_SIZE 16                 // Raw advertisements buffered for the decode task (power of two)
+#define DECODE_TASK_STACK_SIZE 4096
+#define DECODE_TASK_PRIORITY 2
+#define DECODE_TASK_CORE 1
+
 // WiFi Configuration Server
 #define CONFIG_AP_SSID "BTLE-Power-Gauge"
 #define CONFIG_AP_PASSWORD "configure123"
 #define CONFIG_SERVER_PORT 80
 #define CONFIG_TIMEOUT_MS 300000  // 5 minutes
 
+// Live data API (/api/live event stream, /api/snapshot)
+#ifndef LIVE_API_ALWAYS_ON
+#define LIVE_API_ALWAYS_ON 0             // 1 = access point and web server stay up outside config mode
+#endif
+#define LIVE_MAX_CLIENTS 2               // Event streams served at once
+#define LIVE_EVENT_MAX 384               // One serialized event or snapshot device entry
+#define LIVE_KEEPALIVE_MS 15000          // Comment line sent to idle streams
+
 // Battery configuration
 #define BATTERY_CAPACITY_AH 100.0f
 #define MIN_CURRENT_THRESHOLD 0.1f
+#define TTG_SMOOTHING_S 1800.0f          // Time constant of the current average behind TTG/TTC
+#define TTG_RESET_GAP_MS 600000          // Readings further apart restart the average
 
 // Display update thresholds
 #define VOLTAGE_CHANGE_THRESHOLD 0.1f    // Volts
@@ -26,10 +51,119 @@
 #define SOC_CHANGE_THRESHOLD 1.0f        // Percent
 #define POWER_CHANGE_THRESHOLD 10.0f     // Watts
 #define TIME_CHANGE_THRESHOLD 5          // Minutes
+#define TIME_CHANGE_FRACTION 0.05f       // Or this share of the time shown, whichever is larger
 #define CONSUMED_AH_THRESHOLD 0.5f       // Amp-hours
 
 // Display refresh timing
 #define PERIODIC_REFRESH_INTERVAL 300000   // 5 minutes
-#define FULL_REFRESH_INTERVAL 600000       // 10 minutes
+#define DISPLAY_MIN_REFRESH_INTERVAL 3000  // Minimum spacing between display refreshes
+#define REFRESH_COALESCE_MS 2000           // Changes this close together share one refresh
+#define GHOST_MAX_PARTIAL_REFRESHES 50     // Partial refreshes before a full one clears ghosting
+#define GHOST_MAX_FLIPPED_PIXELS (4UL * 128 * 296) // Or pixels flipped by them, four screens' worth
+#define MAX_DIRTY_RECTS 8                  // Changed areas sent per partial refresh before merging
+
+// History
+#define HISTORY_INTERVAL_MS 60000          // One sample per minute
+#define HISTORY_BYTES 32768                // Sample ring; about four days at one sample per minute
+#define HISTORY_BLOCK_BYTES 256            // Delta-coded bytes after each keyframe
+#define HISTORY_GRAPH_COLUMNS 224          // Sparkline width in pixels
+#define HISTORY_COLUMN_SAMPLES 6           // Samples per sparkline column (224 x 6 min = 22 h)
+
+// Sample log (LittleFS data partition)
+#define LOG_INTERVAL_MS 60000              // One record per minute while data is fresh
+#define LOG_BATCH_RECORDS 32               // Records per flash write; held in RTC memory until then
+#define LOG_FLUSH_INTERVAL_MS 900000       // Write a partial batch after 15 minutes
+#define LOG_SEGMENT_BYTES 65536            // Segment file size
+#ifndef LOG_MAX_BYTES
+#define LOG_MAX_BYTES (2UL * 1024 * 1024)  // Oldest segments are deleted beyond this
+#endif
+#define LOG_EXPORT_CHUNK_BYTES 1460        // Export response chunk, one TCP segment
+
+// Advertisement capture for host replay (sim/replay)
+#define ADV_CAPTURE_OFF 0
+#define ADV_CAPTURE_SERIAL 1               // "CAP" hex lines among the serial output
+#define ADV_CAPTURE_FLASH 2                // CAPTURE_FILE on the LittleFS partition
+#ifndef ADV_CAPTURE
+#define ADV_CAPTURE ADV_CAPTURE_OFF
+#endif
+#define CAPTURE_FILE "/capture.bin"
+#define CAPTURE_MAX_BYTES (1024UL * 1024)  // Flash capture stops here, about 28000 advertisements
+#define CAPTURE_BUFFER_BYTES 1024          // Frames collected before a flash write
+#define CAPTURE_FLUSH_INTERVAL_MS 10000    // Or after this long
+
+// Main loop scheduling
+#define CONFIG_POLL_INTERVAL 100           // Web server polling while in config mode
+#define NO_CONFIG_REMINDER_INTERVAL 10000  // "No Configuration" screen repeat
+#define DOUBLE_PRESS_TIMEOUT 2000          // Wait for a second press before acting on one
+
+// Boot
+#ifndef FAST_BOOT
+#define FAST_BOOT 1                        // 1 = no serial wait or splash screens; BLE scans while the panel initialises
+#endif
+#define FIRST_SAMPLE_WAIT_MS 5000          // Without a splash screen, wait this long for data before showing NO DATA
+
+// Power management
+#ifndef POWER_MANAGEMENT
+#define POWER_MANAGEMENT 1                 // 1 = frequency scaling + automatic light sleep between events
+#endif
+#define POWER_MAX_CPU_FREQ_MHZ 240
+#define POWER_MIN_CPU_FREQ_MHZ 80          // Lowest PLL clock; scan, decode and render run at the maximum
+
+// Self-consumption model: average current of each consumer at the board's
+// supply input, Vision Master E290 (ESP32-S3) figures. Override per board
+// with build flags.
+#ifndef ENERGY_CPU_ACTIVE_MA
+#define ENERGY_CPU_ACTIVE_MA 45.0f         // CPU running at POWER_MAX_CPU_FREQ_MHZ
+#endif
+#ifndef ENERGY_CPU_IDLE_MAX_MA
+#define ENERGY_CPU_IDLE_MAX_MA 30.0f       // Idle at full clock (no power management)
+#endif
+#ifndef ENERGY_CPU_IDLE_MIN_MA
+#define ENERGY_CPU_IDLE_MIN_MA 15.0f       // Idle at POWER_MIN_CPU_FREQ_MHZ
+#endif
+#ifndef ENERGY_CPU_LIGHT_SLEEP_MA
+#define ENERGY_CPU_LIGHT_SLEEP_MA 2.0f     // Light sleep between events, wakeups included
+#endif
+#ifndef ENERGY_RADIO_RX_MA
+#define ENERGY_RADIO_RX_MA 90.0f           // BLE receiver on; scaled by the scan duty cycle
+#endif
+#ifndef ENERGY_WIFI_AP_MA
+#define ENERGY_WIFI_AP_MA 110.0f           // Access point up, beaconing
+#endif
+#ifndef ENERGY_EPD_FULL_MAS
+#define ENERGY_EPD_FULL_MAS 15.0f          // mA*s per full panel refresh
+#endif
+#ifndef ENERGY_EPD_PARTIAL_MAS
+#define ENERGY_EPD_PARTIAL_MAS 3.0f        // mA*s per partial refresh
+#endif
+#ifndef ENERGY_BOARD_MA
+#define ENERGY_BOARD_MA 1.5f               // Regulator, radio module standby and the rest, always on
+#endif
+
+// Deep-sleep sampling
+#ifndef SAMPLING_MODE
+#define SAMPLING_MODE 0                    // 1 = double-press sleeps between timed samples, 0 = sleeps until the button
+#endif
+#define SAMPLE_INTERVAL_S 60               // Deep sleep between samples
+#define SAMPLE_SCAN_TIMEOUT_MS 5000        // Give up on a sample after this long
+#define SAMPLE_MAX_MISSES 3                // Missed samples in a row before the panel shows NO DATA
+
+// Diagnostics
+#define STATS_REPORT_INTERVAL 60000        // 1 minute
+#ifndef PIPELINE_METRICS
+#define PIPELINE_METRICS 1                 // 1 = per-stage latency histograms (/metrics), 0 = lean build without them
+#endif
+#define METRICS_PRINT_REPORTS 10           // Histograms printed with every tenth stats report
+
+// Serial logging: per-packet and per-refresh messages are queued as format
+// and arguments and printed by a low-priority task
+#ifndef LOG_LEVEL
+#define LOG_LEVEL 3                        // 0 none, 1 errors, 2 warnings, 3 info, 4 debug; higher levels are compiled out
+#endif
+#define LOG_QUEUE_MESSAGES 64              // Messages waiting for the log task (power of two); more are dropped and counted
+#define LOG_LINE_MAX 160                   // Longest formatted line
+#define LOG_TASK_STACK_SIZE 3072
+#define LOG_TASK_PRIORITY 1
+#define LOG_TASK_CORE 0
 
 #endif // CONFIG_H
\ No newline at end of file
@@ -1,7 +1,15 @@
 #include "config_server.h"
+#include "sample_log.h"
+#include "victron_ble.h"
+#include "pipeline_metrics.h"
+#include "energy_meter.h"
 
-ConfigServer::ConfigServer() : server(CONFIG_SERVER_PORT), isConfigMode(false) {
-  memset(&currentConfig, 0, sizeof(currentConfig));
+ConfigServer::ConfigServer() : server(CONFIG_SERVER_PORT), deviceCount(0), isConfigMode(false),
+                               serverRunning(false), routesRegistered(false), sampleLog(nullptr),
+                               liveSource(nullptr), lastLiveKeepalive(0), liveEventId(0),
+                               liveClientCount(0) {
+  memset(devices, 0, sizeof(devices));
+  memset(liveSentPublish, 0, sizeof(liveSentPublish));
 }
 
 bool ConfigServer::begin() {
@@ -14,152 +22,567 @@ bool ConfigServer::begin() {
   return true;
 }
 
+void ConfigServer::loadDefaults() {
+  memset(devices, 0, sizeof(devices));
+  strcpy(devices[0].mac_address, INSTANT_READOUT_MAC_ADDRESS);
+  strcpy(devices[0].encryption_key, INSTANT_READOUT_ENCRYPTION_KEY);
+  devices[0].valid = true;
+  deviceCount = 1;
+}
+
 bool ConfigServer::loadConfig() {
-  size_t macLen = prefs.getString("mac", "").length();
-  size_t keyLen = prefs.getString("key", "").length();
+  memset(devices, 0, sizeof(devices));
+  deviceCount = 0;
+  
+  uint8_t storedCount = prefs.getUChar("count", 0);
   
-  if (macLen == 12 && keyLen == 32) {
+  if (storedCount == 0) {
+    // Single-device layout written by earlier firmware
     String mac = prefs.getString("mac", "");
     String key = prefs.getString("key", "");
     
-    strcpy(currentConfig.mac_address, mac.c_str());
-    strcpy(currentConfig.encryption_key, key.c_str());
-    currentConfig.valid = true;
+    if (mac.length() == 12 && key.length() == 32) {
+      strcpy(devices[0].mac_address, mac.c_str());
+      strcpy(devices[0].encryption_key, key.c_str());
+      devices[0].valid = true;
+      deviceCount = 1;
+    }
+  }
+  
+  for (uint8_t i = 0; i < storedCount && i < MAX_VICTRON_DEVICES; i++) {
+    char macKey[8];
+    char keyKey[8];
+    snprintf(macKey, sizeof(macKey), "mac%u", i);
+    snprintf(keyKey, sizeof(keyKey), "key%u", i);
+    
+    String mac = prefs.getString(macKey, "");
+    String key = prefs.getString(keyKey, "");
     
-    Serial.printf("Loaded config - MAC: %s\n", currentConfig.mac_address);
+    if (mac.length() == 12 && key.length() == 32) {
+      DeviceConfig& device = devices[deviceCount++];
+      strcpy(device.mac_address, mac.c_str());
+      strcpy(device.encryption_key, key.c_str());
+      device.valid = true;
+    }
+  }
+  
+  if (deviceCount > 0) {
+    for (uint8_t i = 0; i < deviceCount; i++) {
+      Serial.printf("Loaded config - MAC: %s\n", devices[i].mac_address);
+    }
     return true;
   } else {
     // Use defaults from config.h if no valid stored config
-    strcpy(currentConfig.mac_address, INSTANT_READOUT_MAC_ADDRESS);
-    strcpy(currentConfig.encryption_key, INSTANT_READOUT_ENCRYPTION_KEY);
-    currentConfig.valid = true;
+    loadDefaults();
     
     Serial.println("Using default configuration");
     return true;
   }
 }
 
-bool ConfigServer::saveConfig(const char* macAddress, const char* encryptionKey) {
-  if (strlen(macAddress) != 12 || strlen(encryptionKey) != 32) {
-    Serial.println("Invalid config format");
+bool ConfigServer::saveConfig(const DeviceConfig* configs, uint8_t count) {
+  if (count == 0 || count > MAX_VICTRON_DEVICES) {
+    Serial.println("Invalid device count");
     return false;
   }
   
-  prefs.putString("mac", macAddress);
-  prefs.putString("key", encryptionKey);
+  for (uint8_t i = 0; i < count; i++) {
+    if (strlen(configs[i].mac_address) != 12 || strlen(configs[i].encryption_key) != 32) {
+      Serial.println("Invalid config format");
+      return false;
+    }
+  }
+  
+  prefs.clear();
+  prefs.putUChar("count", count);
   
-  strcpy(currentConfig.mac_address, macAddress);
-  strcpy(currentConfig.encryption_key, encryptionKey);
-  currentConfig.valid = true;
+  memset(devices, 0, sizeof(devices));
+  for (uint8_t i = 0; i < count; i++) {
+    char macKey[8];
+    char keyKey[8];
+    snprintf(macKey, sizeof(macKey), "mac%u", i);
+    snprintf(keyKey, sizeof(keyKey), "key%u", i);
+    
+    prefs.putString(macKey, configs[i].mac_address);
+    prefs.putString(keyKey, configs[i].encryption_key);
+    
+    strcpy(devices[i].mac_address, configs[i].mac_address);
+    strcpy(devices[i].encryption_key, configs[i].encryption_key);
+    devices[i].valid = true;
+    
+    Serial.printf("Saved config - MAC: %s\n", configs[i].mac_address);
+  }
+  deviceCount = count;
   
-  Serial.printf("Saved config - MAC: %s\n", macAddress);
   return true;
 }
 
 void ConfigServer::resetConfig() {
   prefs.clear();
-  strcpy(currentConfig.mac_address, INSTANT_READOUT_MAC_ADDRESS);
-  strcpy(currentConfig.encryption_key, INSTANT_READOUT_ENCRYPTION_KEY);
-  currentConfig.valid = true;
+  loadDefaults();
   Serial.println("Configuration reset to defaults");
 }
 
-bool ConfigServer::startConfigMode() {
-  if (isConfigMode) return true;
-  
-  Serial.println("Starting configuration mode...");
+bool ConfigServer::startServer() {
+  if (serverRunning) return true;
   
   WiFi.mode(WIFI_AP);
   if (!WiFi.softAP(CONFIG_AP_SSID, CONFIG_AP_PASSWORD)) {
     Serial.println("Failed to start AP");
     return false;
   }
+  EnergyMeter::setAccessPoint(true);
   
   IPAddress IP = WiFi.softAPIP();
   Serial.printf("AP started: %s / %s\n", CONFIG_AP_SSID, CONFIG_AP_PASSWORD);
-  Serial.printf("Config portal: http://%s\n", IP.toString().c_str());
+  Serial.printf("Web server: http://%s\n", IP.toString().c_str());
   
-  server.on("/", [this]() { handleRoot(); });
-  server.on("/save", HTTP_POST, [this]() { handleSave(); });
-  server.on("/status", [this]() { handleStatus(); });
+  if (!routesRegistered) {
+    server.on("/", [this]() { handleRoot(); });
+    server.on("/save", HTTP_POST, [this]() { handleSave(); });
+    server.on("/status", [this]() { handleStatus(); });
+    server.on("/log.csv", [this]() { handleLogCsv(); });
+    server.on("/log.bin", [this]() { handleLogBinary(); });
+    server.on("/api/live", [this]() { handleLive(); });
+    server.on("/api/snapshot", [this]() { handleSnapshot(); });
+#if PIPELINE_METRICS
+    server.on("/metrics", [this]() { handleMetrics(); });
+#endif
+#if ADV_CAPTURE == ADV_CAPTURE_FLASH
+    server.on("/capture.bin", [this]() { handleCapture(); });
+#endif
+    routesRegistered = true;
+  }
   server.begin();
   
+  serverRunning = true;
+  return true;
+}
+
+void ConfigServer::stopServer() {
+  if (!serverRunning) return;
+  
+  for (uint8_t i = 0; i < LIVE_MAX_CLIENTS; i++) {
+    liveClients[i].stop();
+  }
+  liveClientCount = 0;
+  
+  server.stop();
+  WiFi.softAPdisconnect(true);
+  WiFi.mode(WIFI_OFF);
+  EnergyMeter::setAccessPoint(false);
+  serverRunning = false;
+}
+
+bool ConfigServer::startConfigMode() {
+  if (isConfigMode) return true;
+  
+  Serial.println("Starting configuration mode...");
+  
+  if (!startServer()) {
+    return false;
+  }
+  
   configStartTime = millis();
   isConfigMode = true;
   
   return true;
 }
 
+bool ConfigServer::startLiveServer() {
+  Serial.println("Starting live data server...");
+  return startServer();
+}
+
 void ConfigServer::stopConfigMode() {
   if (!isConfigMode) return;
   
-  server.stop();
-  WiFi.softAPdisconnect(true);
-  WiFi.mode(WIFI_OFF);
+#if !LIVE_API_ALWAYS_ON
+  stopServer();
+#endif
   isConfigMode = false;
   
   Serial.println("Configuration mode stopped");
 }
 
+unsigned long ConfigServer::msUntilTimeout() const {
+  unsigned long elapsed = millis() - configStartTime;
+  return elapsed > CONFIG_TIMEOUT_MS ? 0 : CONFIG_TIMEOUT_MS - elapsed + 1;
+}
+
 void ConfigServer::loop() {
-  if (!isConfigMode) return;
+  if (!serverRunning) return;
   
   server.handleClient();
+  publishLive();
   
   // Auto-timeout after configured time
-  if (millis() - configStartTime > CONFIG_TIMEOUT_MS) {
+  if (isConfigMode && millis() - configStartTime > CONFIG_TIMEOUT_MS) {
     Serial.println("Configuration timeout");
     stopConfigMode();
   }
 }
 
+// With LIVE_API_ALWAYS_ON the server outlives config mode; the pages that
+// show or change the configuration answer only while the portal is open
+bool ConfigServer::portalOpen() {
+  if (isConfigMode) {
+    return true;
+  }
+  server.send(403, "text/plain", "Configuration portal closed - hold the button 6s to open it");
+  return false;
+}
+
+String ConfigServer::maskKey(const char* key) {
+  String masked(key);
+  return masked.length() == 32 ? masked.substring(0, 8) + "..." + masked.substring(24) : String("...");
+}
+
 void ConfigServer::handleRoot() {
+  if (!portalOpen()) return;
   sendConfigPage();
 }
 
 void ConfigServer::handleStatus() {
-  String json = "{";
-  json += "\"mac\":\"" + String(currentConfig.mac_address) + "\",";
-  json += "\"key\":\"" + String(currentConfig.encryption_key) + "\",";
-  json += "\"valid\":" + String(currentConfig.valid ? "true" : "false");
+  if (!portalOpen()) return;
+  
+  String json = "{\"devices\":[";
+  for (uint8_t i = 0; i < deviceCount; i++) {
+    if (i > 0) json += ",";
+    json += "{\"mac\":\"" + String(devices[i].mac_address) + "\",";
+    json += "\"key\":\"" + maskKey(devices[i].encryption_key) + "\"}";
+  }
+  json += "],";
+  json += "\"valid\":" + String(hasValidConfig() ? "true" : "false");
   json += "}";
   
   server.send(200, "application/json", json);
 }
 
-void ConfigServer::handleSave() {
-  String mac = server.arg("mac");
-  String key = server.arg("key");
-  
-  // Remove any spaces or colons from MAC
-  mac.replace(":", "");
-  mac.replace(" ", "");
-  mac.toLowerCase();
-  
-  // Remove any spaces from key
-  key.replace(" ", "");
-  key.toLowerCase();
-  
-  // Validate MAC (12 hex chars)
-  bool macValid = (mac.length() == 12);
-  for (int i = 0; i < mac.length() && macValid; i++) {
-    char c = mac.charAt(i);
-    if (!((c >= '0' && c <= '9') || (c >= 'a' && c <= 'f'))) {
-      macValid = false;
+// Both exports stream the log a chunk at a time; it is never held in RAM.
+// Pending records are written first so the download is complete.
+void ConfigServer::handleLogCsv() {
+  if (!sampleLog) {
+    server.send(404, "text/plain", "No sample log");
+    return;
+  }
+  sampleLog->flush();
+  
+  server.setContentLength(CONTENT_LENGTH_UNKNOWN);
+  server.sendHeader("Content-Disposition", "attachment; filename=samples.csv");
+  server.send(200, "text/csv", "");
+  
+  char chunk[LOG_EXPORT_CHUNK_BYTES];
+  size_t used = strlen(LOG_CSV_HEADER);
+  memcpy(chunk, LOG_CSV_HEADER, used);
+  
+  SampleLog::Reader reader(*sampleLog);
+  LogRecord record;
+  while (reader.next(record)) {
+    if (used + LOG_CSV_LINE_MAX > sizeof(chunk)) {
+      server.sendContent(chunk, used);
+      used = 0;
     }
+    used += logFormatCsv(record, chunk + used);
+  }
+  if (used > 0) {
+    server.sendContent(chunk, used);
+  }
+  server.sendContent("");
+  
+  if (reader.getSkippedBytes() > 0) {
+    Serial.printf("Log export: %u damaged bytes skipped\n", reader.getSkippedBytes());
+  }
+}
+
+void ConfigServer::handleLogBinary() {
+  if (!sampleLog) {
+    server.send(404, "text/plain", "No sample log");
+    return;
+  }
+  sampleLog->flush();
+  
+  server.setContentLength(CONTENT_LENGTH_UNKNOWN);
+  server.sendHeader("Content-Disposition", "attachment; filename=samples.bin");
+  server.send(200, "application/octet-stream", "");
+  
+  uint8_t chunk[LOG_EXPORT_CHUNK_BYTES];
+  SampleLog::RawReader reader(*sampleLog);
+  size_t length;
+  while ((length = reader.read(chunk, sizeof(chunk))) > 0) {
+    server.sendContent((const char*)chunk, length);
+  }
+  server.sendContent("");
+}
+
+#if ADV_CAPTURE == ADV_CAPTURE_FLASH
+// Advertisement capture for sim/replay; frames still buffered on the decode task are not included
+void ConfigServer::handleCapture() {
+  File file = LittleFS.open(CAPTURE_FILE, FILE_READ);
+  if (!file) {
+    server.send(404, "text/plain", "No capture");
+    return;
   }
   
-  // Validate encryption key (32 hex chars)
-  bool keyValid = (key.length() == 32);
-  for (int i = 0; i < key.length() && keyValid; i++) {
-    char c = key.charAt(i);
+  server.setContentLength(CONTENT_LENGTH_UNKNOWN);
+  server.sendHeader("Content-Disposition", "attachment; filename=capture.bin");
+  server.send(200, "application/octet-stream", "");
+  
+  uint8_t chunk[LOG_EXPORT_CHUNK_BYTES];
+  size_t length;
+  while ((length = file.read(chunk, sizeof(chunk))) > 0) {
+    server.sendContent((const char*)chunk, length);
+  }
+  server.sendContent("");
+}
+#endif
+
+#if PIPELINE_METRICS
+// Prometheus text exposition of the pipeline latency histograms, one chunk per stage
+void ConfigServer::handleMetrics() {
+  server.setContentLength(CONTENT_LENGTH_UNKNOWN);
+  server.send(200, "text/plain; version=0.0.4", "");
+  
+  char chunk[METRICS_STAGE_TEXT_MAX];
+  for (int i = 0; i < STAGE_COUNT; i++) {
+    size_t length = PipelineMetrics::formatPrometheus((PipelineStage)i, chunk, sizeof(chunk));
+    if (length > 0) {
+      server.sendContent(chunk, length);
+    }
+  }
+  server.sendContent("");
+}
+#endif
+
+// Live data. Readings are serialized with snprintf into fixed buffers, one
+// device at a time, and never built up in a String.
+static size_t formatReadingJson(char* out, size_t size, int device, const BatteryData& data,
+                                unsigned long now) {
+  char name[8];
+  if (device < 0) {
+    strcpy(name, "\"all\"");
+  } else {
+    snprintf(name, sizeof(name), "%d", device);
+  }
+  
+  int length = snprintf(out, size,
+      "{\"device\":%s,\"valid\":%s,\"age_ms\":%lu,\"voltage\":%.2f,\"current\":%.2f,"
+      "\"power\":%.1f,\"soc\":%.1f,\"consumed_ah\":%.2f,\"ttg_min\":%u,"
+      "\"remaining_min\":%u,\"to_full_min\":%u,\"time_valid\":%s,\"time_confidence\":%u,"
+      "\"aux_type\":%u,\"aux\":%.2f,\"alarms\":%u,\"rssi\":%d}",
+      name, data.data_valid ? "true" : "false", data.data_valid ? now - data.last_update : 0UL,
+      data.voltage, data.current, data.power, data.soc, data.consumed_ah, data.ttg_minutes,
+      data.calculated_time_remaining_minutes, data.calculated_time_to_full_minutes,
+      data.time_calculation_valid ? "true" : "false", data.time_confidence,
+      data.aux_type, data.aux_value, data.alarms, data.rssi);
+  return length < 0 ? 0 : min((size_t)length, size - 1);
+}
+
+static size_t formatLiveEvent(char* out, size_t size, uint32_t id, int device, const BatteryData& data,
+                              unsigned long now) {
+  int length = snprintf(out, size, "id: %u\nevent: reading\ndata: ", id);
+  if (length < 0 || (size_t)length >= size) {
+    return 0;
+  }
+  length += formatReadingJson(out + length, size - length, device, data, now);
+  
+  // A cut-off event would run into the next one
+  if ((size_t)length + 2 >= size) {
+    return 0;
+  }
+  out[length++] = '\n';
+  out[length++] = '\n';
+  out[length] = '\0';
+  return length;
+}
+
+void ConfigServer::setLiveSource(VictronBLE* ble) {
+  liveSource = ble;
+  memset(liveSentPublish, 0, sizeof(liveSentPublish));
+}
+
+// /api/live keeps the connection as a Server-Sent Events stream. The socket
+// is taken over from the web server, which moves on to the next request;
+// events are written to it from loop() as readings arrive.
+void ConfigServer::handleLive() {
+  int slot = -1;
+  for (uint8_t i = 0; i < LIVE_MAX_CLIENTS; i++) {
+    if (!liveClients[i].connected()) {
+      slot = i;
+      break;
+    }
+  }
+  if (slot < 0) {
+    server.send(503, "text/plain", "Too many live clients");
+    return;
+  }
+  
+  WiFiClient client = server.client();
+  client.print("HTTP/1.1 200 OK\r\n"
+               "Content-Type: text/event-stream\r\n"
+               "Cache-Control: no-cache\r\n"
+               "Connection: keep-alive\r\n"
+               "Access-Control-Allow-Origin: *\r\n"
+               "\r\n"
+               "retry: 3000\n\n");
+  
+  // Start the stream with the current readings rather than waiting for the next packet
+  if (liveSource) {
+    char event[LIVE_EVENT_MAX];
+    unsigned long now = millis();
+    for (uint8_t i = 0; i < liveSource->getDeviceCount(); i++) {
+      BatteryData data = liveSource->getDeviceData(i);
+      if (data.data_valid) {
+        client.write((const uint8_t*)event, formatLiveEvent(event, sizeof(event), liveEventId, i, data, now));
+      }
+    }
+  }
+  
+  liveClients[slot] = client;
+  liveClientCount++;
+  Serial.printf("Live client connected (%u open)\n", liveClientCount);
+}
+
+void ConfigServer::sendLiveEvent(const char* event, size_t length) {
+  liveClientCount = 0;
+  for (uint8_t i = 0; i < LIVE_MAX_CLIENTS; i++) {
+    if (!liveClients[i].connected()) {
+      continue;
+    }
+    if (liveClients[i].write((const uint8_t*)event, length) != length) {
+      liveClients[i].stop();
+      Serial.println("Live client dropped");
+      continue;
+    }
+    liveClientCount++;
+  }
+}
+
+void ConfigServer::publishLive() {
+  if (liveClientCount == 0) {
+    return;
+  }
+  
+  unsigned long now = millis();
+  bool sent = false;
+  
+  if (liveSource) {
+    char event[LIVE_EVENT_MAX];
+    for (uint8_t i = 0; i < liveSource->getDeviceCount() && i < MAX_VICTRON_DEVICES; i++) {
+      // Duplicate packets refresh last_update but publish nothing new
+      uint32_t published = liveSource->getDevicePublishCount(i);
+      if (published == liveSentPublish[i]) {
+        continue;
+      }
+      BatteryData data = liveSource->getDeviceData(i);
+      if (!data.data_valid) {
+        continue;
+      }
+      liveSentPublish[i] = published;
+      size_t length = formatLiveEvent(event, sizeof(event), ++liveEventId, i, data, now);
+      if (length > 0) {
+        sendLiveEvent(event, length);
+        sent = true;
+      }
+    }
+  }
+  
+  // Comment lines keep proxies from closing a quiet stream and find dead clients
+  if (sent) {
+    lastLiveKeepalive = now;
+  } else if (now - lastLiveKeepalive >= LIVE_KEEPALIVE_MS) {
+    lastLiveKeepalive = now;
+    sendLiveEvent(": keepalive\n\n", 13);
+  }
+}
+
+void ConfigServer::handleSnapshot() {
+  char entry[LIVE_EVENT_MAX];
+  unsigned long now = millis();
+  
+  server.setContentLength(CONTENT_LENGTH_UNKNOWN);
+  server.sendHeader("Cache-Control", "no-cache");
+  server.sendHeader("Access-Control-Allow-Origin", "*");
+  server.send(200, "application/json", "");
+  
+  int length = snprintf(entry, sizeof(entry), "{\"uptime_ms\":%lu,\"view\":%d,\"devices\":[",
+                        now, liveSource ? liveSource->getView() : 0);
+  server.sendContent(entry, length);
+  
+  if (liveSource) {
+    for (uint8_t i = 0; i < liveSource->getDeviceCount(); i++) {
+      size_t used = 0;
+      if (i > 0) {
+        entry[used++] = ',';
+      }
+      used += formatReadingJson(entry + used, sizeof(entry) - used, i, liveSource->getDeviceData(i), now);
+      server.sendContent(entry, used);
+    }
+    
+    size_t used = snprintf(entry, sizeof(entry), "],\"combined\":");
+    used += formatReadingJson(entry + used, sizeof(entry) - used, -1, liveSource->getCombinedData(), now);
+    entry[used++] = '}';
+    server.sendContent(entry, used);
+  } else {
+    server.sendContent("],\"combined\":null}");
+  }
+  server.sendContent("");
+}
+
+bool ConfigServer::normalizeHex(String& value, size_t expectedLength) {
+  // Remove any spaces or colons
+  value.replace(":", "");
+  value.replace(" ", "");
+  value.toLowerCase();
+  
+  bool valid = (value.length() == expectedLength);
+  for (unsigned int i = 0; i < value.length() && valid; i++) {
+    char c = value.charAt(i);
     if (!((c >= '0' && c <= '9') || (c >= 'a' && c <= 'f'))) {
-      keyValid = false;
+      valid = false;
+    }
+  }
+  return valid;
+}
+
+void ConfigServer::handleSave() {
+  if (!portalOpen()) return;
+  
+  DeviceConfig configs[MAX_VICTRON_DEVICES];
+  memset(configs, 0, sizeof(configs));
+  uint8_t count = 0;
+  bool formatValid = true;
+  
+  for (uint8_t i = 0; i < MAX_VICTRON_DEVICES; i++) {
+    char macField[8];
+    char keyField[8];
+    snprintf(macField, sizeof(macField), "mac%u", i);
+    snprintf(keyField, sizeof(keyField), "key%u", i);
+    
+    String mac = server.arg(macField);
+    String key = server.arg(keyField);
+    mac.trim();
+    key.trim();
+    
+    // Empty rows are unused device slots
+    if (mac.length() == 0 && key.length() == 0) {
+      continue;
     }
+    
+    // Validate MAC (12 hex chars) and encryption key (32 hex chars)
+    if (!normalizeHex(mac, 12) || !normalizeHex(key, 32)) {
+      formatValid = false;
+      break;
+    }
+    
+    strcpy(configs[count].mac_address, mac.c_str());
+    strcpy(configs[count].encryption_key, key.c_str());
+    configs[count].valid = true;
+    count++;
   }
   
-  if (macValid && keyValid) {
-    if (saveConfig(mac.c_str(), key.c_str())) {
+  if (formatValid && count > 0) {
+    if (saveConfig(configs, count)) {
       String response = "<!DOCTYPE html><html><head><title>BTLE Power Gauge Config</title>";
       response += "<meta charset='UTF-8'>";
       response += "<meta name='viewport' content='width=device-width, initial-scale=1'>";
@@ -171,11 +594,13 @@ void ConfigServer::handleSave() {
       response += "<div class='container'>";
       response += "<h1>Configuration Saved!</h1>";
       response += "<div class='success'>&check; Device configuration updated successfully</div>";
-      response += "<div class='info'>";
-      response += "<strong>MAC Address:</strong> " + mac + "<br>";
-      response += "<strong>Encryption Key:</strong> " + key.substring(0, 8) + "...";
-      response += "</div>";
-             response += "<p>The device will restart and connect to your device.</p>";
+      for (uint8_t i = 0; i < count; i++) {
+        response += "<div class='info'>";
+        response += "<strong>MAC Address:</strong> " + String(configs[i].mac_address) + "<br>";
+        response += "<strong>Encryption Key:</strong> " + String(configs[i].encryption_key).substring(0, 8) + "...";
+        response += "</div>";
+      }
+      response += "<p>The device will restart and connect to your devices.</p>";
       response += "<p>Configuration portal will close automatically in 10 seconds.</p>";
       response += "<script>setTimeout(function(){window.close();}, 10000);</script>";
       response += "</div></body></html>";
@@ -188,9 +613,9 @@ void ConfigServer::handleSave() {
       server.send(500, "text/plain", "Failed to save configuration");
     }
   } else {
-         String response = "<!DOCTYPE html><html><head><title>Configuration Error</title>";
-     response += "<meta charset='UTF-8'>";
-     response += "<meta name='viewport' content='width=device-width, initial-scale=1'>";
+    String response = "<!DOCTYPE html><html><head><title>Configuration Error</title>";
+    response += "<meta charset='UTF-8'>";
+    response += "<meta name='viewport' content='width=device-width, initial-scale=1'>";
     response += "<style>body{font-family:Arial;margin:40px;background:#f0f0f0}";
     response += ".container{background:white;padding:30px;border-radius:10px;box-shadow:0 2px 10px rgba(0,0,0,0.1);max-width:500px;margin:0 auto}";
     response += ".error{color:#f44336;text-align:center;font-size:18px;margin-bottom:20px}";
@@ -199,6 +624,7 @@ void ConfigServer::handleSave() {
     response += "<h1>Configuration Error</h1>";
     response += "<div class='error'>&times; Invalid format</div>";
     response += "<p><strong>Requirements:</strong></p><ul>";
+    response += "<li>At least one device</li>";
     response += "<li>MAC Address: Exactly 12 hexadecimal characters</li>";
     response += "<li>Encryption Key: Exactly 32 hexadecimal characters</li>";
     response += "</ul>";
@@ -234,27 +660,45 @@ void ConfigServer::sendConfigPage() {
   
   html += "<div class='current'>";
   html += "<h3>Current Configuration:</h3>";
-  html += "<strong>MAC:</strong> " + String(currentConfig.mac_address) + "<br>";
-  html += "<strong>Key:</strong> " + String(currentConfig.encryption_key).substring(0, 8) + "..." + String(currentConfig.encryption_key).substring(24);
+  for (uint8_t i = 0; i < deviceCount; i++) {
+    html += "<strong>Device " + String(i + 1) + " MAC:</strong> " + String(devices[i].mac_address) + "<br>";
+    html += "<strong>Key:</strong> " + maskKey(devices[i].encryption_key) + "<br>";
+  }
   html += "</div>";
   
   html += "<form method='POST' action='/save'>";
   
-  html += "<div class='form-group'>";
-  html += "<label for='mac'>Device MAC Address:</label>";
-  html += "<input type='text' id='mac' name='mac' value='" + String(currentConfig.mac_address) + "' maxlength='17' placeholder='d6ec4c9e6307'>";
-  html += "<div class='help'>Enter MAC address (12 hex characters, no separators)</div>";
-  html += "</div>";
-  
-  html += "<div class='form-group'>";
-  html += "<label for='key'>Encryption Key:</label>";
-  html += "<input type='text' id='key' name='key' value='" + String(currentConfig.encryption_key) + "' maxlength='32' placeholder='64cd146fe6771ef40610ecf50f3bb06a'>";
-  html += "<div class='help'>32-character hexadecimal encryption key</div>";
-  html += "</div>";
+  // One row per device slot; leave a row empty to leave the slot unused
+  for (uint8_t i = 0; i < MAX_VICTRON_DEVICES; i++) {
+    String index = String(i);
+    String mac = i < deviceCount ? String(devices[i].mac_address) : String("");
+    String key = i < deviceCount ? String(devices[i].encryption_key) : String("");
+    
+    html += "<h3>Device " + String(i + 1) + "</h3>";
+    html += "<div class='form-group'>";
+    html += "<label for='mac" + index + "'>Device MAC Address:</label>";
+    html += "<input type='text' id='mac" + index + "' name='mac" + index + "' value='" + mac + "' maxlength='17' placeholder='d6ec4c9e6307'>";
+    html += "<div class='help'>Enter MAC address (12 hex characters, no separators)</div>";
+    html += "</div>";
+    
+    html += "<div class='form-group'>";
+    html += "<label for='key" + index + "'>Encryption Key:</label>";
+    html += "<input type='text' id='key" + index + "' name='key" + index + "' value='" + key + "' maxlength='32' placeholder='64cd146fe6771ef40610ecf50f3bb06a'>";
+    html += "<div class='help'>32-character hexadecimal encryption key</div>";
+    html += "</div>";
+  }
   
   html += "<button type='submit' class='btn'>Save Configuration</button>";
   html += "</form>";
   
+  if (sampleLog) {
+    html += "<div class='current'>";
+    html += "<h3>Sample Log:</h3>";
+    html += "About " + String(sampleLog->getRecordEstimate() + sampleLog->getPendingCount()) + " records. ";
+    html += "Download as <a href='/log.csv'>CSV</a> or <a href='/log.bin'>binary</a> (read with tools/log_reader).";
+    html += "</div>";
+  }
+  
   html += "<div class='info'>";
   html += "<h3>How to find these values:</h3>";
   html += "<p><strong>Using Device App:</strong></p>";
@@ -7,6 +7,9 @@
 #include <Preferences.h>
 #include "config.h"
 
+class SampleLog;
+class VictronBLE;
+
 struct DeviceConfig {
   char mac_address[13];     // 12 hex chars + null terminator
   char encryption_key[33];  // 32 hex chars + null terminator
@@ -17,14 +20,44 @@ class ConfigServer {
 private:
   WebServer server;
   Preferences prefs;
-  DeviceConfig currentConfig;
+  DeviceConfig devices[MAX_VICTRON_DEVICES];
+  uint8_t deviceCount;
   unsigned long configStartTime;
   bool isConfigMode;
+  bool serverRunning;
+  bool routesRegistered;
+  SampleLog* sampleLog;
+  
+  // Live data: open event streams and each device's publish count at its last event
+  VictronBLE* liveSource;
+  WiFiClient liveClients[LIVE_MAX_CLIENTS];
+  uint32_t liveSentPublish[MAX_VICTRON_DEVICES];
+  unsigned long lastLiveKeepalive;
+  uint32_t liveEventId;
+  uint8_t liveClientCount;
   
   void handleRoot();
   void handleSave();
   void handleStatus();
+  void handleLogCsv();
+  void handleLogBinary();
+  void handleLive();
+  void handleSnapshot();
+#if PIPELINE_METRICS
+  void handleMetrics();
+#endif
+#if ADV_CAPTURE == ADV_CAPTURE_FLASH
+  void handleCapture();
+#endif
+  bool portalOpen();
+  bool startServer();
+  void stopServer();
+  void sendLiveEvent(const char* event, size_t length);
+  void publishLive();
   void sendConfigPage();
+  void loadDefaults();
+  static bool normalizeHex(String& value, size_t expectedLength);
+  static String maskKey(const char* key);
   
 public:
   ConfigServer();
@@ -33,12 +66,22 @@ public:
   bool startConfigMode();
   void stopConfigMode();
   bool isInConfigMode() const { return isConfigMode; }
+  unsigned long msUntilTimeout() const; // Time left before config mode ends by itself
+  void setSampleLog(SampleLog* log) { sampleLog = log; } // Served at /log.csv and /log.bin
+  
+  // Live data API. The web server runs in config mode, or all the time with
+  // LIVE_API_ALWAYS_ON; either way it has to be polled through loop().
+  bool startLiveServer();
+  bool isServing() const { return serverRunning; }
+  void setLiveSource(VictronBLE* ble);
+  bool hasLiveClients() const { return liveClientCount > 0; }
   
   // Configuration management
   bool loadConfig();
-  bool saveConfig(const char* macAddress, const char* encryptionKey);
-  DeviceConfig getConfig() const { return currentConfig; }
-  bool hasValidConfig() const { return currentConfig.valid; }
+  bool saveConfig(const DeviceConfig* configs, uint8_t count);
+  uint8_t getDeviceCount() const { return deviceCount; }
+  DeviceConfig getDevice(uint8_t index) const { return devices[index]; }
+  bool hasValidConfig() const { return deviceCount > 0; }
   
   // Reset to defaults
   void resetConfig();
@@ -0,0 +1,193 @@
+#include "deferred_log.h"
+#include "spsc_ring.h"
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+
+static SpscRing<LogMessage, LOG_QUEUE_MESSAGES> ring;
+static portMUX_TYPE producerMux = portMUX_INITIALIZER_UNLOCKED;
+static TaskHandle_t logTask = nullptr;
+static uint32_t reportedDrops = 0;
+
+static void printMessage(const LogMessage& message) {
+  char line[LOG_LINE_MAX];
+  size_t length = DeferredLog::format(message, line, sizeof(line));
+  Serial.write((const uint8_t*)line, length);
+}
+
+static void logTaskEntry(void*) {
+  for (;;) {
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    DeferredLog::drain();
+  }
+}
+
+void DeferredLog::begin() {
+  if (logTask) {
+    return;
+  }
+  if (xTaskCreatePinnedToCore(logTaskEntry, "log", LOG_TASK_STACK_SIZE, nullptr, LOG_TASK_PRIORITY,
+                              &logTask, LOG_TASK_CORE) != pdPASS) {
+    logTask = nullptr;
+    Serial.println("Log task not started, logging inline");
+  }
+}
+
+void DeferredLog::submit(const LogMessage& message) {
+  if (!logTask) {
+    printMessage(message);
+    return;
+  }
+
+  portENTER_CRITICAL(&producerMux);
+  LogMessage* slot = ring.reserve();
+  if (slot) {
+    *slot = message;
+    ring.commit();
+  }
+  portEXIT_CRITICAL(&producerMux);
+
+  if (slot) {
+    xTaskNotifyGive(logTask);
+  }
+}
+
+void DeferredLog::drain() {
+  const LogMessage* message;
+  while ((message = ring.peek()) != nullptr) {
+    printMessage(*message);
+    ring.release();
+  }
+
+  uint32_t dropped = ring.getDropped();
+  if (dropped != reportedDrops) {
+    Serial.printf("Log: %u messages dropped\n", dropped - reportedDrops);
+    reportedDrops = dropped;
+  }
+}
+
+void DeferredLog::flush(uint32_t timeoutMs) {
+  if (!logTask) {
+    return;
+  }
+  xTaskNotifyGive(logTask);
+  unsigned long start = millis();
+  while (ring.peek() != nullptr && millis() - start < timeoutMs) {
+    delay(1);
+  }
+}
+
+// Walks the format and prints each conversion with its own snprintf, the
+// argument cast to what that conversion expects
+size_t DeferredLog::format(const LogMessage& message, char* out, size_t size) {
+  if (size == 0) {
+    return 0;
+  }
+  size_t used = 0;
+  uint8_t next = 0;
+  const char* p = message.format;
+
+  while (*p && used + 1 < size) {
+    if (*p != '%') {
+      out[used++] = *p++;
+      continue;
+    }
+    if (p[1] == '%') {
+      out[used++] = '%';
+      p += 2;
+      continue;
+    }
+
+    // %[flags][width][.precision][length]conversion
+    char spec[16];
+    size_t specLength = 0;
+    bool isLong = false;
+    spec[specLength++] = *p++;
+    while (*p && strchr("-+ #0123456789.", *p) && specLength < sizeof(spec) - 4) {
+      spec[specLength++] = *p++;
+    }
+    // Arguments are 32 bits at most; long, size_t and the like print as long
+    while (*p && strchr("hlzjt", *p)) {
+      isLong = isLong || *p != 'h';
+      p++;
+    }
+    char conversion = *p ? *p++ : '\0';
+    if (conversion == '\0') {
+      break;
+    }
+    if (next >= message.argCount) {
+      // More conversions than arguments: show the conversion itself
+      spec[specLength++] = conversion;
+      spec[specLength] = '\0';
+      used += snprintf(out + used, size - used, "%s", spec);
+      used = min(used, size - 1);
+      continue;
+    }
+
+    const LogArg& arg = message.args[next++];
+    int written = 0;
+    switch (conversion) {
+      case 'd':
+      case 'i':
+        strcpy(spec + specLength, isLong ? "ld" : "d");
+        written = isLong ? snprintf(out + used, size - used, spec, (long)arg.i)
+                        : snprintf(out + used, size - used, spec, (int)arg.i);
+        break;
+      case 'u':
+      case 'x':
+      case 'X':
+      case 'o':
+        spec[specLength] = 'l';
+        spec[specLength + 1] = conversion;
+        spec[specLength + 2] = '\0';
+        written = snprintf(out + used, size - used, spec, (unsigned long)arg.u);
+        break;
+      case 'c':
+        strcpy(spec + specLength, "c");
+        written = snprintf(out + used, size - used, spec, (int)arg.i);
+        break;
+      case 'f':
+      case 'F':
+      case 'e':
+      case 'E':
+      case 'g':
+      case 'G':
+        spec[specLength] = conversion;
+        spec[specLength + 1] = '\0';
+        written = snprintf(out + used, size - used, spec, (double)arg.f);
+        break;
+      case 's':
+        strcpy(spec + specLength, "s");
+        written = snprintf(out + used, size - used, spec, arg.s ? arg.s : "(null)");
+        break;
+      case 'p':
+        strcpy(spec + specLength, "p");
+        written = snprintf(out + used, size - used, spec, arg.p);
+        break;
+      default:
+        break;
+    }
+    if (written > 0) {
+      used = min(used + (size_t)written, size - 1);
+    }
+  }
+
+  // A line cut short still ends the line
+  if (*p && size >= 2) {
+    used = size - 1;
+    out[used - 1] = '\n';
+  }
+  out[used] = '\0';
+  return used;
+}
+
+uint32_t DeferredLog::getDroppedCount() {
+  return ring.getDropped();
+}
+
+uint32_t DeferredLog::getHighWater() {
+  return ring.getHighWater();
+}
+
+size_t DeferredLog::getCapacity() {
+  return ring.capacity();
+}
@@ -0,0 +1,133 @@
+#ifndef DEFERRED_LOG_H
+#define DEFERRED_LOG_H
+
+#include <Arduino.h>
+#include <type_traits>
+#include "config.h"
+
+#define LOG_LEVEL_NONE 0
+#define LOG_LEVEL_ERROR 1
+#define LOG_LEVEL_WARN 2
+#define LOG_LEVEL_INFO 3
+#define LOG_LEVEL_DEBUG 4
+
+#define LOG_MAX_ARGS 8
+
+// One argument as passed: 32-bit integers (either sign), floats and doubles
+// (kept as float) and strings. A %s string is kept by pointer and must
+// outlive the message: literals and the device table qualify, stack buffers
+// do not.
+union LogArg {
+  uint32_t u;
+  int32_t i;
+  float f;
+  const char* s;
+  const void* p;
+};
+
+// A message waiting to be printed. The format string is its ID: literals
+// stay where they are, so the pointer is enough.
+struct LogMessage {
+  const char* format;
+  uint8_t argCount;
+  LogArg args[LOG_MAX_ARGS];
+};
+
+// Deferred serial logging. The LOG_* macros above LOG_LEVEL compile to
+// nothing (their arguments are still type-checked); the rest copy the
+// format pointer and the raw arguments into a ring, and a low-priority task
+// formats and prints them, so the decode task and the render path never
+// wait for the UART. Producers on any task take
+// turns at the ring under a spinlock held for the copy only. A full ring
+// drops the message; the log task reports how many were lost.
+//
+// Before begin() messages are printed on the spot, as Serial.printf would.
+namespace DeferredLog {
+  void begin();
+  void submit(const LogMessage& message);
+
+  // Log task only: prints everything queued (the host simulator, whose
+  // tasks do not run, calls it in the task's place)
+  void drain();
+
+  // Waits for the queue to be printed, e.g. before deep sleep
+  void flush(uint32_t timeoutMs = 200);
+
+  // Formats one message as printf would; returns the length
+  size_t format(const LogMessage& message, char* out, size_t size);
+
+  uint32_t getDroppedCount();
+  uint32_t getHighWater();
+  size_t getCapacity();
+
+  // Argument packing for write()
+  template <typename T>
+  inline typename std::enable_if<std::is_integral<T>::value || std::is_enum<T>::value, LogArg>::type pack(T value) {
+    LogArg arg;
+    arg.u = (uint32_t)value;
+    return arg;
+  }
+
+  template <typename T>
+  inline typename std::enable_if<std::is_floating_point<T>::value, LogArg>::type pack(T value) {
+    LogArg arg;
+    arg.f = (float)value;
+    return arg;
+  }
+
+  inline LogArg pack(const char* value) {
+    LogArg arg;
+    arg.s = value;
+    return arg;
+  }
+
+  inline LogArg pack(const void* value) {
+    LogArg arg;
+    arg.p = value;
+    return arg;
+  }
+
+  inline void packAll(LogMessage&) {}
+
+  template <typename T, typename... Rest>
+  inline void packAll(LogMessage& message, T value, Rest... rest) {
+    message.args[message.argCount++] = pack(value);
+    packAll(message, rest...);
+  }
+
+  template <typename... Args>
+  inline void write(const char* format, Args... args) {
+    static_assert(sizeof...(Args) <= LOG_MAX_ARGS, "too many log arguments");
+    LogMessage message;
+    message.format = format;
+    message.argCount = 0;
+    packAll(message, args...);
+    submit(message);
+  }
+}
+
+#if LOG_LEVEL >= LOG_LEVEL_ERROR
+#define LOG_ERROR(...) DeferredLog::write(__VA_ARGS__)
+#else
+#define LOG_ERROR(...) do { if (0) DeferredLog::write(__VA_ARGS__); } while (0)
+#endif
+
+#if LOG_LEVEL >= LOG_LEVEL_WARN
+#define LOG_WARN(...) DeferredLog::write(__VA_ARGS__)
+#else
+#define LOG_WARN(...) do { if (0) DeferredLog::write(__VA_ARGS__); } while (0)
+#endif
+
+#if LOG_LEVEL >= LOG_LEVEL_INFO
+#define LOG_INFO(...) DeferredLog::write(__VA_ARGS__)
+#else
+#define LOG_INFO(...) do { if (0) DeferredLog::write(__VA_ARGS__); } while (0)
+#endif
+
+#if LOG_LEVEL >= LOG_LEVEL_DEBUG
+#define LOG_DEBUG(...) DeferredLog::write(__VA_ARGS__)
+#else
+#define LOG_DEBUG(...) do { if (0) DeferredLog::write(__VA_ARGS__); } while (0)
+#endif
+
+#endif // DEFERRED_LOG_H
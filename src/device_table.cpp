@@ -0,0 +1,99 @@
+#include "device_table.h"
+#include <new>
+
+DeviceTable::DeviceTable() : count(0) {
+  memset(slots, -1, sizeof(slots));
+}
+
+DeviceTable::~DeviceTable() {
+  for (uint8_t i = 0; i < count; i++) {
+    mbedtls_aes_free(&devices[i].aesContext);
+  }
+}
+
+uint32_t DeviceTable::hashMac(uint64_t mac) {
+  // Fibonacci hashing of the folded address
+  uint32_t folded = (uint32_t)mac ^ (uint32_t)(mac >> 32);
+  return folded * 2654435769u;
+}
+
+int DeviceTable::add(const char* macString, const char* encryptionKeyHex) {
+  if (count >= MAX_VICTRON_DEVICES) {
+    return -1;
+  }
+  
+  uint64_t mac;
+  if (!parseMac(macString, mac) || strlen(encryptionKeyHex) != 32) {
+    return -1;
+  }
+  
+  if (find(mac) >= 0) {
+    return -1;
+  }
+  
+  VictronDevice& device = devices[count];
+  new (&device) VictronDevice(); // Value-initialized: zeroed, then the seqlocks constructed
+  device.mac = mac;
+  strncpy(device.macString, macString, sizeof(device.macString) - 1);
+  
+  for (size_t i = 0; i < 16; i++) {
+    char hexByte[3] = {encryptionKeyHex[i * 2], encryptionKeyHex[i * 2 + 1], '\0'};
+    device.encryptionKey[i] = (uint8_t)strtol(hexByte, NULL, 16);
+  }
+  
+  // Expand the AES key schedule once; the key never changes for this device
+  mbedtls_aes_init(&device.aesContext);
+  device.aesReady = mbedtls_aes_setkey_enc(&device.aesContext, device.encryptionKey, 128) == 0;
+  if (!device.aesReady) {
+    Serial.printf("Failed to set AES key for %s\n", macString);
+  }
+  
+  uint32_t mask = DEVICE_TABLE_SLOTS - 1;
+  uint32_t slot = (hashMac(mac) >> 16) & mask;
+  while (slots[slot] >= 0) {
+    slot = (slot + 1) & mask;
+  }
+  slots[slot] = count;
+  
+  return count++;
+}
+
+int DeviceTable::find(uint64_t mac) const {
+  uint32_t mask = DEVICE_TABLE_SLOTS - 1;
+  uint32_t slot = (hashMac(mac) >> 16) & mask;
+  
+  // Table is at most half full, so the probe always reaches an empty slot
+  while (slots[slot] >= 0) {
+    if (devices[slots[slot]].mac == mac) {
+      return slots[slot];
+    }
+    slot = (slot + 1) & mask;
+  }
+  return -1;
+}
+
+bool DeviceTable::parseMac(const char* macString, uint64_t& mac) {
+  if (strlen(macString) != 12) {
+    return false;
+  }
+  
+  mac = 0;
+  for (int i = 0; i < 12; i++) {
+    char c = macString[i];
+    uint8_t nibble;
+    if (c >= '0' && c <= '9') nibble = c - '0';
+    else if (c >= 'a' && c <= 'f') nibble = c - 'a' + 10;
+    else if (c >= 'A' && c <= 'F') nibble = c - 'A' + 10;
+    else return false;
+    mac = (mac << 4) | nibble;
+  }
+  return true;
+}
+
+uint64_t DeviceTable::macFromBytes(const uint8_t* addr) {
+  uint64_t mac = 0;
+  for (int i = 5; i >= 0; i--) {
+    mac = (mac << 8) | addr[i];
+  }
+  return mac;
+}
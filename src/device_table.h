@@ -0,0 +1,87 @@
+#ifndef DEVICE_TABLE_H
+#define DEVICE_TABLE_H
+
+#include <Arduino.h>
+#include <mbedtls/aes.h>
+#include "display.h"
+#include "config.h"
+#include "time_estimator.h"
+#include "seqlock.h"
+
+// Largest manufacturer payload after the company ID (legacy advertising)
+#define ADV_PAYLOAD_MAX 29
+
+// Open-addressing index size: power of two, at least twice the device count
+#define DEVICE_TABLE_SLOTS 16
+
+// One monitored Victron device with its own key, cipher state and reading
+struct VictronDevice {
+  uint64_t mac;                   // 48-bit address, most significant byte first in text form
+  char macString[13];
+  uint8_t encryptionKey[16];
+  
+  // Cipher state kept for the lifetime of the table
+  mbedtls_aes_context aesContext;
+  bool aesReady;
+  
+  // Last decrypted packet (header + nonce + ciphertext) for duplicate detection
+  uint8_t lastPayload[ADV_PAYLOAD_MAX];
+  uint8_t lastPayloadLen;
+  
+  // Latest decoded reading; written by the decode task, read by any task
+  SeqLock<BatteryData> latest;
+  
+  // Smoothed current and counted charge behind the time estimates; decode task only
+  TimeEstimator timeEstimator;
+  
+  // The estimator's output for the latest reading, for the aggregate view on other tasks
+  SeqLock<TimeEstimate> estimate;
+  
+  // Statistics
+  uint32_t decryptCount;
+  uint32_t skippedCount;
+  uint32_t publishCount;
+};
+
+// Decoder state of one device carried across deep sleep
+struct DecoderState {
+  uint8_t lastPayload[ADV_PAYLOAD_MAX];
+  uint8_t lastPayloadLen;
+  BatteryData latest;
+  TimeEstimator timeEstimator;
+};
+
+// Fixed-capacity device table keyed by MAC. Devices are added before scanning
+// starts and the table is read-only afterwards, so the scan callback can look
+// entries up without locking. Lookup is a hashed probe, independent of the
+// number of configured devices.
+class DeviceTable {
+private:
+  VictronDevice devices[MAX_VICTRON_DEVICES];
+  int8_t slots[DEVICE_TABLE_SLOTS];
+  uint8_t count;
+  
+  static uint32_t hashMac(uint64_t mac);
+
+public:
+  DeviceTable();
+  ~DeviceTable();
+  
+  // Returns the new device index, or -1 if the table is full or the input is invalid
+  int add(const char* macString, const char* encryptionKeyHex);
+  
+  // Index of the device with this address, or -1
+  int find(uint64_t mac) const;
+  
+  uint8_t size() const { return count; }
+  VictronDevice& operator[](uint8_t index) { return devices[index]; }
+  const VictronDevice& operator[](uint8_t index) const { return devices[index]; }
+  
+  static bool parseMac(const char* macString, uint64_t& mac);
+  static uint64_t macFromBytes(const uint8_t* addr); // Little-endian controller byte order
+};
+
+static_assert(DEVICE_TABLE_SLOTS >= 2 * MAX_VICTRON_DEVICES, "device index too small");
+static_assert((DEVICE_TABLE_SLOTS & (DEVICE_TABLE_SLOTS - 1)) == 0, "device index must be a power of two");
+
+#endif // DEVICE_TABLE_H
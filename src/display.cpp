@@ -1,47 +1,176 @@
 #include "display.h"
 #include "config.h"
+#include "text_buffer.h"
+#include "alloc_counter.h"
+#include "power_manager.h"
+#include "history.h"
+#include "energy_meter.h"
+#include "deferred_log.h"
 
-Display::Display() : display(GxEPD2_290_T94_V2(EPD_CS, EPD_DC, EPD_RST, EPD_BUSY)) {
-  memset(&currentData, 0, sizeof(currentData));
-  memset(&lastDisplayedData, 0, sizeof(lastDisplayedData));
+Display::Display() : display(GxEPD2_290_T94_V2(EPD_CS, EPD_DC, EPD_RST, EPD_BUSY)),
+                     frame(GxEPD2_290_T94_V2::WIDTH, GxEPD2_290_T94_V2::HEIGHT),
+                     frameDiff(GxEPD2_290_T94_V2::WIDTH, GxEPD2_290_T94_V2::HEIGHT) {
+  memset(fieldContent, 0, sizeof(fieldContent));
 }
 
-bool Display::begin() {
+bool Display::begin(bool showSplash) {
   Serial.println("Initializing display...");
   
+  if (!powerUp(true)) {
+    return false;
+  }
+  scheduler.reset(millis());
+  
+  // Show initial screen. Without one the panel keeps its old image until the
+  // first sample, or NO DATA once FIRST_SAMPLE_WAIT_MS has passed.
+  if (showSplash) {
+    showTestScreen();
+  } else {
+    awaitingFirstSample = true;
+    beganAt = millis();
+  }
+  
+  Serial.println("Display ready");
+  return true;
+}
+
+bool Display::resume(const Snapshot& snapshot) {
+  if (!snapshot.valid || !powerUp(false)) {
+    return false;
+  }
+  
+  storeReceived(snapshot.data);
+  currentData = snapshot.data;
+  storeDisplayed(snapshot.data);
+  memcpy(viewLabel, snapshot.viewLabel, sizeof(viewLabel));
+  memcpy(fieldContent, snapshot.fieldContent, sizeof(fieldContent));
+  
+  // The panel kept its image through deep sleep but the controller lost its
+  // RAM. Redraw the same frame and load it as both current and previous
+  // image, as a full update would have left them, so the next refresh can
+  // be a partial one over the changed fields.
+  frame.fillScreen(GxEPD_WHITE);
+  frame.setTextColor(GxEPD_BLACK);
+  for (int i = 0; i < FIELD_COUNT; i++) {
+    drawField((Field)i, fieldContent[i]);
+  }
+  
+  const uint8_t* buffer = frame.getBuffer();
+  display.epd2.writeImage(buffer, 0, 0, GxEPD2_290_T94_V2::WIDTH, GxEPD2_290_T94_V2::HEIGHT);
+  display.epd2.writeImageAgain(buffer, 0, 0, GxEPD2_290_T94_V2::WIDTH, GxEPD2_290_T94_V2::HEIGHT);
+  frameDiff.commit(buffer);
+  
+  fieldsValid = true;
+  staleShown = false;
+  lastScreenUpdate = millis();
+  scheduler.reset(lastScreenUpdate);
+  scheduler.setGhostBudget(snapshot.ghost);
+  
+  Serial.println("Display resumed");
+  return true;
+}
+
+void Display::saveSnapshot(Snapshot& snapshot) const {
+  // Only the data screen can be redrawn from field text
+  snapshot.valid = isShowingData();
+  displayed.read(snapshot.data);
+  memcpy(snapshot.viewLabel, viewLabel, sizeof(snapshot.viewLabel));
+  memcpy(snapshot.fieldContent, fieldContent, sizeof(snapshot.fieldContent));
+  snapshot.ghost = scheduler.getGhostBudget();
+}
+
+bool Display::powerUp(bool initial) {
   // Power on the e-ink display
   pinMode(EPD_POWER, OUTPUT);
   digitalWrite(EPD_POWER, HIGH);
   delay(100);
   
-  // Initialize SPI and display
+  // Initialize SPI and display. Not initial: the panel content is kept and
+  // the first update may be partial.
   SPI.begin(EPD_SCK, -1, EPD_MOSI, EPD_CS);
-  display.init(115200, true, 2, false);
-  
-  // Show initial screen
-  showTestScreen();
+  display.init(115200, initial, 2, false);
   
-  Serial.println("Display ready");
+  // Shadow frame uses the panel's native layout, drawn in the same rotation as the screen
+  if (!frame.getBuffer()) {
+    Serial.println("Display: no memory for shadow frame");
+    return false;
+  }
+  frame.setRotation(1);
   return true;
 }
 
+void Display::powerOff() {
+  display.hibernate();
+  digitalWrite(EPD_POWER, LOW);
+}
+
+void Display::storeReceived(const BatteryData& data) {
+  portENTER_CRITICAL(&writeMux);
+  received.write(data);
+  portEXIT_CRITICAL(&writeMux);
+}
+
+void Display::storeDisplayed(const BatteryData& data) {
+  portENTER_CRITICAL(&writeMux);
+  displayed.write(data);
+  portEXIT_CRITICAL(&writeMux);
+}
+
 void Display::updateData(const BatteryData& data) {
-  BatteryData previousData = currentData;
-  currentData = data;
-  currentData.last_update = millis();
-  
-  if (hasSignificantChange(currentData, lastDisplayedData)) {
-    screenNeedsUpdate = true;
-    Serial.printf("Display: Significant change detected - scheduling update\n");
+  StageTimer timer(STAGE_UPDATE);
+  BatteryData sample = data;
+  if (sample.last_update == 0) {
+    sample.last_update = millis();
+  }
+  storeReceived(sample);
+  
+  BatteryData shown;
+  displayed.read(shown);
+  if (hasSignificantChange(sample, shown)) {
+    // First readings and new alarms go out at once; the rest waits to be coalesced
+    bool firstData = !graphMode && (!fieldsValid || staleShown);
+    bool newAlarm = (sample.alarms & ~shown.alarms) != 0;
+    scheduleUpdate(firstData || newAlarm);
+#if PIPELINE_METRICS
+    uint32_t detectedUs = PipelineMetrics::timestampUs();
+    portENTER_CRITICAL(&writeMux);
+    if (!latencyPending) {
+      latencyPending = true;
+      latencyReceivedAt = sample.last_update;
+      latencyDetectedUs = detectedUs;
+    }
+    portEXIT_CRITICAL(&writeMux);
+#endif
+    LOG_DEBUG("Display: Significant change detected - scheduling update\n");
   }
   
-  Serial.printf("Display: Received data - V:%.2f, Valid:%d, NeedsUpdate:%d\n", 
-                currentData.voltage, currentData.data_valid, screenNeedsUpdate);
+  LOG_DEBUG("Display: Received data - V:%.2f, Valid:%d, NeedsUpdate:%d\n",
+            sample.voltage, sample.data_valid, scheduler.isPending());
+}
+
+void Display::scheduleUpdate(bool urgent) {
+  scheduler.changed(millis(), urgent);
+}
+
+void Display::markDataFresh(unsigned long timestamp) {
+  portENTER_CRITICAL(&writeMux);
+  BatteryData data;
+  received.read(data); // No other writer can be part way through
+  data.last_update = timestamp;
+  received.write(data);
+  portEXIT_CRITICAL(&writeMux);
+}
+
+// Long times only need to be as precise as the estimate behind them: a few
+// minutes on a 20 hour figure is noise, not news
+static bool timeChanged(uint16_t newMinutes, uint16_t oldMinutes) {
+  int threshold = max(TIME_CHANGE_THRESHOLD, (int)(oldMinutes * TIME_CHANGE_FRACTION));
+  return abs((int)newMinutes - (int)oldMinutes) > threshold;
 }
 
 bool Display::hasSignificantChange(const BatteryData& newData, const BatteryData& oldData) {
   if (newData.data_valid != oldData.data_valid) {
-    Serial.println("Change: Data validity");
+    LOG_DEBUG("Change: Data validity\n");
     return true;
   }
   
@@ -50,44 +179,44 @@ bool Display::hasSignificantChange(const BatteryData& newData, const BatteryData
   }
   
   if (newData.alarms != oldData.alarms) {
-    Serial.println("Change: Alarms");
+    LOG_DEBUG("Change: Alarms\n");
     return true;
   }
   
   if (abs(newData.voltage - oldData.voltage) > VOLTAGE_CHANGE_THRESHOLD) {
-    Serial.printf("Change: Voltage %.2f -> %.2f\n", oldData.voltage, newData.voltage);
+    LOG_DEBUG("Change: Voltage %.2f -> %.2f\n", oldData.voltage, newData.voltage);
     return true;
   }
   
   if (abs(newData.current - oldData.current) > CURRENT_CHANGE_THRESHOLD) {
-    Serial.printf("Change: Current %.2f -> %.2f\n", oldData.current, newData.current);
+    LOG_DEBUG("Change: Current %.2f -> %.2f\n", oldData.current, newData.current);
     return true;
   }
   
   if (abs(newData.soc - oldData.soc) > SOC_CHANGE_THRESHOLD) {
-    Serial.printf("Change: SOC %.1f -> %.1f\n", oldData.soc, newData.soc);
+    LOG_DEBUG("Change: SOC %.1f -> %.1f\n", oldData.soc, newData.soc);
     return true;
   }
   
   if (abs(newData.power - oldData.power) > POWER_CHANGE_THRESHOLD) {
-    Serial.printf("Change: Power %.1f -> %.1f\n", oldData.power, newData.power);
+    LOG_DEBUG("Change: Power %.1f -> %.1f\n", oldData.power, newData.power);
     return true;
   }
   
   if (newData.time_calculation_valid != oldData.time_calculation_valid) {
-    Serial.println("Change: Time calculation validity");
+    LOG_DEBUG("Change: Time calculation validity\n");
     return true;
   }
   
   if (newData.time_calculation_valid) {
-    if (abs((int)newData.calculated_time_remaining_minutes - (int)oldData.calculated_time_remaining_minutes) > TIME_CHANGE_THRESHOLD) {
-      Serial.printf("Change: Time remaining %d -> %d min\n", 
-                    oldData.calculated_time_remaining_minutes, newData.calculated_time_remaining_minutes);
+    if (timeChanged(newData.calculated_time_remaining_minutes, oldData.calculated_time_remaining_minutes)) {
+      LOG_DEBUG("Change: Time remaining %d -> %d min\n",
+                oldData.calculated_time_remaining_minutes, newData.calculated_time_remaining_minutes);
       return true;
     }
-    if (abs((int)newData.calculated_time_to_full_minutes - (int)oldData.calculated_time_to_full_minutes) > TIME_CHANGE_THRESHOLD) {
-      Serial.printf("Change: Time to full %d -> %d min\n", 
-                    oldData.calculated_time_to_full_minutes, newData.calculated_time_to_full_minutes);
+    if (timeChanged(newData.calculated_time_to_full_minutes, oldData.calculated_time_to_full_minutes)) {
+      LOG_DEBUG("Change: Time to full %d -> %d min\n",
+                oldData.calculated_time_to_full_minutes, newData.calculated_time_to_full_minutes);
       return true;
     }
   }
@@ -100,7 +229,7 @@ bool Display::hasSignificantChange(const BatteryData& newData, const BatteryData
   };
   
   if (getSignalBars(newData.rssi) != getSignalBars(oldData.rssi)) {
-    Serial.printf("Change: Signal strength %d -> %d dBm\n", oldData.rssi, newData.rssi);
+    LOG_DEBUG("Change: Signal strength %d -> %d dBm\n", oldData.rssi, newData.rssi);
     return true;
   }
   
@@ -111,175 +240,547 @@ bool Display::hasSignificantChange(const BatteryData& newData, const BatteryData
   };
   
   if (getCurrentState(newData.current) != getCurrentState(oldData.current)) {
-    Serial.println("Change: Charging/discharging state");
+    LOG_DEBUG("Change: Charging/discharging state\n");
     return true;
   }
   
   if (abs(newData.consumed_ah - oldData.consumed_ah) > CONSUMED_AH_THRESHOLD) {
-    Serial.printf("Change: Consumed Ah %.1f -> %.1f\n", oldData.consumed_ah, newData.consumed_ah);
+    LOG_DEBUG("Change: Consumed Ah %.1f -> %.1f\n", oldData.consumed_ah, newData.consumed_ah);
     return true;
   }
   
   return false;
 }
 
-void Display::refresh() {
-  unsigned long currentTime = millis();
-  bool dataStale = !currentData.data_valid || currentTime - currentData.last_update > 60000;
-  bool forcePeriodicUpdate = currentTime - lastScreenUpdate > PERIODIC_REFRESH_INTERVAL;
-  bool criticalUpdate = currentData.data_valid && currentData.alarms != 0;
+// Screen area owned by each data field (rotated 296x128 coordinates)
+const Display::FieldBox Display::fieldBoxes[FIELD_COUNT] = {
+  {0, 8, 155, 36},     // FIELD_VOLTAGE
+  {155, 8, 141, 36},   // FIELD_SOC (value + battery icon)
+  {0, 46, 110, 24},    // FIELD_CURRENT
+  {110, 46, 105, 24},  // FIELD_POWER
+  {215, 46, 81, 24},   // FIELD_AGE
+  {0, 74, 195, 22},    // FIELD_TIME (TTG/TTC/state)
+  {195, 74, 101, 22},  // FIELD_SIGNAL
+  {0, 100, 175, 28},   // FIELD_USED
+  {175, 100, 121, 28}  // FIELD_ALARM (+ view label)
+};
+
+unsigned long Display::msUntilRefresh(unsigned long now) const {
+  BatteryData latest;
+  received.read(latest);
   
-  bool shouldUpdate = screenNeedsUpdate || dataStale || forcePeriodicUpdate || criticalUpdate;
+  // The graph and diagnostics screens do not show the live reading, so staleness does not apply
+  bool dataStale = showsReadings() && (!latest.data_valid || now - latest.last_update > DATA_STALE_TIMEOUT);
   
-  if (!shouldUpdate) {
-    return;
+  // Changes wait out the coalescing window and the rate limit
+  unsigned long until = scheduler.msUntilDue(now);
+  
+  if (dataStale && !staleShown) {
+    unsigned long waited = now - beganAt;
+    unsigned long staleIn = 0;
+    if (awaitingFirstSample && waited < FIRST_SAMPLE_WAIT_MS) {
+      staleIn = FIRST_SAMPLE_WAIT_MS - waited;
+    }
+    return min(until, max(staleIn, scheduler.msUntilAllowed(now)));
   }
   
-  Serial.printf("Display refresh: needsUpdate=%d, stale=%d, periodic=%d, critical=%d\n", 
-                screenNeedsUpdate, dataStale, forcePeriodicUpdate, criticalUpdate);
+  unsigned long sinceScreenUpdate = now - lastScreenUpdate;
+  unsigned long periodicIn = sinceScreenUpdate > PERIODIC_REFRESH_INTERVAL ? 0 : PERIODIC_REFRESH_INTERVAL + 1 - sinceScreenUpdate;
+  until = min(until, max(periodicIn, scheduler.msUntilAllowed(now)));
   
-  display.setRotation(1);
+  // Fresh data goes stale (and the screen to NO DATA) without any new event
+  if (!dataStale) {
+    until = min(until, DATA_STALE_TIMEOUT + 1 - (now - latest.last_update));
+  }
+  return until;
+}
+
+void Display::refresh() {
+  unsigned long currentTime = millis();
   
-  bool useFullUpdate = forcePeriodicUpdate || (currentTime - lastScreenUpdate > FULL_REFRESH_INTERVAL);
+  if (msUntilRefresh(currentTime) > 0) {
+    return;
+  }
   
-  if (useFullUpdate) {
-    display.setFullWindow();
-    Serial.println("Using full display update");
-  } else {
-    display.setPartialWindow(0, 0, 296, 128);
+  // Everything below renders this one copy. The pending change is claimed
+  // first, so one that arrives while this refresh runs stays pending for the
+  // next; at worst a change already in the copy gets a refresh that finds
+  // nothing to send.
+  bool changePending = scheduler.beginRefresh();
+  portENTER_CRITICAL(&writeMux);
+  received.read(currentData); // No writer can be part way through
+#if PIPELINE_METRICS
+  bool latencyMeasured = latencyPending;
+  unsigned long receivedAt = latencyReceivedAt;
+  uint32_t detectedUs = latencyDetectedUs;
+  latencyPending = false;
+#endif
+  portEXIT_CRITICAL(&writeMux);
+  
+  // Full clock while drawing and transferring; pushFrame lets go during panel waveforms
+  PowerLock renderLock(POWER_ACTIVITY_RENDER);
+  uint32_t renderStart = PipelineMetrics::cycles();
+#if PIPELINE_METRICS
+  if (latencyMeasured) {
+    PipelineMetrics::recordMicros(STAGE_SCHEDULE, PipelineMetrics::timestampUs() - detectedUs);
   }
+#endif
   
-  display.fillScreen(GxEPD_WHITE);
-  display.setTextColor(GxEPD_BLACK);
+  bool dataStale = showsReadings() && (!currentData.data_valid || currentTime - currentData.last_update > DATA_STALE_TIMEOUT);
+  bool forcePeriodicUpdate = currentTime - lastScreenUpdate > PERIODIC_REFRESH_INTERVAL;
   
-  if (dataStale) {
-    display.setFont(&FreeMonoBold12pt7b);
-    display.setCursor(10, 40);
-    display.print("NO DATA");
+  // Nothing below may allocate. Log through LOG_* only: the ESP32
+  // Print::printf falls back to malloc for lines over 64 characters.
+  AllocCounter::begin();
+  
+  // Full refreshes only once partial updates have used up the ghosting budget
+  bool useFullUpdate = scheduler.needsFullRefresh();
+  
+  LOG_DEBUG("Display refresh: upd=%d stale=%d periodic=%d full=%d\n",
+            changePending, dataStale, forcePeriodicUpdate, useFullUpdate);
+  
+  // Render into the shadow frame; the panel only sees what differs from the last frame sent
+  frame.setTextColor(GxEPD_BLACK);
+  
+  if (graphMode) {
+    drawGraph();
+    invalidateFields();
+    staleShown = false;
+  } else if (diagnosticsMode) {
+    drawDiagnostics();
+    invalidateFields();
+    staleShown = false;
+  } else if (dataStale) {
+    frame.fillScreen(GxEPD_WHITE);
     
-    display.setFont(&FreeMonoBold9pt7b);
-    display.setCursor(10, 70);
-    display.print("Searching...");
+    frame.setFont(&FreeMonoBold12pt7b);
+    frame.setCursor(10, 40);
+    frame.print("NO DATA");
     
-    display.setCursor(10, 95);
-    display.print("Check connection");
+    frame.setFont(&FreeMonoBold9pt7b);
+    frame.setCursor(10, 70);
+    frame.print("Searching...");
+    
+    frame.setCursor(10, 95);
+    frame.print("Check connection");
+    
+    invalidateFields();
+    staleShown = true;
   } else {
-    display.setFont(&FreeMonoBold18pt7b);
-    display.setCursor(10, 35);
-    display.print(String(currentData.voltage, 1) + "V");
+    // Work out which fields render differently from what is in the frame
+    bool redrawAll = !fieldsValid;
+    int dirtyCount = 0;
     
-    display.setCursor(160, 35);
-    display.print(String((int)currentData.soc) + "%");
+    if (redrawAll) {
+      frame.fillScreen(GxEPD_WHITE);
+    }
     
-    display.drawRect(240, 15, 40, 20, GxEPD_BLACK);
-    display.drawRect(280, 20, 4, 10, GxEPD_BLACK);
-    int fillWidth = (currentData.soc / 100.0) * 38;
-    if (fillWidth > 0) {
-      display.fillRect(241, 16, fillWidth, 18, GxEPD_BLACK);
+    for (int i = 0; i < FIELD_COUNT; i++) {
+      char content[FIELD_TEXT_MAX];
+      formatField((Field)i, currentTime, content, sizeof(content));
+      if (redrawAll || strcmp(content, fieldContent[i]) != 0) {
+        memcpy(fieldContent[i], content, sizeof(content));
+        drawField((Field)i, content);
+        dirtyCount++;
+      }
     }
     
-    display.setFont(&FreeMonoBold12pt7b);
-    display.setCursor(10, 65);
-    if (currentData.current >= 0) {
-      display.print("+" + String(currentData.current, 1) + "A");
-    } else {
-      display.print(String(currentData.current, 1) + "A");
+    fieldsValid = true;
+    staleShown = false;
+    LOG_DEBUG("Display: %d of %d fields redrawn\n", dirtyCount, FIELD_COUNT);
+  }
+  
+  storeDisplayed(currentData);
+  awaitingFirstSample = false;
+  
+  if (useFullUpdate) {
+    LOG_DEBUG("Using full display update\n");
+  }
+  
+  PipelineMetrics::recordCycles(STAGE_RENDER, renderStart);
+  
+  // Either way the panel now shows what is current
+  lastScreenUpdate = currentTime;
+  if (pushFrame(useFullUpdate)) {
+    scheduler.refreshed(currentTime, useFullUpdate, lastChangedPixels);
+#if PIPELINE_METRICS
+    if (latencyMeasured) {
+      PipelineMetrics::recordMicros(STAGE_END_TO_END, (millis() - receivedAt) * 1000UL);
+    }
+#endif
+  }
+  
+  lastFrameAllocations = AllocCounter::end();
+  if (lastFrameAllocations > 0) {
+    LOG_WARN("Display: %u heap allocations in refresh\n", lastFrameAllocations);
+  }
+}
+
+bool Display::pushFrame(bool fullUpdate) {
+  const uint8_t* buffer = frame.getBuffer();
+  const int16_t panelWidth = GxEPD2_290_T94_V2::WIDTH;
+  const int16_t panelHeight = GxEPD2_290_T94_V2::HEIGHT;
+  
+  DirtyRect rects[MAX_DIRTY_RECTS];
+  uint32_t changedPixels;
+  uint8_t rectCount = frameDiff.diff(buffer, rects, MAX_DIRTY_RECTS, changedPixels);
+  
+  lastChangedPixels = changedPixels;
+  lastBytesSent = 0;
+  uint32_t panelStart = PipelineMetrics::timestampUs();
+  
+  if (fullUpdate) {
+    display.epd2.writeImage(buffer, 0, 0, panelWidth, panelHeight);
+    PowerManager::release(POWER_ACTIVITY_RENDER);
+    display.epd2.refresh(false);
+    PowerManager::acquire(POWER_ACTIVITY_RENDER);
+    display.epd2.writeImageAgain(buffer, 0, 0, panelWidth, panelHeight);
+    lastBytesSent = 2 * frameDiff.frameBytes();
+  } else if (rectCount == 0) {
+    // Values changed but the pixels did not - nothing to send
+    skippedRefreshes++;
+    LOG_DEBUG("Display: frame unchanged, refresh skipped\n");
+    return false;
+  } else {
+    // Send only the changed rectangles, then run one partial update over their
+    // union; unchanged pixels inside it match the previous frame and do not flip
+    int16_t x0 = panelWidth, y0 = panelHeight, x1 = 0, y1 = 0;
+    for (uint8_t i = 0; i < rectCount; i++) {
+      const DirtyRect& r = rects[i];
+      display.epd2.writeImagePart(buffer, r.x, r.y, panelWidth, panelHeight, r.x, r.y, r.w, r.h);
+      lastBytesSent += (r.w / 8) * r.h;
+      x0 = min(x0, r.x);
+      y0 = min(y0, r.y);
+      x1 = max(x1, (int16_t)(r.x + r.w));
+      y1 = max(y1, (int16_t)(r.y + r.h));
     }
     
-    display.setCursor(110, 65);
-    display.print(String((int)abs(currentData.power)) + "W");
+    PowerManager::release(POWER_ACTIVITY_RENDER);
+    display.epd2.refresh(x0, y0, x1 - x0, y1 - y0);
+    PowerManager::acquire(POWER_ACTIVITY_RENDER);
     
-    display.setFont(&FreeMonoBold9pt7b);
-    display.setCursor(220, 65);
-    unsigned long timeSinceUpdate = (millis() - currentData.last_update) / 1000;
-    if (timeSinceUpdate < 60) {
-      display.print(String(timeSinceUpdate) + "s");
-    } else if (timeSinceUpdate < 3600) {
-      display.print(String(timeSinceUpdate / 60) + "m");
-    } else {
-      display.print(">1h");
+    // Controller keeps the previous frame for differential updates
+    for (uint8_t i = 0; i < rectCount; i++) {
+      const DirtyRect& r = rects[i];
+      display.epd2.writeImagePartAgain(buffer, r.x, r.y, panelWidth, panelHeight, r.x, r.y, r.w, r.h);
+    }
+    lastBytesSent *= 2;
+  }
+  
+  frameDiff.commit(buffer);
+  totalBytesSent += lastBytesSent;
+  EnergyMeter::panelRefreshed(fullUpdate);
+  
+  // Wall time: the render lock is let go during the waveform, so the clock may scale
+  PipelineMetrics::recordMicros(STAGE_PANEL, PipelineMetrics::timestampUs() - panelStart);
+  
+  LOG_DEBUG("Display: %u px changed, %u rects, %u bytes sent\n",
+            lastChangedPixels, rectCount, lastBytesSent);
+  return true;
+}
+
+// Appends "h" "m" / "min" duration text, e.g. "16h20m" or "45min"
+static void formatDuration(TextBuffer& text, uint16_t minutes) {
+  int hours = minutes / 60;
+  int mins = minutes % 60;
+  if (hours > 0) {
+    text.number(hours).character('h').number(mins).character('m');
+  } else {
+    text.number(mins).text("min");
+  }
+}
+
+void Display::formatField(Field field, unsigned long now, char* out, size_t outSize) {
+  TextBuffer text(out, outSize);
+  
+  switch (field) {
+    case FIELD_VOLTAGE:
+      text.tenths(currentData.voltage).character('V');
+      break;
+      
+    case FIELD_SOC: {
+      int fillWidth = (currentData.soc / 100.0) * 38;
+      text.number((int)currentData.soc).text("%|").number(fillWidth);
+      break;
     }
     
-    display.setFont(&FreeMonoBold9pt7b);
-    display.setCursor(10, 90);
-    
-    if (currentData.time_calculation_valid) {
-      if (currentData.current < -0.1) {
-        int hours = currentData.calculated_time_remaining_minutes / 60;
-        int mins = currentData.calculated_time_remaining_minutes % 60;
-        if (hours > 0) {
-          display.print("TTG: " + String(hours) + "h" + String(mins) + "m");
-        } else {
-          display.print("TTG: " + String(mins) + "min");
-        }
-      } else if (currentData.current > 0.1) {
-        int hours = currentData.calculated_time_to_full_minutes / 60;
-        int mins = currentData.calculated_time_to_full_minutes % 60;
-        if (hours > 0) {
-          display.print("TTC: " + String(hours) + "h" + String(mins) + "m");
-        } else {
-          display.print("TTC: " + String(mins) + "min");
-        }
+    case FIELD_CURRENT:
+      if (currentData.current >= 0) {
+        text.character('+');
+      }
+      text.tenths(currentData.current).character('A');
+      break;
+      
+    case FIELD_POWER:
+      text.number((int)abs(currentData.power)).character('W');
+      break;
+      
+    case FIELD_AGE: {
+      unsigned long timeSinceUpdate = (now - currentData.last_update) / 1000;
+      if (timeSinceUpdate < 60) {
+        text.number(timeSinceUpdate).character('s');
+      } else if (timeSinceUpdate < 3600) {
+        text.number(timeSinceUpdate / 60).character('m');
       } else {
-        display.print("IDLE");
+        text.text(">1h");
       }
-    } else {
-      if (currentData.ttg_minutes > 0 && currentData.current < -0.1) {
-        int hours = currentData.ttg_minutes / 60;
-        int mins = currentData.ttg_minutes % 60;
-        if (hours > 0) {
-          display.print("TTG: " + String(hours) + "h" + String(mins) + "m");
+      break;
+    }
+    
+    case FIELD_TIME:
+      if (currentData.time_calculation_valid) {
+        // The times follow the smoothed current, which can point the other
+        // way than this reading during a short spike
+        if (currentData.calculated_time_remaining_minutes > 0) {
+          formatDuration(text.text("TTG: "), currentData.calculated_time_remaining_minutes);
+        } else if (currentData.calculated_time_to_full_minutes > 0) {
+          formatDuration(text.text("TTC: "), currentData.calculated_time_to_full_minutes);
+        } else if (currentData.current < -0.1) {
+          formatDuration(text.text("TTG: "), currentData.calculated_time_remaining_minutes);
+        } else if (currentData.current > 0.1) {
+          formatDuration(text.text("TTC: "), currentData.calculated_time_to_full_minutes);
         } else {
-          display.print("TTG: " + String(mins) + "min");
+          text.text("IDLE");
         }
+      } else if (currentData.ttg_minutes > 0 && currentData.current < -0.1) {
+        formatDuration(text.text("TTG: "), currentData.ttg_minutes);
       } else if (currentData.current > 0.1) {
-        display.print("CHARGING");
+        text.text("CHARGING");
       } else if (currentData.current < -0.1) {
-        display.print("DISCHARGING");
+        text.text("DISCHARGING");
+      } else {
+        text.text("IDLE");
+      }
+      break;
+      
+    case FIELD_SIGNAL: {
+      int signalBars;
+      if (currentData.rssi >= -82) {
+        signalBars = 4;
+      } else if (currentData.rssi >= -85) {
+        signalBars = 3;
+      } else if (currentData.rssi >= -89) {
+        signalBars = 2;
       } else {
-        display.print("IDLE");
+        signalBars = 1;
       }
+      
+      for (int i = 0; i < 4; i++) {
+        text.character((i < signalBars) ? '|' : '.');
+      }
+      break;
     }
     
-    display.setCursor(200, 90);
-    int signalBars;
-    if (currentData.rssi >= -82) {
-      signalBars = 4;
-    } else if (currentData.rssi >= -85) {
-      signalBars = 3;
-    } else if (currentData.rssi >= -89) {
-      signalBars = 2;
+    case FIELD_USED:
+      text.text("Used: ").tenths(abs(currentData.consumed_ah)).text("Ah");
+      break;
+      
+    case FIELD_ALARM:
+      text.text(currentData.alarms != 0 ? "ALARM!" : "OK").character('|').text(viewLabel);
+      break;
+      
+    default:
+      break;
+  }
+}
+
+void Display::drawField(Field field, const char* content) {
+  const FieldBox& box = fieldBoxes[field];
+  frame.fillRect(box.x, box.y, box.w, box.h, GxEPD_WHITE);
+  
+  switch (field) {
+    case FIELD_VOLTAGE:
+      frame.setFont(&FreeMonoBold18pt7b);
+      frame.setCursor(10, 35);
+      frame.print(content);
+      break;
+      
+    case FIELD_SOC: {
+      frame.setFont(&FreeMonoBold18pt7b);
+      char soc[8];
+      TextBuffer(soc, sizeof(soc)).number((int)currentData.soc).character('%');
+      frame.setCursor(160, 35);
+      frame.print(soc);
+      
+      frame.drawRect(240, 15, 40, 20, GxEPD_BLACK);
+      frame.drawRect(280, 20, 4, 10, GxEPD_BLACK);
+      int fillWidth = (currentData.soc / 100.0) * 38;
+      if (fillWidth > 0) {
+        frame.fillRect(241, 16, fillWidth, 18, GxEPD_BLACK);
+      }
+      break;
+    }
+    
+    case FIELD_CURRENT:
+      frame.setFont(&FreeMonoBold12pt7b);
+      frame.setCursor(10, 65);
+      frame.print(content);
+      break;
+      
+    case FIELD_POWER:
+      frame.setFont(&FreeMonoBold12pt7b);
+      frame.setCursor(110, 65);
+      frame.print(content);
+      break;
+      
+    case FIELD_AGE:
+      frame.setFont(&FreeMonoBold9pt7b);
+      frame.setCursor(220, 65);
+      frame.print(content);
+      break;
+      
+    case FIELD_TIME:
+      frame.setFont(&FreeMonoBold9pt7b);
+      frame.setCursor(10, 90);
+      frame.print(content);
+      break;
+      
+    case FIELD_SIGNAL:
+      frame.setFont(&FreeMonoBold9pt7b);
+      frame.setCursor(200, 90);
+      frame.print(content);
+      break;
+      
+    case FIELD_USED:
+      frame.setFont(&FreeMonoBold9pt7b);
+      frame.setCursor(10, 115);
+      frame.print(content);
+      break;
+      
+    case FIELD_ALARM:
+      frame.setFont(&FreeMonoBold9pt7b);
+      frame.setCursor(180, 115);
+      frame.print(currentData.alarms != 0 ? "ALARM!" : "OK");
+      
+      if (viewLabel[0] != '\0') {
+        frame.setCursor(250, 115);
+        frame.print(viewLabel);
+      }
+      break;
+      
+    default:
+      break;
+  }
+}
+
+// Sparkline rows (rotated 296x128 coordinates): value on the left, one
+// column per HistoryColumn on the right, min-max bar per column
+#define GRAPH_ROW_HEIGHT 42
+#define GRAPH_X (296 - HISTORY_GRAPH_COLUMNS)
+
+void Display::drawGraph() {
+  static const char units[HISTORY_SERIES_COUNT] = {'V', 'A', '%'};
+  static const int32_t scales[HISTORY_SERIES_COUNT] = {100, 100, 10};
+  static const int32_t minSpans[HISTORY_SERIES_COUNT] = {20, 100, 50}; // 0.2 V, 1 A, 5 % - keeps noise flat
+  
+  frame.fillScreen(GxEPD_WHITE);
+  frame.setFont(&FreeMonoBold9pt7b);
+  
+  HistorySample latest;
+  if (!history || !history->getLatest(latest)) {
+    frame.setCursor(10, 70);
+    frame.print("No history yet");
+    return;
+  }
+  
+  for (int s = 0; s < HISTORY_SERIES_COUNT; s++) {
+    int16_t top = s * GRAPH_ROW_HEIGHT + 2;
+    int16_t height = GRAPH_ROW_HEIGHT - 6;
+    
+    char label[12];
+    TextBuffer text(label, sizeof(label));
+    if (s == HISTORY_SOC) {
+      text.number((long)(latest.value[s] / scales[s]));
     } else {
-      signalBars = 1;
+      text.tenths((float)latest.value[s] / scales[s]);
     }
+    text.character(units[s]);
+    frame.setCursor(0, top + height / 2 + 6);
+    frame.print(label);
     
-    for (int i = 0; i < 4; i++) {
-      if (i < signalBars) {
-        display.print("|");
-      } else {
-        display.print(".");
+    // Scale to the visible range, widened to a minimum span around its middle
+    int32_t lo = 0, hi = 0;
+    bool any = false;
+    for (uint16_t c = 0; c < HISTORY_GRAPH_COLUMNS; c++) {
+      const HistoryColumn& column = history->getColumn(c);
+      if (column.samples == 0) {
+        continue;
       }
+      lo = any ? min(lo, column.min[s]) : column.min[s];
+      hi = any ? max(hi, column.max[s]) : column.max[s];
+      any = true;
     }
+    if (hi - lo < minSpans[s]) {
+      int32_t mid = lo + (hi - lo) / 2;
+      lo = mid - minSpans[s] / 2;
+      hi = lo + minSpans[s];
+    }
+    int32_t span = hi - lo;
     
-    display.setCursor(10, 115);
-    display.print("Used: " + String(abs(currentData.consumed_ah), 1) + "Ah");
+    frame.drawFastHLine(GRAPH_X, top + height + 1, HISTORY_GRAPH_COLUMNS, GxEPD_BLACK);
     
-    display.setCursor(180, 115);
-    if (currentData.alarms != 0) {
-      display.print("ALARM!");
-    } else {
-      display.print("OK");
+    for (uint16_t c = 0; c < HISTORY_GRAPH_COLUMNS; c++) {
+      const HistoryColumn& column = history->getColumn(c);
+      if (column.samples == 0) {
+        continue;
+      }
+      int16_t yMax = top + (int16_t)((hi - column.max[s]) * (height - 1) / span);
+      int16_t yMin = top + (int16_t)((hi - column.min[s]) * (height - 1) / span);
+      frame.drawFastVLine(GRAPH_X + c, yMax, yMin - yMax + 1, GxEPD_BLACK);
     }
   }
-  
-  display.display(!useFullUpdate);
-  
-  lastDisplayedData = currentData;
-  screenNeedsUpdate = false;
-  lastScreenUpdate = currentTime;
+}
+
+// Estimated mAh/day, the average current behind it and each consumer's share
+void Display::drawDiagnostics() {
+  EnergyReport report;
+  EnergyMeter::getReport(report);
+  
+  frame.fillScreen(GxEPD_WHITE);
+  
+  char line[24];
+  TextBuffer text(line, sizeof(line));
+  text.tenths(report.mAhPerDay).text(" mAh/day");
+  frame.setFont(&FreeMonoBold12pt7b);
+  frame.setCursor(0, 24);
+  frame.print(line);
+  
+  frame.setFont(&FreeMonoBold9pt7b);
+  text = TextBuffer(line, sizeof(line));
+  text.text("avg ").tenths(report.averageMA).text("mA, ").tenths(report.hours).character('h');
+  frame.setCursor(0, 48);
+  frame.print(line);
+  
+  // mAh/day by consumer, two columns
+  for (int i = 0; i < ENERGY_CONSUMER_COUNT; i++) {
+    float perDay = report.hours > 0 ? report.mAh[i] * 24.0f / report.hours : 0.0f;
+    text = TextBuffer(line, sizeof(line));
+    text.text(EnergyMeter::consumerName((EnergyConsumer)i)).character(' ').tenths(perDay);
+    frame.setCursor(i % 2 ? 150 : 0, 74 + (i / 2) * 22);
+    frame.print(line);
+  }
+}
+
+void Display::invalidateFields() {
+  // Something other than the data screen was drawn into the shadow frame
+  fieldsValid = false;
+}
+
+void Display::sentFullScreen() {
+  // A screen drawn straight to the panel with a full refresh also clears ghosting
+  EnergyMeter::panelRefreshed(true);
+  invalidatePanel();
+  scheduler.fullScreenSent(millis());
+}
+
+void Display::invalidatePanel() {
+  // Another screen was sent directly; panel content no longer matches the last frame
+  frameDiff.invalidate();
+  staleShown = false;
 }
 
 void Display::showNoData() {
+  sentFullScreen();
   display.setRotation(1);
   display.setFullWindow();
   display.fillScreen(GxEPD_WHITE);
@@ -297,6 +798,7 @@ void Display::showNoData() {
 }
 
 void Display::showTestScreen() {
+  sentFullScreen();
   display.setRotation(1);
   display.setFullWindow();
   display.fillScreen(GxEPD_WHITE);
@@ -320,6 +822,7 @@ void Display::showTestScreen() {
 }
 
 void Display::showConfigScreen(const String& title, const String& line1, const String& line2, const String& line3, const String& line4) {
+  sentFullScreen();
   display.setRotation(1);
   display.setFullWindow();
   display.fillScreen(GxEPD_WHITE);
@@ -355,6 +858,7 @@ void Display::showConfigScreen(const String& title, const String& line1, const S
 }
 
 void Display::showSleepScreen() {
+  sentFullScreen();
   display.setRotation(1);
   display.setFullWindow();
   display.fillScreen(GxEPD_WHITE);
@@ -385,6 +889,7 @@ void Display::setBrightness(uint8_t brightness) {
 }
 
 void Display::clearScreen() {
+  sentFullScreen();
   display.setFullWindow();
   display.firstPage();
   do {
@@ -403,10 +908,48 @@ void Display::drawText(int16_t x, int16_t y, const String& text, const GFXfont*
   display.print(text);
 }
 
+void Display::setViewLabel(const char* label) {
+  if (strcmp(viewLabel, label) != 0) {
+    strncpy(viewLabel, label, sizeof(viewLabel) - 1);
+    viewLabel[sizeof(viewLabel) - 1] = '\0';
+    scheduleUpdate(true);
+  }
+}
+
+void Display::setGraphMode(bool enabled) {
+  if (graphMode != enabled) {
+    graphMode = enabled;
+    diagnosticsMode = diagnosticsMode && !enabled;
+    invalidateFields();
+    scheduleUpdate(true);
+  }
+}
+
+void Display::setDiagnosticsMode(bool enabled) {
+  if (diagnosticsMode != enabled) {
+    diagnosticsMode = enabled;
+    graphMode = graphMode && !enabled;
+    invalidateFields();
+    scheduleUpdate(true);
+  }
+}
+
+void Display::historyUpdated() {
+  // The diagnostics screen moves on with the same once-a-minute tick
+  if (graphMode || diagnosticsMode) {
+    scheduleUpdate(false);
+  }
+}
+
+void Display::requestRedraw() {
+  scheduleUpdate(true);
+}
+
 void Display::forceNextUpdate() {
   // Reset the display state to force an update on next refresh
-  memset(&lastDisplayedData, 0, sizeof(lastDisplayedData));
-  lastDisplayedData.data_valid = false;
-  screenNeedsUpdate = true;
+  storeDisplayed(BatteryData());
+  scheduleUpdate(true);
+  invalidateFields();
+  invalidatePanel();
   Serial.println("Display: Forcing next update (reset after wake from sleep)");
 } 
\ No newline at end of file
@@ -7,6 +7,12 @@
 #include <Fonts/FreeMonoBold9pt7b.h>
 #include <Fonts/FreeMonoBold12pt7b.h>
 #include <Fonts/FreeMonoBold18pt7b.h>
+#include "frame_diff.h"
+#include "refresh_scheduler.h"
+#include "pipeline_metrics.h"
+#include "seqlock.h"
+
+class History;
 
 // E-ink display pins for Vision Master E290 (from working ESPHome example)
 #define EPD_CS     3   // GPIO3 (corrected from working example)
@@ -35,24 +41,119 @@ struct BatteryData {
   uint16_t calculated_time_remaining_minutes = 0;  // Time remaining until empty (when discharging)
   uint16_t calculated_time_to_full_minutes = 0;    // Time to full charge (when charging)
   bool time_calculation_valid = false;             // Whether the time calculation is reliable
+  uint8_t time_confidence = 0;                     // 0-100: how settled the smoothed current behind it is
 };
 
 class Display {
 private:
+  // Independently refreshed areas of the data screen
+  enum Field {
+    FIELD_VOLTAGE,
+    FIELD_SOC,
+    FIELD_CURRENT,
+    FIELD_POWER,
+    FIELD_AGE,
+    FIELD_TIME,
+    FIELD_SIGNAL,
+    FIELD_USED,
+    FIELD_ALARM,
+    FIELD_COUNT
+  };
+  
+  struct FieldBox {
+    int16_t x, y, w, h;
+  };
+  
+  static const FieldBox fieldBoxes[FIELD_COUNT];
+  
+  
   GxEPD2_BW<GxEPD2_290_T94_V2, GxEPD2_290_T94_V2::HEIGHT> display;
-  BatteryData currentData;
-  BatteryData lastDisplayedData;
+  GFXcanvas1 frame;      // Next data frame, 1bpp in panel-native layout
+  FrameDiff frameDiff;   // Last frame sent to the panel
+  
+  // Readings cross tasks through seqlocks: the decode task (and a view change
+  // on the main loop) stores into received, refresh() copies it into
+  // currentData and renders from that, and change detection on the decode
+  // task compares new readings with displayed. Readers never wait for a
+  // writer; writes to either go through writeMux, which makes writers take
+  // turns and keeps a reader on the same core from preempting a write half
+  // way and spinning on it.
+  SeqLock<BatteryData> received;
+  BatteryData currentData;            // Main loop only
+  SeqLock<BatteryData> displayed;
+  portMUX_TYPE writeMux = portMUX_INITIALIZER_UNLOCKED;
   unsigned long lastScreenUpdate = 0;
-  bool screenNeedsUpdate = false;
+  RefreshScheduler scheduler; // When to refresh, coalescing and ghosting budget
+  char viewLabel[8] = ""; // Which device (or "ALL") is shown, empty with a single device
+  
+  // What each field currently shows on the panel
+  static const size_t FIELD_TEXT_MAX = 24;
+  char fieldContent[FIELD_COUNT][FIELD_TEXT_MAX];
+  bool fieldsValid = false;
+  bool staleShown = false; // NO DATA screen is on the panel; redrawing it changes nothing
+  bool awaitingFirstSample = false; // Started without a splash screen; NO DATA held back for a while
+  unsigned long beganAt = 0;
+  
+  // Sparkline screen in place of the readings
+  const History* history = nullptr;
+  bool graphMode = false;
+  
+  // Self-consumption estimate in place of the readings
+  bool diagnosticsMode = false;
+  
+  // Frame transfer statistics
+  uint32_t lastChangedPixels = 0;
+  uint32_t lastBytesSent = 0;
+  uint32_t totalBytesSent = 0;
+  uint32_t skippedRefreshes = 0;
+  uint32_t lastFrameAllocations = 0;
+  
+#if PIPELINE_METRICS
+  // Oldest reading waiting for a refresh, for the schedule and end-to-end
+  // stages. Set by the decode task, taken by refresh(), both under writeMux.
+  bool latencyPending = false;
+  unsigned long latencyReceivedAt = 0; // Reading's radio timestamp, millis()
+  uint32_t latencyDetectedUs = 0;      // When updateData saw the change
+#endif
   
   // Change detection method
   bool hasSignificantChange(const BatteryData& newData, const BatteryData& oldData);
+  
+  bool powerUp(bool initial);
+  void scheduleUpdate(bool urgent);
+  void sentFullScreen();
+  
+  // Dirty-region rendering
+  void formatField(Field field, unsigned long now, char* out, size_t outSize);
+  void drawField(Field field, const char* content);
+  void invalidateFields();
+  void invalidatePanel();
+  void storeReceived(const BatteryData& data);
+  void storeDisplayed(const BatteryData& data);
+  bool pushFrame(bool fullUpdate);
+  void drawGraph();
+  void drawDiagnostics();
+  bool showsReadings() const { return !graphMode && !diagnosticsMode; }
 
 public:
+  // What the data screen shows, enough to redraw it exactly after deep sleep
+  struct Snapshot {
+    BatteryData data;
+    char viewLabel[8];
+    char fieldContent[FIELD_COUNT][FIELD_TEXT_MAX];
+    GhostBudget ghost;
+    bool valid;
+  };
+  
   Display();
-  bool begin();
-  void updateData(const BatteryData& data);
+  bool begin(bool showSplash = true);
+  bool resume(const Snapshot& snapshot); // begin() for a panel still showing the snapshot; no refresh
+  void saveSnapshot(Snapshot& snapshot) const;
+  void powerOff();
+  void updateData(const BatteryData& data);    // Any task; never waits for a refresh
+  void markDataFresh(unsigned long timestamp); // Same reading received again - keep it from going stale
   void refresh();
+  unsigned long msUntilRefresh(unsigned long now) const; // 0 = refresh() has something to draw now
   void showNoData();
   void showTestScreen();
   void showConfigScreen(const String& title, const String& line1 = "", const String& line2 = "", const String& line3 = "", const String& line4 = "");
@@ -61,11 +162,30 @@ public:
   void clearScreen();
   void drawText(int16_t x, int16_t y, const String& text, const GFXfont* font = nullptr);
   void forceNextUpdate(); // Force the next refresh to update display
+  void requestRedraw();   // Render on the next refresh; only changed pixels reach the panel
+  void setViewLabel(const char* label);
+  
+  // Graph screen: voltage, current and SOC sparklines from the history ring
+  void setHistory(const History* h) { history = h; }
+  void setGraphMode(bool enabled);
+  bool isGraphMode() const { return graphMode; }
+  void historyUpdated(); // A sample was added; redraws the graph or diagnostics screen if shown
+  
+  // Diagnostics screen: the gauge's own estimated consumption (EnergyMeter)
+  void setDiagnosticsMode(bool enabled);
+  bool isDiagnosticsMode() const { return diagnosticsMode; }
   
   // Status information
-  bool isUpdatePending() const { return screenNeedsUpdate; }
+  bool isUpdatePending() const { return scheduler.isPending(); }
+  bool isShowingData() const { return fieldsValid && frameDiff.isValid() && !staleShown; }
   unsigned long getLastUpdateTime() const { return lastScreenUpdate; }
   unsigned long getTimeSinceLastUpdate() const { return millis() - lastScreenUpdate; }
+  uint32_t getLastChangedPixels() const { return lastChangedPixels; }
+  uint32_t getLastBytesSent() const { return lastBytesSent; }
+  uint32_t getTotalBytesSent() const { return totalBytesSent; }
+  uint32_t getSkippedRefreshCount() const { return skippedRefreshes; }
+  uint32_t getLastFrameAllocations() const { return lastFrameAllocations; } // Heap allocations in the last refresh
+  void getRefreshStats(RefreshStats& stats) const { scheduler.getStats(millis(), stats); }
 };
 
 #endif // DISPLAY_H 
\ No newline at end of file
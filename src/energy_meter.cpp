@@ -0,0 +1,129 @@
+#include "energy_meter.h"
+#include "power_manager.h"
+#include "esp_timer.h"
+
+static const char* const consumerNames[ENERGY_CONSUMER_COUNT] = {"cpu", "radio", "panel", "wifi", "board"};
+
+static portMUX_TYPE energyMux = portMUX_INITIALIZER_UNLOCKED;
+static int64_t startUs = 0;           // Start of the estimate: boot, or the last reset()
+static int64_t activeBaseUs = 0;      // CPU active time before that
+static bool scanning = false;
+static int64_t scanSince = 0;
+static int64_t scanUs = 0;
+static bool accessPointUp = false;
+static int64_t accessPointSince = 0;
+static int64_t accessPointUs = 0;
+static uint32_t fullRefreshes = 0;
+static uint32_t partialRefreshes = 0;
+
+void EnergyMeter::setScanning(bool on) {
+  int64_t now = esp_timer_get_time();
+  portENTER_CRITICAL(&energyMux);
+  if (on && !scanning) {
+    scanSince = now;
+  } else if (!on && scanning) {
+    scanUs += now - scanSince;
+  }
+  scanning = on;
+  portEXIT_CRITICAL(&energyMux);
+}
+
+void EnergyMeter::setAccessPoint(bool up) {
+  int64_t now = esp_timer_get_time();
+  portENTER_CRITICAL(&energyMux);
+  if (up && !accessPointUp) {
+    accessPointSince = now;
+  } else if (!up && accessPointUp) {
+    accessPointUs += now - accessPointSince;
+  }
+  accessPointUp = up;
+  portEXIT_CRITICAL(&energyMux);
+}
+
+void EnergyMeter::panelRefreshed(bool full) {
+  portENTER_CRITICAL(&energyMux);
+  if (full) {
+    fullRefreshes++;
+  } else {
+    partialRefreshes++;
+  }
+  portEXIT_CRITICAL(&energyMux);
+}
+
+void EnergyMeter::getReport(EnergyReport& report) {
+  memset(&report, 0, sizeof(report));
+
+  int64_t now = esp_timer_get_time();
+  portENTER_CRITICAL(&energyMux);
+  int64_t scanTotal = scanUs + (scanning ? now - scanSince : 0);
+  int64_t accessPointTotal = accessPointUs + (accessPointUp ? now - accessPointSince : 0);
+  int64_t elapsedUs = now - startUs;
+  int64_t activeBase = activeBaseUs;
+  report.fullRefreshes = fullRefreshes;
+  report.partialRefreshes = partialRefreshes;
+  portEXIT_CRITICAL(&energyMux);
+
+  float seconds = elapsedUs / 1e6f;
+  if (seconds <= 0) {
+    return;
+  }
+  report.hours = seconds / 3600.0f;
+  report.cpuActiveSeconds = min((PowerManager::getActiveMicros() - activeBase) / 1e6f, seconds);
+  report.scanSeconds = scanTotal / 1e6f;
+  report.accessPointSeconds = accessPointTotal / 1e6f;
+
+#if POWER_MANAGEMENT
+  float idleMA = PowerManager::isLightSleepEnabled() ? ENERGY_CPU_LIGHT_SLEEP_MA : ENERGY_CPU_IDLE_MIN_MA;
+#else
+  float idleMA = ENERGY_CPU_IDLE_MAX_MA;
+#endif
+
+  // Charge in mA*s, then mAh
+  float charge[ENERGY_CONSUMER_COUNT];
+  charge[ENERGY_CPU] = report.cpuActiveSeconds * ENERGY_CPU_ACTIVE_MA +
+                       (seconds - report.cpuActiveSeconds) * idleMA;
+  charge[ENERGY_RADIO] = report.scanSeconds * ENERGY_RADIO_RX_MA * BLE_SCAN_WINDOW_MS / BLE_SCAN_INTERVAL_MS;
+  charge[ENERGY_PANEL] = report.fullRefreshes * ENERGY_EPD_FULL_MAS + report.partialRefreshes * ENERGY_EPD_PARTIAL_MAS;
+  charge[ENERGY_WIFI] = report.accessPointSeconds * ENERGY_WIFI_AP_MA;
+  charge[ENERGY_BOARD] = seconds * ENERGY_BOARD_MA;
+
+  for (int i = 0; i < ENERGY_CONSUMER_COUNT; i++) {
+    report.mAh[i] = charge[i] / 3600.0f;
+    report.totalMAh += report.mAh[i];
+  }
+  report.averageMA = report.totalMAh / report.hours;
+  report.mAhPerDay = report.averageMA * 24.0f;
+}
+
+void EnergyMeter::reset() {
+  int64_t activeUs = PowerManager::getActiveMicros();
+  int64_t now = esp_timer_get_time();
+  portENTER_CRITICAL(&energyMux);
+  startUs = now;
+  activeBaseUs = activeUs;
+  scanning = false;
+  scanUs = 0;
+  accessPointUp = false;
+  accessPointUs = 0;
+  fullRefreshes = 0;
+  partialRefreshes = 0;
+  portEXIT_CRITICAL(&energyMux);
+}
+
+const char* EnergyMeter::consumerName(EnergyConsumer consumer) {
+  return consumerNames[consumer];
+}
+
+void EnergyMeter::print() {
+  EnergyReport report;
+  getReport(report);
+  if (report.totalMAh <= 0) {
+    return;
+  }
+  Serial.printf("Energy: %.1f mAh/day (%.2f mA average over %.1f h)", report.mAhPerDay, report.averageMA,
+                report.hours);
+  for (int i = 0; i < ENERGY_CONSUMER_COUNT; i++) {
+    Serial.printf(", %s %.0f%%", consumerNames[i], report.mAh[i] * 100.0f / report.totalMAh);
+  }
+  Serial.println();
+}
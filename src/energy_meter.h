@@ -0,0 +1,53 @@
+#ifndef ENERGY_METER_H
+#define ENERGY_METER_H
+
+#include <Arduino.h>
+#include "config.h"
+
+// What the gauge spends its own charge on
+enum EnergyConsumer {
+  ENERGY_CPU,      // Active and idle (or light sleep) time
+  ENERGY_RADIO,    // BLE receiver, scan window / interval of the time scanning
+  ENERGY_PANEL,    // Full and partial e-ink refreshes
+  ENERGY_WIFI,     // Config portal access point uptime
+  ENERGY_BOARD,    // Everything else, always on
+  ENERGY_CONSUMER_COUNT
+};
+
+// Estimate since boot, or since the last reset()
+struct EnergyReport {
+  float hours;                          // Time covered
+  float mAh[ENERGY_CONSUMER_COUNT];
+  float totalMAh;
+  float averageMA;
+  float mAhPerDay;                      // totalMAh projected to 24 hours
+  float cpuActiveSeconds;
+  float scanSeconds;
+  float accessPointSeconds;
+  uint32_t fullRefreshes;
+  uint32_t partialRefreshes;
+};
+
+// Self-consumption accounting: the time each consumer is on, times the
+// ENERGY_* current coefficients for the board. The modules that switch a
+// consumer report it here; CPU active time comes from the power manager's
+// lock hold times (none are taken without POWER_MANAGEMENT, so there all
+// time is charged at the full-clock idle current). Any task may report; a
+// spinlock keeps the totals consistent.
+namespace EnergyMeter {
+  void setScanning(bool scanning);
+  void setAccessPoint(bool up);
+  void panelRefreshed(bool full);
+
+  void getReport(EnergyReport& report);
+  
+  // Starts the estimate over from now, consumers off. For the host sims, so a
+  // screen built from the report does not depend on what ran before it.
+  void reset();
+  const char* consumerName(EnergyConsumer consumer);
+
+  // One line: mAh/day and the share of each consumer
+  void print();
+}
+
+#endif // ENERGY_METER_H
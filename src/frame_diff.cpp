@@ -0,0 +1,139 @@
+#include "frame_diff.h"
+
+// Changed byte runs closer than this are merged into one span, and spans on
+// rows closer than this join the same rectangle. Text leaves blank columns
+// between glyphs; without merging each glyph would become its own window.
+#define MERGE_GAP_BYTES 2
+#define MERGE_GAP_ROWS 8
+
+FrameDiff::FrameDiff(uint16_t width, uint16_t height)
+  : width(width), height(height), rowBytes((width + 7) / 8), valid(false) {
+  previous = new uint8_t[frameBytes()];
+  memset(previous, 0xFF, frameBytes());
+}
+
+FrameDiff::~FrameDiff() {
+  delete[] previous;
+}
+
+uint8_t FrameDiff::diff(const uint8_t* next, DirtyRect* rects, uint8_t maxRects, uint32_t& changedPixels) const {
+  changedPixels = 0;
+
+  if (maxRects == 0) {
+    return 0;
+  }
+
+  if (!valid) {
+    rects[0].x = 0;
+    rects[0].y = 0;
+    rects[0].w = rowBytes * 8;
+    rects[0].h = height;
+    changedPixels = (uint32_t)width * height;
+    return 1;
+  }
+
+  uint8_t count = 0;
+
+  for (int16_t row = 0; row < height; row++) {
+    const uint8_t* a = previous + (size_t)row * rowBytes;
+    const uint8_t* b = next + (size_t)row * rowBytes;
+    int16_t spanStart = -1;
+    int16_t spanEnd = -1;
+
+    for (int16_t col = 0; col < rowBytes; ) {
+      int16_t chunk = rowBytes - col >= 4 ? 4 : 1;
+
+      // Compare a 32-bit word at a time; only differing words are looked into
+      uint32_t wordA = 0;
+      uint32_t wordB = 0;
+      memcpy(&wordA, a + col, chunk);
+      memcpy(&wordB, b + col, chunk);
+      if (wordA == wordB) {
+        col += chunk;
+        continue;
+      }
+      changedPixels += __builtin_popcount(wordA ^ wordB);
+
+      for (int16_t k = col; k < col + chunk; k++) {
+        if (a[k] == b[k]) continue;
+        if (spanStart >= 0 && k - spanEnd <= MERGE_GAP_BYTES + 1) {
+          spanEnd = k;
+        } else {
+          if (spanStart >= 0) {
+            addSpan(rects, count, maxRects, row, spanStart, spanEnd);
+          }
+          spanStart = k;
+          spanEnd = k;
+        }
+      }
+      col += chunk;
+    }
+
+    if (spanStart >= 0) {
+      addSpan(rects, count, maxRects, row, spanStart, spanEnd);
+    }
+  }
+
+  return count;
+}
+
+void FrameDiff::addSpan(DirtyRect* rects, uint8_t& count, uint8_t maxRects, int16_t row,
+                        int16_t firstByte, int16_t lastByte) {
+  int16_t spanX0 = firstByte * 8;
+  int16_t spanX1 = (lastByte + 1) * 8;
+
+  // Extend a rectangle that ended just above and overlaps horizontally
+  for (uint8_t i = 0; i < count; i++) {
+    DirtyRect& r = rects[i];
+    bool nearRow = row - (r.y + r.h) <= MERGE_GAP_ROWS;
+    bool overlaps = spanX0 <= r.x + r.w + MERGE_GAP_BYTES * 8 && spanX1 >= r.x - MERGE_GAP_BYTES * 8;
+    if (nearRow && overlaps) {
+      int16_t x0 = min(r.x, spanX0);
+      int16_t x1 = max((int16_t)(r.x + r.w), spanX1);
+      r.x = x0;
+      r.w = x1 - x0;
+      r.h = row - r.y + 1;
+      return;
+    }
+  }
+
+  if (count < maxRects) {
+    DirtyRect& r = rects[count++];
+    r.x = spanX0;
+    r.y = row;
+    r.w = spanX1 - spanX0;
+    r.h = 1;
+    return;
+  }
+
+  // Out of rectangles: grow whichever one gains the least area
+  uint8_t best = 0;
+  int32_t bestGrowth = INT32_MAX;
+  for (uint8_t i = 0; i < count; i++) {
+    const DirtyRect& r = rects[i];
+    int32_t x0 = min(r.x, spanX0);
+    int32_t x1 = max((int16_t)(r.x + r.w), spanX1);
+    int32_t y0 = min(r.y, row);
+    int32_t y1 = max((int16_t)(r.y + r.h), (int16_t)(row + 1));
+    int32_t growth = (x1 - x0) * (y1 - y0) - (int32_t)r.w * r.h;
+    if (growth < bestGrowth) {
+      bestGrowth = growth;
+      best = i;
+    }
+  }
+
+  DirtyRect& r = rects[best];
+  int16_t x0 = min(r.x, spanX0);
+  int16_t x1 = max((int16_t)(r.x + r.w), spanX1);
+  int16_t y0 = min(r.y, row);
+  int16_t y1 = max((int16_t)(r.y + r.h), (int16_t)(row + 1));
+  r.x = x0;
+  r.y = y0;
+  r.w = x1 - x0;
+  r.h = y1 - y0;
+}
+
+void FrameDiff::commit(const uint8_t* next) {
+  memcpy(previous, next, frameBytes());
+  valid = true;
+}
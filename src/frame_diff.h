@@ -0,0 +1,45 @@
+#ifndef FRAME_DIFF_H
+#define FRAME_DIFF_H
+
+#include <Arduino.h>
+
+// Rectangle in native panel coordinates; x and w are multiples of 8 so each
+// row of the rectangle is a whole number of frame buffer bytes
+struct DirtyRect {
+  int16_t x, y, w, h;
+};
+
+// Keeps a copy of the last frame sent to the panel and reports which byte-aligned
+// rectangles of a new 1bpp frame differ from it. Frames are in the panel's native
+// layout: rows of width/8 bytes, MSB first.
+class FrameDiff {
+private:
+  uint16_t width;
+  uint16_t height;
+  uint16_t rowBytes;
+  uint8_t* previous;
+  bool valid;
+
+  static void addSpan(DirtyRect* rects, uint8_t& count, uint8_t maxRects, int16_t row,
+                      int16_t firstByte, int16_t lastByte);
+
+public:
+  FrameDiff(uint16_t width, uint16_t height);
+  ~FrameDiff();
+
+  // Rectangles where next differs from the last committed frame. Returns the
+  // number written to rects (0 = identical). Without a committed frame the
+  // whole screen is reported.
+  uint8_t diff(const uint8_t* next, DirtyRect* rects, uint8_t maxRects, uint32_t& changedPixels) const;
+
+  // Record next as what the panel now shows
+  void commit(const uint8_t* next);
+
+  // Panel content is unknown (another screen was drawn directly)
+  void invalidate() { valid = false; }
+  bool isValid() const { return valid; }
+
+  size_t frameBytes() const { return (size_t)rowBytes * height; }
+};
+
+#endif // FRAME_DIFF_H
@@ -0,0 +1,218 @@
+#include "history.h"
+
+// Longest record: slot gap plus one delta per series, 5 bytes each as varints
+#define HISTORY_RECORD_MAX (5 * (1 + HISTORY_SERIES_COUNT))
+
+static uint8_t* putVarint(uint8_t* p, uint32_t value) {
+  while (value >= 0x80) {
+    *p++ = (uint8_t)(value | 0x80);
+    value >>= 7;
+  }
+  *p++ = (uint8_t)value;
+  return p;
+}
+
+static const uint8_t* getVarint(const uint8_t* p, uint32_t& value) {
+  value = 0;
+  for (int shift = 0; shift < 35; shift += 7) {
+    uint8_t b = *p++;
+    value |= (uint32_t)(b & 0x7F) << shift;
+    if (!(b & 0x80)) {
+      break;
+    }
+  }
+  return p;
+}
+
+// Small deltas of either sign become small unsigned numbers
+static uint32_t zigzag(int32_t value) {
+  return ((uint32_t)value << 1) ^ (uint32_t)(value >> 31);
+}
+
+static int32_t unzigzag(uint32_t value) {
+  return (int32_t)(value >> 1) ^ -(int32_t)(value & 1);
+}
+
+static int32_t toFixed(float value, float scale) {
+  return (int32_t)lroundf(value * scale);
+}
+
+History::History()
+  : blocks(nullptr), blockCount(0), newestBlock(0), usedBlocks(0), sampleCount(0),
+    nextInterval(0), slotStart(0), hasLatest(false), newestColumn(0), newestColumnId(0) {
+  memset(&latest, 0, sizeof(latest));
+  memset(columns, 0, sizeof(columns));
+}
+
+History::~History() {
+  free(blocks);
+}
+
+bool History::begin() {
+  blockCount = HISTORY_BYTES / sizeof(Block);
+  
+#ifdef ARDUINO_ARCH_ESP32
+  if (psramFound()) {
+    blocks = (Block*)ps_malloc(blockCount * sizeof(Block));
+  }
+#endif
+  if (!blocks) {
+    blocks = (Block*)malloc(blockCount * sizeof(Block));
+  }
+  if (!blocks) {
+    Serial.println("History: no memory");
+    blockCount = 0;
+    return false;
+  }
+  
+  // First sample is due right away
+  slotStart = millis() - HISTORY_INTERVAL_MS;
+  
+  Serial.printf("History: %u bytes, %u s per sample\n", (unsigned)getCapacity(), HISTORY_INTERVAL_MS / 1000);
+  return true;
+}
+
+unsigned long History::msUntilDue(unsigned long now) const {
+  unsigned long elapsed = now - slotStart;
+  return elapsed >= HISTORY_INTERVAL_MS ? 0 : HISTORY_INTERVAL_MS - elapsed;
+}
+
+void History::record(const BatteryData& data, unsigned long now) {
+  unsigned long elapsed = now - slotStart;
+  if (!blocks || elapsed < HISTORY_INTERVAL_MS) {
+    return;
+  }
+  
+  // Late calls skip the slots they missed rather than filling them
+  uint32_t slots = elapsed / HISTORY_INTERVAL_MS;
+  slotStart += slots * HISTORY_INTERVAL_MS;
+  uint32_t interval = nextInterval + slots - 1;
+  nextInterval += slots;
+  
+  if (!data.data_valid || now - data.last_update > DATA_STALE_TIMEOUT) {
+    return;
+  }
+  
+  HistorySample sample;
+  sample.interval = interval;
+  sample.value[HISTORY_VOLTAGE] = toFixed(data.voltage, 100.0f);
+  sample.value[HISTORY_CURRENT] = toFixed(data.current, 100.0f);
+  sample.value[HISTORY_SOC] = toFixed(data.soc, 10.0f);
+  
+  append(sample);
+  addToColumns(sample);
+  latest = sample;
+  hasLatest = true;
+}
+
+void History::append(const HistorySample& sample) {
+  Block* block = usedBlocks > 0 ? &blocks[newestBlock] : nullptr;
+  
+  if (block && block->used + HISTORY_RECORD_MAX <= HISTORY_BLOCK_BYTES) {
+    uint8_t* start = block->data + block->used;
+    uint8_t* p = putVarint(start, sample.interval - latest.interval);
+    for (int s = 0; s < HISTORY_SERIES_COUNT; s++) {
+      p = putVarint(p, zigzag(sample.value[s] - latest.value[s]));
+    }
+    block->used += p - start;
+    block->samples++;
+    sampleCount++;
+    return;
+  }
+  
+  // Start a new block, dropping the oldest when the ring is full
+  if (usedBlocks > 0) {
+    newestBlock = (newestBlock + 1) % blockCount;
+  }
+  block = &blocks[newestBlock];
+  if (usedBlocks == blockCount) {
+    sampleCount -= block->samples;
+  } else {
+    usedBlocks++;
+  }
+  
+  block->firstInterval = sample.interval;
+  memcpy(block->first, sample.value, sizeof(block->first));
+  block->samples = 1;
+  block->used = 0;
+  sampleCount++;
+}
+
+void History::addToColumns(const HistorySample& sample) {
+  uint32_t columnId = sample.interval / HISTORY_COLUMN_SAMPLES;
+  
+  if (!hasLatest || columnId > newestColumnId) {
+    // Scroll: columns passed over without samples become gaps
+    uint32_t advance = hasLatest ? columnId - newestColumnId : HISTORY_GRAPH_COLUMNS;
+    if (advance > HISTORY_GRAPH_COLUMNS) {
+      advance = HISTORY_GRAPH_COLUMNS;
+    }
+    for (uint32_t i = 0; i < advance; i++) {
+      newestColumn = (newestColumn + 1) % HISTORY_GRAPH_COLUMNS;
+      columns[newestColumn].samples = 0;
+    }
+    newestColumnId = columnId;
+  }
+  
+  HistoryColumn& column = columns[newestColumn];
+  for (int s = 0; s < HISTORY_SERIES_COUNT; s++) {
+    if (column.samples == 0 || sample.value[s] < column.min[s]) {
+      column.min[s] = sample.value[s];
+    }
+    if (column.samples == 0 || sample.value[s] > column.max[s]) {
+      column.max[s] = sample.value[s];
+    }
+  }
+  column.samples++;
+}
+
+bool History::getLatest(HistorySample& sample) const {
+  sample = latest;
+  return hasLatest;
+}
+
+const HistoryColumn& History::getColumn(uint16_t index) const {
+  return columns[(newestColumn + 1 + index) % HISTORY_GRAPH_COLUMNS];
+}
+
+size_t History::getBytesUsed() const {
+  size_t bytes = 0;
+  for (uint16_t i = 0; i < usedBlocks; i++) {
+    bytes += sizeof(Block) - HISTORY_BLOCK_BYTES + blocks[(newestBlock + blockCount - i) % blockCount].used;
+  }
+  return bytes;
+}
+
+History::Reader::Reader(const History& h)
+  : history(h), blocksLeft(h.usedBlocks), samplesLeft(0), pos(nullptr) {
+  block = h.usedBlocks > 0 ? (h.newestBlock + h.blockCount + 1 - h.usedBlocks) % h.blockCount : 0;
+  memset(&current, 0, sizeof(current));
+}
+
+bool History::Reader::next(HistorySample& sample) {
+  if (samplesLeft == 0) {
+    if (blocksLeft == 0) {
+      return false;
+    }
+    const Block& b = history.blocks[block];
+    current.interval = b.firstInterval;
+    memcpy(current.value, b.first, sizeof(current.value));
+    samplesLeft = b.samples - 1;
+    pos = b.data;
+    block = (block + 1) % history.blockCount;
+    blocksLeft--;
+    sample = current;
+    return true;
+  }
+  
+  uint32_t raw;
+  pos = getVarint(pos, raw);
+  current.interval += raw;
+  for (int s = 0; s < HISTORY_SERIES_COUNT; s++) {
+    pos = getVarint(pos, raw);
+    current.value[s] += unzigzag(raw);
+  }
+  samplesLeft--;
+  sample = current;
+  return true;
+}
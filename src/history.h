@@ -0,0 +1,101 @@
+#ifndef HISTORY_H
+#define HISTORY_H
+
+#include <Arduino.h>
+#include "config.h"
+#include "display.h"
+
+enum HistorySeries {
+  HISTORY_VOLTAGE,   // Centivolts
+  HISTORY_CURRENT,   // Centiamps, negative when discharging
+  HISTORY_SOC,       // Tenths of a percent
+  HISTORY_SERIES_COUNT
+};
+
+// One sample in fixed point
+struct HistorySample {
+  uint32_t interval;                    // Sample slot since boot, HISTORY_INTERVAL_MS each
+  int32_t value[HISTORY_SERIES_COUNT];
+};
+
+// Range of the samples that fall into one sparkline column
+struct HistoryColumn {
+  int32_t min[HISTORY_SERIES_COUNT];
+  int32_t max[HISTORY_SERIES_COUNT];
+  uint16_t samples;                     // 0 = no data in this column
+};
+
+// Fixed-memory history of battery readings, one sample per HISTORY_INTERVAL_MS.
+// Samples are stored as varint-coded deltas in blocks that each start with
+// an absolute keyframe, so the oldest block can be dropped when the ring is
+// full and any block decodes on its own. Gaps (no fresh data) cost nothing.
+//
+// The sparkline columns for the graph screen are kept up to date as samples
+// arrive, so drawing a graph never decodes the ring.
+class History {
+private:
+  struct Block {
+    uint32_t firstInterval;
+    int32_t first[HISTORY_SERIES_COUNT];  // Keyframe: the first sample in full
+    uint16_t samples;                     // Including the keyframe; 0 = unused
+    uint16_t used;                        // Delta bytes in data
+    uint8_t data[HISTORY_BLOCK_BYTES];
+  };
+  
+  Block* blocks;
+  uint16_t blockCount;
+  uint16_t newestBlock;
+  uint16_t usedBlocks;
+  uint32_t sampleCount;
+  
+  // Sample slot clock, advanced in whole intervals so it never drifts or wraps with millis()
+  uint32_t nextInterval;
+  unsigned long slotStart;
+  
+  HistorySample latest;
+  bool hasLatest;
+  
+  HistoryColumn columns[HISTORY_GRAPH_COLUMNS];
+  uint16_t newestColumn;
+  uint32_t newestColumnId;
+  
+  void append(const HistorySample& sample);
+  void addToColumns(const HistorySample& sample);
+
+public:
+  class Reader {
+  private:
+    const History& history;
+    uint16_t block;
+    uint16_t blocksLeft;
+    uint16_t samplesLeft;
+    const uint8_t* pos;
+    HistorySample current;
+  
+  public:
+    explicit Reader(const History& h);
+    bool next(HistorySample& sample); // Oldest first; false after the newest
+  };
+  
+  History();
+  ~History();
+  
+  // Allocates the ring, from PSRAM when the board has it
+  bool begin();
+  
+  // Takes a sample when an interval has passed; invalid or stale readings leave a gap
+  void record(const BatteryData& data, unsigned long now);
+  unsigned long msUntilDue(unsigned long now) const;
+  
+  bool getLatest(HistorySample& sample) const;
+  
+  // Graph columns, oldest first; each covers HISTORY_COLUMN_SAMPLES intervals
+  const HistoryColumn& getColumn(uint16_t index) const;
+  
+  // Storage statistics
+  uint32_t getSampleCount() const { return sampleCount; }
+  size_t getBytesUsed() const;
+  size_t getCapacity() const { return (size_t)blockCount * sizeof(Block); }
+};
+
+#endif // HISTORY_H
@@ -0,0 +1,165 @@
+#ifndef LOG_FORMAT_H
+#define LOG_FORMAT_H
+
+// On-flash sample log format, shared by the firmware and the host tools
+// (tools/log_reader). No Arduino dependencies.
+//
+// A log is a sequence of frames, each
+//   sync (0xA5) | length (payload bytes) | payload | CRC-32 of length + payload
+// with the payload a little-endian LogRecord. Frames are appended and never
+// rewritten. A reader that meets a bad frame moves on one byte and looks
+// for the next sync byte, so a damaged region costs only the records in it.
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+#define LOG_FRAME_SYNC 0xA5
+
+struct __attribute__((packed)) LogRecord {
+  uint32_t seq;              // Increments by one per record, across reboots
+  uint32_t time;             // System clock seconds; runs through deep sleep, restarts at power-on
+  uint16_t boot;             // Power-on count; tells clock restarts apart
+  int16_t socTenths;
+  int32_t centivolts;
+  int32_t centiamps;         // Negative when discharging
+  int32_t consumedCentiAh;
+};
+
+static_assert(sizeof(LogRecord) == 24, "log record layout changed");
+
+#define LOG_FRAME_BYTES (2 + sizeof(LogRecord) + 4)
+
+// CRC-32 (IEEE 802.3, reflected), nibble table
+inline uint32_t logCrc32(const uint8_t* data, size_t length, uint32_t crc = 0) {
+  static const uint32_t table[16] = {
+    0x00000000, 0x1DB71064, 0x3B6E20C8, 0x26D930AC, 0x76DC4190, 0x6B6B51F4, 0x4DB26158, 0x5005713C,
+    0xEDB88320, 0xF00F9344, 0xD6D6A3E8, 0xCB61B38C, 0x9B64C2B0, 0x86D3D2D4, 0xA00AE278, 0xBDBDF21C
+  };
+  crc = ~crc;
+  for (size_t i = 0; i < length; i++) {
+    crc = table[(crc ^ data[i]) & 0x0F] ^ (crc >> 4);
+    crc = table[(crc ^ (data[i] >> 4)) & 0x0F] ^ (crc >> 4);
+  }
+  return ~crc;
+}
+
+// Writes one frame into out (LOG_FRAME_BYTES)
+inline void logEncodeFrame(const LogRecord& record, uint8_t* out) {
+  out[0] = LOG_FRAME_SYNC;
+  out[1] = sizeof(LogRecord);
+  memcpy(out + 2, &record, sizeof(LogRecord));
+  uint32_t crc = logCrc32(out + 1, 1 + sizeof(LogRecord));
+  memcpy(out + 2 + sizeof(LogRecord), &crc, 4);
+}
+
+// Incremental frame decoder: feed bytes as they are read, in any chunk size
+class LogFrameParser {
+private:
+  uint8_t frame[LOG_FRAME_BYTES];
+  size_t have;
+  uint32_t skippedBytes;
+
+public:
+  LogFrameParser() : have(0), skippedBytes(0) {}
+
+  // Consumes input up to the end of the next good frame and returns the bytes
+  // used; complete is set when record holds that frame's record
+  size_t feed(const uint8_t* data, size_t length, LogRecord& record, bool& complete) {
+    size_t used = 0;
+    complete = false;
+    while (used < length) {
+      frame[have++] = data[used++];
+      
+      if (have == 1 && frame[0] != LOG_FRAME_SYNC) {
+        have = 0;
+        skippedBytes++;
+        continue;
+      }
+      if (have == 2 && frame[1] != sizeof(LogRecord)) {
+        resync();
+        continue;
+      }
+      if (have < LOG_FRAME_BYTES) {
+        continue;
+      }
+      
+      uint32_t crc;
+      memcpy(&crc, frame + 2 + sizeof(LogRecord), 4);
+      if (crc != logCrc32(frame + 1, 1 + sizeof(LogRecord))) {
+        resync();
+        continue;
+      }
+      memcpy(&record, frame + 2, sizeof(LogRecord));
+      have = 0;
+      complete = true;
+      break;
+    }
+    return used;
+  }
+
+  uint32_t getSkippedBytes() const { return skippedBytes; }
+
+private:
+  // Drop the first byte of a bad frame and rescan the rest for a sync byte
+  void resync() {
+    size_t start = 1;
+    while (start < have && frame[start] != LOG_FRAME_SYNC) {
+      start++;
+    }
+    skippedBytes += start;
+    have -= start;
+    memmove(frame, frame + start, have);
+    
+    // The kept tail may itself hold a bad length byte
+    if (have >= 2 && frame[1] != sizeof(LogRecord)) {
+      resync();
+    }
+  }
+};
+
+#define LOG_CSV_HEADER "seq,boot,time_s,voltage_v,current_a,soc_pct,consumed_ah\n"
+#define LOG_CSV_LINE_MAX 80
+
+// Appends value / 10^decimals, e.g. -1234 with 2 decimals -> "-12.34"
+inline char* logFormatFixed(char* p, int32_t value, int decimals) {
+  uint32_t magnitude = value < 0 ? 0u - (uint32_t)value : (uint32_t)value;
+  if (value < 0) {
+    *p++ = '-';
+  }
+  char digits[12];
+  int count = 0;
+  do {
+    digits[count++] = '0' + magnitude % 10;
+    magnitude /= 10;
+  } while (magnitude > 0 || count <= decimals);
+  while (count > 0) {
+    if (count == decimals) {
+      *p++ = '.';
+    }
+    *p++ = digits[--count];
+  }
+  return p;
+}
+
+// One CSV line with newline, not NUL-terminated; returns its length (< LOG_CSV_LINE_MAX)
+inline size_t logFormatCsv(const LogRecord& record, char* out) {
+  char* p = out;
+  p = logFormatFixed(p, (int32_t)record.seq, 0);  // Wraps after 2^31 records, decades at any sane rate
+  *p++ = ',';
+  p = logFormatFixed(p, record.boot, 0);
+  *p++ = ',';
+  p = logFormatFixed(p, (int32_t)record.time, 0);
+  *p++ = ',';
+  p = logFormatFixed(p, record.centivolts, 2);
+  *p++ = ',';
+  p = logFormatFixed(p, record.centiamps, 2);
+  *p++ = ',';
+  p = logFormatFixed(p, record.socTenths, 1);
+  *p++ = ',';
+  p = logFormatFixed(p, record.consumedCentiAh, 2);
+  *p++ = '\n';
+  return p - out;
+}
+
+#endif // LOG_FORMAT_H
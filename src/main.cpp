@@ -3,12 +3,24 @@
 #include "display.h"
 #include "config.h"
 #include "config_server.h"
+#include "main_events.h"
+#include "power_manager.h"
+#include "sampling_mode.h"
+#include "boot_profiler.h"
+#include "history.h"
+#include "sample_log.h"
+#include "pipeline_metrics.h"
+#include "energy_meter.h"
+#include "deferred_log.h"
+#include "adv_capture.h"
 #include "esp_sleep.h"
 #include "driver/gpio.h"
 
 VictronBLE* victronBLE = nullptr;
 Display* display = nullptr;
 ConfigServer* configServer = nullptr;
+History* history = nullptr;
+SampleLog* sampleLog = nullptr;
 
 // Button handling with hardware interrupts - no more blocking issues!
 struct ButtonEvent {
@@ -39,6 +51,7 @@ void IRAM_ATTR buttonISR() {
     buttonEvents[eventHead].timestamp = now;
     buttonEvents[eventHead].pressed = (digitalRead(CONFIG_BUTTON_PIN) == LOW);
     eventHead = nextHead;
+    MainEvents::postFromISR(MAIN_EVENT_BUTTON);
   }
 }
 
@@ -56,6 +69,19 @@ unsigned long firstReleaseTime = 0;
 int pressCount = 0;
 
 void enterDeepSleep() {
+  // The pending batch survives deep sleep, but not a power cut while asleep
+  if (sampleLog) {
+    sampleLog->flush();
+  }
+  
+#if SAMPLING_MODE
+  // Keep the data screen up and refresh it from timed samples
+  if (configServer && configServer->hasValidConfig() && !configServer->isInConfigMode()) {
+    Serial.println("=== ENTERING SAMPLING MODE ===");
+    SamplingMode::enter(victronBLE, display, configServer);
+  }
+#endif
+  
   Serial.println("=== ENTERING DEEP SLEEP MODE ===");
   Serial.println("Showing sleep screen...");
   
@@ -88,6 +114,7 @@ void enterDeepSleep() {
   digitalWrite(EPD_POWER, LOW);
   
   Serial.println("Going to sleep in 1 second...");
+  DeferredLog::flush();
   Serial.flush();
   delay(1000);
   
@@ -162,18 +189,33 @@ void processButtonEvents() {
   
   // Handle timeouts
   unsigned long now = millis();
-  if (buttonState == WAITING_FOR_SECOND && (now - firstReleaseTime) > 2000) {
+  if (buttonState == WAITING_FOR_SECOND && (now - firstReleaseTime) > DOUBLE_PRESS_TIMEOUT) {
     buttonState = IDLE;
     Serial.println("Double press timeout - treating as single press");
     
-    // Only now show feedback since it was just a single press
-    if (display) {
+    if (victronBLE && display) {
+      // Single press cycles through the devices, the combined view, the graph
+      // and the diagnostics screen
+      if (display->isDiagnosticsMode()) {
+        display->setDiagnosticsMode(false);
+      } else if (display->isGraphMode()) {
+        display->setDiagnosticsMode(true);
+      } else if (victronBLE->nextView() == 0) {
+        display->setGraphMode(true);
+      }
+      Serial.printf("Display view: %s\n", display->isGraphMode() ? "graph" :
+                    display->isDiagnosticsMode() ? "diagnostics" : "data");
+    } else if (display) {
+      // Only now show feedback since it was just a single press
       display->showConfigScreen("Single Press", "Hold 6s for config", "Double-press for sleep", "");
     }
   }
 }
 
 void initializeBLE() {
+  if (configServer) {
+    configServer->setLiveSource(nullptr);
+  }
   if (victronBLE) {
     delete victronBLE;
     victronBLE = nullptr;
@@ -184,24 +226,69 @@ void initializeBLE() {
     return;
   }
   
-  DeviceConfig config = configServer->getConfig();
-  Serial.printf("Initializing BLE with MAC: %s\n", config.mac_address);
+  victronBLE = new VictronBLE();
+  for (uint8_t i = 0; i < configServer->getDeviceCount(); i++) {
+    DeviceConfig config = configServer->getDevice(i);
+    Serial.printf("Initializing BLE with MAC: %s\n", config.mac_address);
+    victronBLE->addDevice(config.mac_address, config.encryption_key);
+  }
   
-  victronBLE = new VictronBLE(config.mac_address, config.encryption_key);
-  if (!victronBLE->begin()) {
+  if (victronBLE->getDeviceCount() == 0 || !victronBLE->begin()) {
     Serial.println("BLE failed to initialize");
     delete victronBLE;
     victronBLE = nullptr;
   } else {
     victronBLE->setDisplay(display);
-    Serial.printf("Monitoring device: %s\n", config.mac_address);
+    victronBLE->setView(0);
+    Serial.printf("Monitoring %d device(s)\n", victronBLE->getDeviceCount());
     victronBLE->startScanning();
+    configServer->setLiveSource(victronBLE);
+    BootProfiler::mark(BOOT_BLE);
+  }
+}
+
+void initializeDisplay(bool wokeFromSleep) {
+  display = new Display();
+  
+#if FAST_BOOT
+  // No splash: the first data screen (or NO DATA) is the first refresh
+  if (!display->begin(false)) {
+#else
+  if (!display->begin()) {
+#endif
+    Serial.println("Display failed to initialize");
+    delete display;
+    display = nullptr;
+    return;
+  }
+  display->setHistory(history);
+  BootProfiler::mark(BOOT_DISPLAY);
+  
+#if !FAST_BOOT
+  if (wokeFromSleep) {
+    display->showConfigScreen("Wake Up", "Device awakened", "from sleep mode", "Initializing...");
+    delay(2000);
+  }
+  display->showTestScreen();
+  if (wokeFromSleep) {
+    display->forceNextUpdate(); // Force display to update with new data after wake
+    Serial.println("Wake from sleep detected - display state reset");
   }
+#endif
 }
 
 void setup() {
   Serial.begin(115200);
-  delay(2000);
+  
+  // Sample timer wakeup: take one reading and go straight back to sleep
+  if (SamplingMode::isSampleWakeup()) {
+    SamplingMode::runCycle();
+  }
+  
+#if !FAST_BOOT
+  delay(2000);  // Time to attach a serial monitor
+#endif
+  BootProfiler::mark(BOOT_SERIAL);
   
   // Check wake-up reason
   esp_sleep_wakeup_cause_t wakeup_reason = esp_sleep_get_wakeup_cause();
@@ -216,6 +303,15 @@ void setup() {
   
   Serial.printf("ESP32-S3 @ %d MHz, %d MB Flash\n", ESP.getCpuFreqMHz(), ESP.getFlashChipSize()/1024/1024);
   
+  // Scale the clock and sleep between events; BLE, decode and display hold locks while busy
+  PowerManager::begin();
+  
+  // Button ISR and BLE decode task wake the main loop from here on
+  MainEvents::begin();
+  
+  // LOG_* output goes through the log task from here on
+  DeferredLog::begin();
+  
   // Setup button with hardware interrupt
   pinMode(CONFIG_BUTTON_PIN, INPUT_PULLUP);
   attachInterrupt(digitalPinToInterrupt(CONFIG_BUTTON_PIN), buttonISR, CHANGE);
@@ -226,37 +322,109 @@ void setup() {
   if (!configServer->begin()) {
     Serial.println("Config server failed to initialize");
   }
+  BootProfiler::mark(BOOT_CONFIG);
   
-  // Initialize display
-  display = new Display();
-  if (!display->begin()) {
-    Serial.println("Display failed to initialize");
-    delete display;
-    display = nullptr;
-  } else {
-    if (wokeFromSleep) {
-      display->showConfigScreen("Wake Up", "Device awakened", "from sleep mode", "Initializing...");
-      delay(2000);
-    }
-    display->showTestScreen();
-    if (wokeFromSleep) {
-      display->forceNextUpdate(); // Force display to update with new data after wake
-      Serial.println("Wake from sleep detected - display state reset");
-    }
+  // Sample log on flash, downloadable from the config portal
+  sampleLog = new SampleLog();
+  if (!sampleLog->begin()) {
+    delete sampleLog;
+    sampleLog = nullptr;
   }
+  configServer->setSampleLog(sampleLog);
+  
+  // Reading history for the graph screen
+  history = new History();
+  if (!history->begin()) {
+    delete history;
+    history = nullptr;
+  }
+  
+#if ADV_CAPTURE
+  // Raw advertisements for sim/replay, from the first one scanned
+  AdvCapture::begin();
+#endif
+  
+#if FAST_BOOT
+  // Start scanning first so the first advertisements arrive while the panel
+  // initialises; readings decoded meanwhile are handed over with the view
+  initializeBLE();
+  initializeDisplay(wokeFromSleep);
+  if (victronBLE && display) {
+    victronBLE->setDisplay(display);
+    victronBLE->setView(victronBLE->getView());
+  }
+#else
+  initializeDisplay(wokeFromSleep);
   
   // Initialize Victron BLE with stored configuration
   initializeBLE();
+#endif
+  
+#if LIVE_API_ALWAYS_ON
+  // Readings stream at /api/live from boot, not only in config mode
+  configServer->startLiveServer();
+#endif
   
   Serial.println("Ready - Hold button for 6s to enter config mode");
   Serial.println("       Double-press button to enter sleep mode");
   Serial.println("       (Hardware interrupt-based - no blocking!)");
 }
 
-void loop() {
-  static unsigned long lastRefresh = 0;
-  static unsigned long lastConfigCheck = 0;
+unsigned long lastConfigCheck = 0;
+unsigned long lastStatsReport = 0;
+unsigned long lastLogAppend = 0;
+unsigned long lastLogFlush = 0;
+
+static unsigned long timeLeft(unsigned long since, unsigned long interval, unsigned long now) {
+  unsigned long elapsed = now - since;
+  return elapsed >= interval ? 0 : interval - elapsed;
+}
+
+// How long the main loop may block before one of its own deadlines comes due.
+// Samples and button presses wake it earlier through MainEvents.
+unsigned long msUntilNextDeadline(unsigned long now) {
+  unsigned long wait = STATS_REPORT_INTERVAL;
+  
+  if (buttonState == WAITING_FOR_SECOND) {
+    wait = min(wait, timeLeft(firstReleaseTime, DOUBLE_PRESS_TIMEOUT + 1, now));
+  }
+  
+  if (configServer && configServer->isInConfigMode()) {
+    // The web server has no wakeup of its own and has to be polled
+    wait = min(wait, (unsigned long)CONFIG_POLL_INTERVAL);
+    return min(wait, configServer->msUntilTimeout());
+  }
+  if (configServer && configServer->isServing()) {
+    wait = min(wait, (unsigned long)CONFIG_POLL_INTERVAL);
+  }
+  
+  if (display) {
+    // Includes the coalescing window and the refresh rate limit
+    wait = min(wait, display->msUntilRefresh(now));
+  }
+  
+  if (!victronBLE || !configServer->hasValidConfig()) {
+    wait = min(wait, timeLeft(lastConfigCheck, NO_CONFIG_REMINDER_INTERVAL, now));
+  }
   
+  if (victronBLE) {
+    wait = min(wait, timeLeft(lastStatsReport, STATS_REPORT_INTERVAL, now));
+    if (history) {
+      wait = min(wait, history->msUntilDue(now));
+    }
+    if (sampleLog) {
+      wait = min(wait, timeLeft(lastLogAppend, LOG_INTERVAL_MS, now));
+    }
+  }
+  
+  if (sampleLog && sampleLog->getPendingCount() > 0) {
+    wait = min(wait, timeLeft(lastLogFlush, LOG_FLUSH_INTERVAL_MS, now));
+  }
+  
+  return wait;
+}
+
+void loop() {
   unsigned long now = millis();
   
   // Process button events
@@ -267,6 +435,11 @@ void loop() {
     bool wasInConfigMode = configServer->isInConfigMode();
     configServer->loop();
     
+    // Wake on every decoded packet while someone is watching /api/live
+    if (victronBLE) {
+      victronBLE->setDecodeNotify(configServer->hasLiveClients());
+    }
+    
     // If config mode just ended, reinitialize BLE with new config
     if (wasInConfigMode && !configServer->isInConfigMode()) {
       Serial.println("Config mode ended - reinitializing...");
@@ -278,20 +451,105 @@ void loop() {
     }
   }
   
-  // Check for display updates (only if not in config mode)
-  if (display && !configServer->isInConfigMode() && now - lastRefresh >= 2000) {
-    lastRefresh = now;
+  // Sample the battery into the history ring
+  if (history && victronBLE && history->msUntilDue(now) == 0) {
+    history->record(victronBLE->getCombinedData(), now);
+    if (display) {
+      display->historyUpdated();
+    }
+  }
+  
+  // Log the battery to flash; records are batched and written LOG_BATCH_RECORDS at a time
+  if (sampleLog && victronBLE && now - lastLogAppend >= LOG_INTERVAL_MS) {
+    lastLogAppend = now;
+    BatteryData data = victronBLE->getCombinedData();
+    if (data.data_valid) {
+      sampleLog->append(data);
+    }
+  }
+  if (sampleLog && now - lastLogFlush >= LOG_FLUSH_INTERVAL_MS) {
+    lastLogFlush = now;
+    sampleLog->flush();
+  }
+  
+  // Update the display when it has something to draw (only if not in config mode)
+  if (display && !configServer->isInConfigMode() && display->msUntilRefresh(now) == 0) {
     display->refresh();
+    
+    if (!BootProfiler::isMarked(BOOT_FIRST_RENDER) && display->isShowingData()) {
+      BootProfiler::mark(BOOT_FIRST_RENDER);
+      BootProfiler::report();
+    }
   }
   
   // Show "no config" message if needed
   if (!configServer->isInConfigMode() && (!victronBLE || !configServer->hasValidConfig()) && 
-      now - lastConfigCheck >= 10000) {
+      now - lastConfigCheck >= NO_CONFIG_REMINDER_INTERVAL) {
     lastConfigCheck = now;
     if (display) {
       display->showConfigScreen("No Configuration", "Hold button 6s", "to configure", "device");
     }
   }
   
-  delay(100);
-}
\ No newline at end of file
+  // Report decoder statistics
+  if (victronBLE && now - lastStatsReport >= STATS_REPORT_INTERVAL) {
+    static uint32_t lastCallbackCount = 0;
+    static uint32_t lastWakeups = 0;
+    uint32_t callbacks = victronBLE->getCallbackCount();
+    uint32_t wakeups = MainEvents::getEventWakeups() + MainEvents::getDeadlineWakeups();
+    uint32_t elapsedMs = lastStatsReport ? now - lastStatsReport : now;
+    Serial.printf("Scan stats: %.1f callbacks/s, heap free %u, min free %u\n",
+                  (callbacks - lastCallbackCount) * 1000.0f / elapsedMs,
+                  ESP.getFreeHeap(), ESP.getMinFreeHeap());
+    Serial.printf("Main loop: %.1f wakeups/min (%u by events, %u by deadlines since boot)\n",
+                  (wakeups - lastWakeups) * 60000.0f / elapsedMs,
+                  MainEvents::getEventWakeups(), MainEvents::getDeadlineWakeups());
+    lastCallbackCount = callbacks;
+    lastWakeups = wakeups;
+    lastStatsReport = now;
+    BootProfiler::report(); // Once; covers boots that never get to a first render
+    PowerStats power;
+    PowerManager::takeStats(power);
+    Serial.printf("Power: active %.1f%% (scan %.1f%%, decode %.1f%%, render %.1f%%), light sleep %s\n",
+                  power.activePercent, power.activityPercent[POWER_ACTIVITY_SCAN],
+                  power.activityPercent[POWER_ACTIVITY_DECODE], power.activityPercent[POWER_ACTIVITY_RENDER],
+                  PowerManager::isLightSleepEnabled() ? "on" : "off");
+    Serial.printf("BLE stats: %u decrypted, %u duplicates skipped, ring max %u/%u, %u dropped\n",
+                  victronBLE->getDecryptCount(), victronBLE->getSkippedCount(),
+                  victronBLE->getRingHighWater(), (unsigned)victronBLE->getRingCapacity(),
+                  victronBLE->getRingDropped());
+    if (history) {
+      Serial.printf("History: %u samples, %u of %u bytes\n", history->getSampleCount(),
+                    (unsigned)history->getBytesUsed(), (unsigned)history->getCapacity());
+    }
+    if (display) {
+      RefreshStats refresh;
+      display->getRefreshStats(refresh);
+      Serial.printf("Display: %u full + %u partial refreshes in the last hour, %u changes coalesced\n",
+                    refresh.fullLastHour, refresh.partialLastHour, refresh.coalescedChanges);
+      Serial.printf("Ghosting budget: %u/%u partials, %u/%lu pixels flipped\n",
+                    refresh.ghost.partialRefreshes, (unsigned)GHOST_MAX_PARTIAL_REFRESHES,
+                    refresh.ghost.flippedPixels, (unsigned long)GHOST_MAX_FLIPPED_PIXELS);
+    }
+    if (sampleLog) {
+      Serial.printf("Sample log: %u bytes on flash, %u pending, %u writes, %u dropped\n",
+                    sampleLog->getBytesOnFlash(), sampleLog->getPendingCount(),
+                    sampleLog->getFlushCount(), sampleLog->getDroppedRecords());
+    }
+    EnergyMeter::print();
+    Serial.printf("Log: %u dropped, high water %u/%u\n", DeferredLog::getDroppedCount(),
+                  DeferredLog::getHighWater(), (unsigned)DeferredLog::getCapacity());
+#if ADV_CAPTURE
+    Serial.printf("Capture: %u frames, %u bytes, %u dropped\n", AdvCapture::getFrameCount(),
+                  AdvCapture::getByteCount(), AdvCapture::getDroppedCount());
+#endif
+    static uint8_t reportsSinceMetrics = 0;
+    if (++reportsSinceMetrics >= METRICS_PRINT_REPORTS) {
+      reportsSinceMetrics = 0;
+      PipelineMetrics::print();
+    }
+  }
+  
+  // Block until a sample or button event arrives or the next deadline is due
+  MainEvents::wait(msUntilNextDeadline(millis()));
+}
@@ -0,0 +1,50 @@
+#include "main_events.h"
+
+static TaskHandle_t mainTask = nullptr;
+static uint32_t eventWakeups = 0;
+static uint32_t deadlineWakeups = 0;
+
+void MainEvents::begin() {
+  mainTask = xTaskGetCurrentTaskHandle();
+}
+
+void MainEvents::post(uint32_t events) {
+  if (mainTask) {
+    xTaskNotify(mainTask, events, eSetBits);
+  }
+}
+
+void IRAM_ATTR MainEvents::postFromISR(uint32_t events) {
+  if (mainTask) {
+    BaseType_t higherPriorityTaskWoken = pdFALSE;
+    xTaskNotifyFromISR(mainTask, events, eSetBits, &higherPriorityTaskWoken);
+    if (higherPriorityTaskWoken) {
+      portYIELD_FROM_ISR();
+    }
+  }
+}
+
+uint32_t MainEvents::wait(unsigned long timeoutMs) {
+  uint32_t events = 0;
+
+  // Keeps pdMS_TO_TICKS from overflowing; a spurious deadline wakeup is harmless
+  if (timeoutMs > 3600000UL) {
+    timeoutMs = 3600000UL;
+  }
+
+  if (xTaskNotifyWait(0, UINT32_MAX, &events, pdMS_TO_TICKS(timeoutMs)) == pdTRUE) {
+    eventWakeups++;
+    return events;
+  }
+
+  deadlineWakeups++;
+  return 0;
+}
+
+uint32_t MainEvents::getEventWakeups() {
+  return eventWakeups;
+}
+
+uint32_t MainEvents::getDeadlineWakeups() {
+  return deadlineWakeups;
+}
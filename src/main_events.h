@@ -0,0 +1,30 @@
+#ifndef MAIN_EVENTS_H
+#define MAIN_EVENTS_H
+
+#include <Arduino.h>
+
+// Reasons to wake the main loop, delivered as task notification bits
+#define MAIN_EVENT_SAMPLE  (1UL << 0)   // Decoded sample left a display update pending
+#define MAIN_EVENT_BUTTON  (1UL << 1)   // Button edge queued by the ISR
+#define MAIN_EVENT_DECODED (1UL << 2)   // Valid packet decoded (sampling mode, live streams)
+
+// The main loop task blocks here between events instead of polling. Anything
+// time-based (refresh, timeouts, reports) is handled by waiting no longer
+// than the nearest deadline.
+namespace MainEvents {
+  // Call from the main loop task before anything posts
+  void begin();
+
+  void post(uint32_t events);
+  void postFromISR(uint32_t events);
+
+  // Block until an event is posted or timeoutMs passes; returns the posted
+  // events, 0 for a deadline wakeup
+  uint32_t wait(unsigned long timeoutMs);
+
+  // Wakeups since boot, split by cause
+  uint32_t getEventWakeups();
+  uint32_t getDeadlineWakeups();
+}
+
+#endif // MAIN_EVENTS_H
@@ -0,0 +1,142 @@
+#include "pipeline_metrics.h"
+
+#if PIPELINE_METRICS
+
+#include "esp_timer.h"
+
+static const uint32_t bucketBoundsUs[METRICS_BUCKET_COUNT] = {
+  10, 25, 50, 100, 250, 500,
+  1000, 2500, 5000, 10000, 25000, 50000,
+  100000, 250000, 500000, 1000000, 2500000, 5000000, 10000000
+};
+
+static const char* const stageNames[STAGE_COUNT] = {
+  "scan_callback", "queue", "decrypt", "parse", "update", "schedule", "render", "panel", "end_to_end"
+};
+
+static StageHistogram histograms[STAGE_COUNT];
+static portMUX_TYPE metricsMux = portMUX_INITIALIZER_UNLOCKED;
+
+uint32_t PipelineMetrics::cycles() {
+  return ESP.getCycleCount();
+}
+
+uint32_t PipelineMetrics::timestampUs() {
+  return (uint32_t)esp_timer_get_time();
+}
+
+void PipelineMetrics::recordCycles(PipelineStage stage, uint32_t startCycles) {
+#if POWER_MANAGEMENT
+  // Timed work holds the maximum-frequency lock
+  const uint32_t cyclesPerUs = POWER_MAX_CPU_FREQ_MHZ;
+#else
+  const uint32_t cyclesPerUs = ESP.getCpuFreqMHz();
+#endif
+  recordMicros(stage, (ESP.getCycleCount() - startCycles) / cyclesPerUs);
+}
+
+void PipelineMetrics::recordMicros(PipelineStage stage, uint32_t us) {
+  uint8_t bucket = 0;
+  while (bucket < METRICS_BUCKET_COUNT && us > bucketBoundsUs[bucket]) {
+    bucket++;
+  }
+  
+  StageHistogram& histogram = histograms[stage];
+  portENTER_CRITICAL(&metricsMux);
+  histogram.buckets[bucket]++;
+  histogram.count++;
+  histogram.sumUs += us;
+  if (us > histogram.maxUs) {
+    histogram.maxUs = us;
+  }
+  portEXIT_CRITICAL(&metricsMux);
+}
+
+void PipelineMetrics::getHistogram(PipelineStage stage, StageHistogram& histogram) {
+  portENTER_CRITICAL(&metricsMux);
+  histogram = histograms[stage];
+  portEXIT_CRITICAL(&metricsMux);
+}
+
+const char* PipelineMetrics::stageName(PipelineStage stage) {
+  return stageNames[stage];
+}
+
+uint32_t PipelineMetrics::bucketBound(uint8_t bucket) {
+  return bucket < METRICS_BUCKET_COUNT ? bucketBoundsUs[bucket] : UINT32_MAX;
+}
+
+// Upper bound of the bucket holding the q-th sample; a bucket-resolution estimate
+static uint32_t percentile(const StageHistogram& histogram, float q) {
+  uint32_t rank = (uint32_t)(histogram.count * q + 0.5f);
+  uint32_t seen = 0;
+  for (uint8_t i = 0; i <= METRICS_BUCKET_COUNT; i++) {
+    seen += histogram.buckets[i];
+    if (seen >= rank && seen > 0) {
+      return min(PipelineMetrics::bucketBound(i), histogram.maxUs);
+    }
+  }
+  return histogram.maxUs;
+}
+
+void PipelineMetrics::print() {
+  Serial.println("Pipeline latency (us):  count     p50     p90     p99     max");
+  for (int i = 0; i < STAGE_COUNT; i++) {
+    StageHistogram histogram;
+    getHistogram((PipelineStage)i, histogram);
+    if (histogram.count == 0) {
+      continue;
+    }
+    Serial.printf("  %-14s %8u %7u %7u %7u %7u\n", stageNames[i], histogram.count,
+                  percentile(histogram, 0.5f), percentile(histogram, 0.9f),
+                  percentile(histogram, 0.99f), histogram.maxUs);
+  }
+}
+
+size_t PipelineMetrics::formatPrometheus(PipelineStage stage, char* out, size_t size) {
+  StageHistogram histogram;
+  getHistogram(stage, histogram);
+  const char* name = stageNames[stage];
+  
+  size_t used = 0;
+  int length;
+  if (stage == 0) {
+    length = snprintf(out, size,
+                      "# HELP gauge_pipeline_latency_seconds Time spent in each stage from radio to panel\n"
+                      "# TYPE gauge_pipeline_latency_seconds histogram\n");
+    if (length < 0 || (size_t)length >= size) {
+      return 0;
+    }
+    used = length;
+  }
+  
+  // Prometheus buckets are cumulative
+  uint32_t cumulative = 0;
+  for (uint8_t i = 0; i <= METRICS_BUCKET_COUNT; i++) {
+    cumulative += histogram.buckets[i];
+    char le[16];
+    if (i < METRICS_BUCKET_COUNT) {
+      snprintf(le, sizeof(le), "%g", bucketBoundsUs[i] / 1e6);
+    } else {
+      strcpy(le, "+Inf");
+    }
+    length = snprintf(out + used, size - used,
+                      "gauge_pipeline_latency_seconds_bucket{stage=\"%s\",le=\"%s\"} %u\n",
+                      name, le, cumulative);
+    if (length < 0 || (size_t)length >= size - used) {
+      return 0;
+    }
+    used += length;
+  }
+  
+  length = snprintf(out + used, size - used,
+                    "gauge_pipeline_latency_seconds_sum{stage=\"%s\"} %.6f\n"
+                    "gauge_pipeline_latency_seconds_count{stage=\"%s\"} %u\n",
+                    name, histogram.sumUs / 1e6, name, histogram.count);
+  if (length < 0 || (size_t)length >= size - used) {
+    return 0;
+  }
+  return used + length;
+}
+
+#endif // PIPELINE_METRICS
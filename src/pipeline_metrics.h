@@ -0,0 +1,83 @@
+#ifndef PIPELINE_METRICS_H
+#define PIPELINE_METRICS_H
+
+#include <Arduino.h>
+#include "config.h"
+
+// Stages between a packet reaching the radio and the panel showing it
+enum PipelineStage {
+  STAGE_SCAN_CALLBACK,   // Scan callback: device lookup and copy into the ring
+  STAGE_QUEUE,           // Waiting in the ring for the decode task
+  STAGE_DECRYPT,
+  STAGE_PARSE,
+  STAGE_UPDATE,          // Display::updateData: change detection
+  STAGE_SCHEDULE,        // Change detected until the refresh starts (coalescing, rate limit)
+  STAGE_RENDER,          // Drawing the frame and diffing it
+  STAGE_PANEL,           // Transfer and panel waveform
+  STAGE_END_TO_END,      // Packet received until the panel refresh is done
+  STAGE_COUNT
+};
+
+// Fixed histogram bucket upper bounds, microseconds; one more bucket catches the rest
+#define METRICS_BUCKET_COUNT 19
+#define METRICS_STAGE_TEXT_MAX 2048  // Prometheus text of one stage
+
+struct StageHistogram {
+  uint32_t buckets[METRICS_BUCKET_COUNT + 1];
+  uint32_t count;
+  uint64_t sumUs;
+  uint32_t maxUs;
+};
+
+#if PIPELINE_METRICS
+// Latency histograms for each pipeline stage. Work inside one task is timed
+// with the CPU cycle counter; the decode and render paths hold the
+// maximum-frequency lock, so cycles convert to time at a fixed clock.
+// Waits that cross tasks or let the clock scale down use esp_timer.
+// Any task may record; a spinlock keeps the histograms consistent.
+namespace PipelineMetrics {
+  uint32_t cycles();
+  uint32_t timestampUs();
+  
+  void recordCycles(PipelineStage stage, uint32_t startCycles);
+  void recordMicros(PipelineStage stage, uint32_t us);
+  
+  void getHistogram(PipelineStage stage, StageHistogram& histogram);
+  const char* stageName(PipelineStage stage);
+  uint32_t bucketBound(uint8_t bucket); // Microseconds; UINT32_MAX for the last
+  
+  // Count, estimated percentiles and maximum per stage
+  void print();
+  
+  // Prometheus text exposition of one stage (the first also carries the
+  // HELP/TYPE header); returns the length written, 0 if it did not fit
+  size_t formatPrometheus(PipelineStage stage, char* out, size_t size);
+}
+
+// Times the enclosing scope into a stage
+class StageTimer {
+private:
+  PipelineStage stage;
+  uint32_t start;
+
+public:
+  explicit StageTimer(PipelineStage s) : stage(s), start(PipelineMetrics::cycles()) {}
+  ~StageTimer() { PipelineMetrics::recordCycles(stage, start); }
+};
+#else
+// Lean build: every call site compiles to nothing
+namespace PipelineMetrics {
+  inline uint32_t cycles() { return 0; }
+  inline uint32_t timestampUs() { return 0; }
+  inline void recordCycles(PipelineStage, uint32_t) {}
+  inline void recordMicros(PipelineStage, uint32_t) {}
+  inline void print() {}
+}
+
+class StageTimer {
+public:
+  explicit StageTimer(PipelineStage) {}
+};
+#endif
+
+#endif // PIPELINE_METRICS_H
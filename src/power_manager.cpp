@@ -0,0 +1,156 @@
+#include "power_manager.h"
+
+#if POWER_MANAGEMENT
+
+#include "esp_pm.h"
+#include "esp_timer.h"
+#include "esp_idf_version.h"
+
+static const char* const lockNames[POWER_ACTIVITY_COUNT] = {"scan", "decode", "render"};
+
+static esp_pm_lock_handle_t locks[POWER_ACTIVITY_COUNT];
+static bool locksReady = false;
+static bool lightSleepEnabled = false;
+
+// Hold-time accounting, shared between the tasks that take locks
+static portMUX_TYPE statsMux = portMUX_INITIALIZER_UNLOCKED;
+static uint8_t holders = 0;
+static uint8_t activityHolders[POWER_ACTIVITY_COUNT];
+static int64_t activeSince = 0;
+static int64_t activitySince[POWER_ACTIVITY_COUNT];
+static int64_t activeUs = 0;
+static int64_t activityUs[POWER_ACTIVITY_COUNT];
+static int64_t windowStart = 0;
+static int64_t reportedActiveUs = 0;   // Active time already taken by takeStats windows
+
+static esp_err_t configure(bool lightSleep) {
+#if ESP_IDF_VERSION_MAJOR >= 5
+  esp_pm_config_t config;
+#else
+  esp_pm_config_esp32s3_t config;
+#endif
+  config.max_freq_mhz = POWER_MAX_CPU_FREQ_MHZ;
+  config.min_freq_mhz = POWER_MIN_CPU_FREQ_MHZ;
+  config.light_sleep_enable = lightSleep;
+  return esp_pm_configure(&config);
+}
+
+bool PowerManager::begin() {
+  esp_err_t err = configure(true);
+  lightSleepEnabled = err == ESP_OK;
+  if (err != ESP_OK) {
+    Serial.printf("Power: light sleep unavailable (%s), frequency scaling only\n", esp_err_to_name(err));
+    err = configure(false);
+  }
+  if (err != ESP_OK) {
+    Serial.printf("Power: power management unavailable (%s)\n", esp_err_to_name(err));
+    return false;
+  }
+
+  for (int i = 0; i < POWER_ACTIVITY_COUNT; i++) {
+    if (esp_pm_lock_create(ESP_PM_CPU_FREQ_MAX, 0, lockNames[i], &locks[i]) != ESP_OK) {
+      Serial.printf("Power: failed to create %s lock\n", lockNames[i]);
+      return false;
+    }
+  }
+
+  windowStart = esp_timer_get_time();
+  locksReady = true;
+
+  Serial.printf("Power: %d-%d MHz, light sleep %s\n", POWER_MIN_CPU_FREQ_MHZ, POWER_MAX_CPU_FREQ_MHZ,
+                lightSleepEnabled ? "on" : "off");
+  return true;
+}
+
+bool PowerManager::isLightSleepEnabled() {
+  return lightSleepEnabled;
+}
+
+void PowerManager::acquire(PowerActivity activity) {
+  if (!locksReady) {
+    return;
+  }
+
+  esp_pm_lock_acquire(locks[activity]);
+
+  int64_t now = esp_timer_get_time();
+  portENTER_CRITICAL(&statsMux);
+  if (holders++ == 0) {
+    activeSince = now;
+  }
+  if (activityHolders[activity]++ == 0) {
+    activitySince[activity] = now;
+  }
+  portEXIT_CRITICAL(&statsMux);
+}
+
+void PowerManager::release(PowerActivity activity) {
+  if (!locksReady) {
+    return;
+  }
+
+  int64_t now = esp_timer_get_time();
+  portENTER_CRITICAL(&statsMux);
+  if (--activityHolders[activity] == 0) {
+    activityUs[activity] += now - activitySince[activity];
+  }
+  if (--holders == 0) {
+    activeUs += now - activeSince;
+  }
+  portEXIT_CRITICAL(&statsMux);
+
+  esp_pm_lock_release(locks[activity]);
+}
+
+void PowerManager::takeStats(PowerStats& stats) {
+  memset(&stats, 0, sizeof(stats));
+  if (!locksReady) {
+    return;
+  }
+
+  int64_t now = esp_timer_get_time();
+  int64_t active;
+  int64_t activity[POWER_ACTIVITY_COUNT];
+
+  // Locks held right now are cut at the window boundary
+  portENTER_CRITICAL(&statsMux);
+  if (holders > 0) {
+    activeUs += now - activeSince;
+    activeSince = now;
+  }
+  active = activeUs;
+  reportedActiveUs += activeUs;
+  activeUs = 0;
+  for (int i = 0; i < POWER_ACTIVITY_COUNT; i++) {
+    if (activityHolders[i] > 0) {
+      activityUs[i] += now - activitySince[i];
+      activitySince[i] = now;
+    }
+    activity[i] = activityUs[i];
+    activityUs[i] = 0;
+  }
+  int64_t window = now - windowStart;
+  windowStart = now;
+  portEXIT_CRITICAL(&statsMux);
+
+  if (window <= 0) {
+    return;
+  }
+  stats.activePercent = active * 100.0f / window;
+  for (int i = 0; i < POWER_ACTIVITY_COUNT; i++) {
+    stats.activityPercent[i] = activity[i] * 100.0f / window;
+  }
+}
+
+int64_t PowerManager::getActiveMicros() {
+  if (!locksReady) {
+    return 0;
+  }
+  int64_t now = esp_timer_get_time();
+  portENTER_CRITICAL(&statsMux);
+  int64_t total = reportedActiveUs + activeUs + (holders > 0 ? now - activeSince : 0);
+  portEXIT_CRITICAL(&statsMux);
+  return total;
+}
+
+#endif // POWER_MANAGEMENT
@@ -0,0 +1,59 @@
+#ifndef POWER_MANAGER_H
+#define POWER_MANAGER_H
+
+#include <Arduino.h>
+#include "config.h"
+
+// Work that needs the CPU at full clock. Outside of these the power manager
+// may scale the clock down and, between events, put the chip in light sleep.
+enum PowerActivity {
+  POWER_ACTIVITY_SCAN,     // Scan callback: filter and queue an advertisement
+  POWER_ACTIVITY_DECODE,   // Decrypt and parse one advertisement
+  POWER_ACTIVITY_RENDER,   // Draw a frame and transfer it to the panel
+  POWER_ACTIVITY_COUNT
+};
+
+// Share of wall time spent holding locks, over one reporting window
+struct PowerStats {
+  float activePercent;                          // Any lock held
+  float activityPercent[POWER_ACTIVITY_COUNT];  // Per activity; overlapping work counts in each
+};
+
+#if POWER_MANAGEMENT
+namespace PowerManager {
+  // Enable frequency scaling and automatic light sleep. Falls back to
+  // frequency scaling alone if the framework was built without tickless idle.
+  bool begin();
+  bool isLightSleepEnabled();
+
+  void acquire(PowerActivity activity);
+  void release(PowerActivity activity);
+
+  // Statistics since the previous call (or since begin())
+  void takeStats(PowerStats& stats);
+  
+  // Time any lock has been held since begin(), for the energy model
+  int64_t getActiveMicros();
+}
+#else
+namespace PowerManager {
+  inline bool begin() { return false; }
+  inline bool isLightSleepEnabled() { return false; }
+  inline void acquire(PowerActivity) {}
+  inline void release(PowerActivity) {}
+  inline void takeStats(PowerStats& stats) { memset(&stats, 0, sizeof(stats)); }
+  inline int64_t getActiveMicros() { return 0; }
+}
+#endif
+
+// Holds an activity's lock for the lifetime of the scope
+class PowerLock {
+private:
+  PowerActivity activity;
+
+public:
+  explicit PowerLock(PowerActivity a) : activity(a) { PowerManager::acquire(activity); }
+  ~PowerLock() { PowerManager::release(activity); }
+};
+
+#endif // POWER_MANAGER_H
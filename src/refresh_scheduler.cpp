@@ -0,0 +1,158 @@
+#include "refresh_scheduler.h"
+#include <limits.h>
+
+#define HOUR_BUCKET_MS 300000UL
+
+RefreshScheduler::RefreshScheduler() : fullRefreshes(0), partialRefreshes(0), coalescedChanges(0) {
+  lock = portMUX_INITIALIZER_UNLOCKED;
+  memset(&ghost, 0, sizeof(ghost));
+  memset(bucketEpoch, 0, sizeof(bucketEpoch));
+  memset(bucketFull, 0, sizeof(bucketFull));
+  memset(bucketPartial, 0, sizeof(bucketPartial));
+  reset(0);
+}
+
+void RefreshScheduler::reset(unsigned long now) {
+  portENTER_CRITICAL(&lock);
+  pending = false;
+  urgent = false;
+  pendingSince = now;
+  lastRefresh = now - DISPLAY_MIN_REFRESH_INTERVAL;
+  portEXIT_CRITICAL(&lock);
+}
+
+void RefreshScheduler::changed(unsigned long now, bool isUrgent) {
+  portENTER_CRITICAL(&lock);
+  if (pending) {
+    coalescedChanges++;
+  } else {
+    pending = true;
+    pendingSince = now;
+  }
+  urgent = urgent || isUrgent;
+  portEXIT_CRITICAL(&lock);
+}
+
+bool RefreshScheduler::isPending() const {
+  portENTER_CRITICAL(&lock);
+  bool result = pending;
+  portEXIT_CRITICAL(&lock);
+  return result;
+}
+
+unsigned long RefreshScheduler::allowedIn(unsigned long now) const {
+  unsigned long since = now - lastRefresh;
+  return since >= DISPLAY_MIN_REFRESH_INTERVAL ? 0 : DISPLAY_MIN_REFRESH_INTERVAL - since;
+}
+
+unsigned long RefreshScheduler::msUntilAllowed(unsigned long now) const {
+  portENTER_CRITICAL(&lock);
+  unsigned long wait = allowedIn(now);
+  portEXIT_CRITICAL(&lock);
+  return wait;
+}
+
+unsigned long RefreshScheduler::msUntilDue(unsigned long now) const {
+  portENTER_CRITICAL(&lock);
+  unsigned long wait = ULONG_MAX;
+  if (pending) {
+    wait = allowedIn(now);
+    if (!urgent) {
+      unsigned long waited = now - pendingSince;
+      if (waited < REFRESH_COALESCE_MS) {
+        wait = max(wait, REFRESH_COALESCE_MS - waited);
+      }
+    }
+  }
+  portEXIT_CRITICAL(&lock);
+  return wait;
+}
+
+bool RefreshScheduler::needsFullRefresh() const {
+  portENTER_CRITICAL(&lock);
+  bool full = ghost.partialRefreshes >= GHOST_MAX_PARTIAL_REFRESHES ||
+              ghost.flippedPixels >= GHOST_MAX_FLIPPED_PIXELS;
+  portEXIT_CRITICAL(&lock);
+  return full;
+}
+
+bool RefreshScheduler::beginRefresh() {
+  portENTER_CRITICAL(&lock);
+  bool wasPending = pending;
+  pending = false;
+  urgent = false;
+  portEXIT_CRITICAL(&lock);
+  return wasPending;
+}
+
+void RefreshScheduler::refreshed(unsigned long now, bool full, uint32_t changedPixels) {
+  portENTER_CRITICAL(&lock);
+  lastRefresh = now;
+  
+  if (full) {
+    fullRefreshes++;
+    memset(&ghost, 0, sizeof(ghost));
+  } else {
+    partialRefreshes++;
+    ghost.partialRefreshes++;
+    ghost.flippedPixels += changedPixels;
+  }
+  countRefresh(now, full);
+  portEXIT_CRITICAL(&lock);
+}
+
+void RefreshScheduler::fullScreenSent(unsigned long now) {
+  portENTER_CRITICAL(&lock);
+  lastRefresh = now;
+  fullRefreshes++;
+  memset(&ghost, 0, sizeof(ghost));
+  countRefresh(now, true);
+  portEXIT_CRITICAL(&lock);
+}
+
+GhostBudget RefreshScheduler::getGhostBudget() const {
+  portENTER_CRITICAL(&lock);
+  GhostBudget budget = ghost;
+  portEXIT_CRITICAL(&lock);
+  return budget;
+}
+
+void RefreshScheduler::setGhostBudget(const GhostBudget& budget) {
+  portENTER_CRITICAL(&lock);
+  ghost = budget;
+  portEXIT_CRITICAL(&lock);
+}
+
+void RefreshScheduler::countRefresh(unsigned long now, bool full) {
+  uint32_t epoch = now / HOUR_BUCKET_MS + 1; // 0 marks an unused bucket
+  uint8_t index = epoch % HOUR_BUCKETS;
+  if (bucketEpoch[index] != epoch) {
+    bucketEpoch[index] = epoch;
+    bucketFull[index] = 0;
+    bucketPartial[index] = 0;
+  }
+  if (full) {
+    bucketFull[index]++;
+  } else {
+    bucketPartial[index]++;
+  }
+}
+
+void RefreshScheduler::getStats(unsigned long now, RefreshStats& stats) const {
+  portENTER_CRITICAL(&lock);
+  stats.fullRefreshes = fullRefreshes;
+  stats.partialRefreshes = partialRefreshes;
+  stats.coalescedChanges = coalescedChanges;
+  stats.ghost = ghost;
+  stats.fullLastHour = 0;
+  stats.partialLastHour = 0;
+  
+  uint32_t epoch = now / HOUR_BUCKET_MS + 1;
+  for (uint8_t i = 0; i < HOUR_BUCKETS; i++) {
+    if (bucketEpoch[i] != 0 && epoch - bucketEpoch[i] < HOUR_BUCKETS) {
+      stats.fullLastHour += bucketFull[i];
+      stats.partialLastHour += bucketPartial[i];
+    }
+  }
+  portEXIT_CRITICAL(&lock);
+}
@@ -0,0 +1,93 @@
+#ifndef REFRESH_SCHEDULER_H
+#define REFRESH_SCHEDULER_H
+
+#include <Arduino.h>
+#include "config.h"
+
+// Partial refreshes since the last full one; full refreshes clear it
+struct GhostBudget {
+  uint16_t partialRefreshes;
+  uint32_t flippedPixels;    // Pixels changed by those partial refreshes, summed
+};
+
+struct RefreshStats {
+  uint32_t fullRefreshes;          // Since boot
+  uint32_t partialRefreshes;
+  uint16_t fullLastHour;
+  uint16_t partialLastHour;
+  uint32_t coalescedChanges;       // Changes that joined an already pending refresh
+  GhostBudget ghost;
+};
+
+// Decides when the panel refreshes and whether the refresh is full or partial.
+//
+// A change opens a coalescing window of REFRESH_COALESCE_MS; anything else
+// that changes inside it goes out with the same refresh. Urgent changes (user
+// actions, first data, new alarms) skip the window. Either way refreshes are
+// at least DISPLAY_MIN_REFRESH_INTERVAL apart.
+//
+// Partial refreshes leave ghosting behind in proportion to how often and how
+// much of the panel they flip, so a full refresh is used only once either
+// budget (GHOST_MAX_PARTIAL_REFRESHES, GHOST_MAX_FLIPPED_PIXELS) runs out.
+//
+// Changes come from the decode task while the main loop refreshes, so every
+// method takes the scheduler's spinlock.
+class RefreshScheduler {
+private:
+  static const uint8_t HOUR_BUCKETS = 12;   // Five minutes each
+  
+  mutable portMUX_TYPE lock;
+  unsigned long pendingSince;
+  unsigned long lastRefresh;
+  bool pending;
+  bool urgent;
+  GhostBudget ghost;
+  
+  uint32_t fullRefreshes;
+  uint32_t partialRefreshes;
+  uint32_t coalescedChanges;
+  
+  // Refreshes in the last hour, by five-minute bucket
+  uint32_t bucketEpoch[HOUR_BUCKETS];
+  uint16_t bucketFull[HOUR_BUCKETS];
+  uint16_t bucketPartial[HOUR_BUCKETS];
+  
+  void countRefresh(unsigned long now, bool full);
+  unsigned long allowedIn(unsigned long now) const;
+
+public:
+  RefreshScheduler();
+  
+  // Panel (re)initialised: nothing pending and no rate limit to wait out
+  void reset(unsigned long now);
+  
+  void changed(unsigned long now, bool urgent);
+  bool isPending() const;
+  
+  // Time until a pending change may be drawn; ULONG_MAX with nothing pending
+  unsigned long msUntilDue(unsigned long now) const;
+  
+  // Time until the rate limit allows any refresh
+  unsigned long msUntilAllowed(unsigned long now) const;
+  
+  bool needsFullRefresh() const;
+  
+  // A refresh is about to render the latest reading: what is pending now is
+  // drawn by it, changes from here on wait for the next one. Returns whether
+  // anything was pending.
+  bool beginRefresh();
+  
+  // The refresh reached the panel; changedPixels is what it flipped
+  void refreshed(unsigned long now, bool full, uint32_t changedPixels);
+  
+  // Another screen was drawn directly with a full refresh; pending changes stay pending
+  void fullScreenSent(unsigned long now);
+  
+  // Carried across deep sleep with the panel snapshot
+  GhostBudget getGhostBudget() const;
+  void setGhostBudget(const GhostBudget& budget);
+  
+  void getStats(unsigned long now, RefreshStats& stats) const;
+};
+
+#endif // REFRESH_SCHEDULER_H
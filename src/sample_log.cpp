@@ -0,0 +1,305 @@
+#include "sample_log.h"
+#include <time.h>
+
+#define LOG_DIR "/log"
+#define LOG_PENDING_MAGIC 0x534C4F47UL  // "SLOG"
+
+// Records not yet on flash. RTC memory: survives deep sleep, and is
+// reinitialised (invalid) on power-on or any other reset.
+struct PendingBatch {
+  uint32_t magic;
+  uint32_t nextSeq;
+  uint16_t boot;
+  uint8_t count;
+  LogRecord records[LOG_BATCH_RECORDS];
+};
+
+RTC_DATA_ATTR static PendingBatch pending;
+
+SampleLog::SampleLog()
+  : mounted(false), firstSegment(0), lastSegment(0), hasSegments(false), lastSegmentBytes(0),
+    totalBytes(0), flushCount(0), droppedRecords(0) {
+}
+
+void SampleLog::segmentPath(uint32_t segment, char* path, size_t size) {
+  snprintf(path, size, LOG_DIR "/%08lu.bin", (unsigned long)segment);
+}
+
+bool SampleLog::mount() {
+  if (mounted) {
+    return true;
+  }
+  
+  // Formats a blank or corrupt partition
+  if (!LittleFS.begin(true)) {
+    Serial.println("Sample log: filesystem unavailable");
+    return false;
+  }
+  if (!LittleFS.exists(LOG_DIR)) {
+    LittleFS.mkdir(LOG_DIR);
+  }
+  
+  scanSegments();
+  mounted = true;
+  return true;
+}
+
+void SampleLog::scanSegments() {
+  hasSegments = false;
+  totalBytes = 0;
+  lastSegmentBytes = 0;
+  
+  File dir = LittleFS.open(LOG_DIR);
+  if (!dir || !dir.isDirectory()) {
+    return;
+  }
+  
+  for (File entry = dir.openNextFile(); entry; entry = dir.openNextFile()) {
+    const char* name = strrchr(entry.name(), '/');
+    name = name ? name + 1 : entry.name();
+    char* end;
+    uint32_t segment = strtoul(name, &end, 10);
+    if (end == name || strcmp(end, ".bin") != 0) {
+      continue;
+    }
+    
+    uint32_t size = entry.size();
+    totalBytes += size;
+    if (!hasSegments || segment < firstSegment) {
+      firstSegment = segment;
+    }
+    if (!hasSegments || segment > lastSegment) {
+      lastSegment = segment;
+      lastSegmentBytes = size;
+    }
+    hasSegments = true;
+  }
+}
+
+bool SampleLog::readLastRecord(LogRecord& record) {
+  if (!hasSegments) {
+    return false;
+  }
+  
+  char path[24];
+  segmentPath(lastSegment, path, sizeof(path));
+  File file = LittleFS.open(path, FILE_READ);
+  if (!file) {
+    return false;
+  }
+  
+  // Segments normally end on a whole frame; try that before scanning
+  uint8_t frame[LOG_FRAME_BYTES];
+  bool found = false;
+  LogFrameParser parser;
+  if (file.size() >= LOG_FRAME_BYTES && file.seek(file.size() - LOG_FRAME_BYTES) &&
+      file.read(frame, sizeof(frame)) == sizeof(frame)) {
+    bool complete;
+    parser.feed(frame, sizeof(frame), record, complete);
+    found = complete;
+  }
+  
+  if (!found) {
+    file.seek(0);
+    LogRecord candidate;
+    uint8_t buffer[256];
+    size_t length;
+    while ((length = file.read(buffer, sizeof(buffer))) > 0) {
+      size_t used = 0;
+      while (used < length) {
+        bool complete;
+        used += parser.feed(buffer + used, length - used, candidate, complete);
+        if (complete) {
+          record = candidate;
+          found = true;
+        }
+      }
+    }
+  }
+  
+  file.close();
+  return found;
+}
+
+bool SampleLog::begin() {
+  if (pending.magic == LOG_PENDING_MAGIC) {
+    Serial.printf("Sample log: %u records pending, next %u\n", pending.count, pending.nextSeq);
+    return true;
+  }
+  
+  if (!mount()) {
+    return false;
+  }
+  
+  LogRecord last;
+  bool found = readLastRecord(last);
+  memset(&pending, 0, sizeof(pending));
+  pending.nextSeq = found ? last.seq + 1 : 0;
+  pending.boot = found ? last.boot + 1 : 0;
+  pending.magic = LOG_PENDING_MAGIC;
+  
+  Serial.printf("Sample log: %u bytes on flash, boot %u, next record %u\n",
+                totalBytes, pending.boot, pending.nextSeq);
+  return true;
+}
+
+void SampleLog::append(const BatteryData& data) {
+  if (pending.magic != LOG_PENDING_MAGIC) {
+    return;
+  }
+  if (pending.count == LOG_BATCH_RECORDS && !flush()) {
+    droppedRecords++;
+    return;
+  }
+  
+  LogRecord& record = pending.records[pending.count++];
+  record.seq = pending.nextSeq++;
+  record.time = (uint32_t)time(nullptr);
+  record.boot = pending.boot;
+  record.socTenths = (int16_t)lroundf(data.soc * 10.0f);
+  record.centivolts = lroundf(data.voltage * 100.0f);
+  record.centiamps = lroundf(data.current * 100.0f);
+  record.consumedCentiAh = lroundf(data.consumed_ah * 100.0f);
+  
+  if (pending.count == LOG_BATCH_RECORDS) {
+    flush();
+  }
+}
+
+bool SampleLog::flush() {
+  if (pending.magic != LOG_PENDING_MAGIC || pending.count == 0) {
+    return true;
+  }
+  if (!mount()) {
+    return false;
+  }
+  
+  static uint8_t frames[LOG_BATCH_RECORDS * LOG_FRAME_BYTES];
+  size_t bytes = 0;
+  for (uint8_t i = 0; i < pending.count; i++) {
+    logEncodeFrame(pending.records[i], frames + bytes);
+    bytes += LOG_FRAME_BYTES;
+  }
+  
+  // A batch never straddles segments
+  if (!hasSegments || lastSegmentBytes + bytes > LOG_SEGMENT_BYTES) {
+    if (hasSegments) {
+      lastSegment++;
+    } else {
+      firstSegment = lastSegment = 0;
+      hasSegments = true;
+    }
+    lastSegmentBytes = 0;
+  }
+  
+  char path[24];
+  segmentPath(lastSegment, path, sizeof(path));
+  File file = LittleFS.open(path, FILE_APPEND);
+  if (!file) {
+    Serial.printf("Sample log: cannot open %s\n", path);
+    return false;
+  }
+  size_t written = file.write(frames, bytes);
+  file.close();
+  
+  lastSegmentBytes += written;
+  totalBytes += written;
+  
+  // After a short write, readers skip the partial frame; keep what did not make it for another try
+  if (written != bytes) {
+    uint8_t whole = written / LOG_FRAME_BYTES;
+    pending.count -= whole;
+    memmove(pending.records, pending.records + whole, pending.count * sizeof(LogRecord));
+    Serial.println("Sample log: write failed");
+    return false;
+  }
+  
+  pending.count = 0;
+  flushCount++;
+  trimToLimit();
+  return true;
+}
+
+void SampleLog::trimToLimit() {
+  while (totalBytes > LOG_MAX_BYTES && firstSegment < lastSegment) {
+    char path[24];
+    segmentPath(firstSegment, path, sizeof(path));
+    File file = LittleFS.open(path, FILE_READ);
+    uint32_t size = file ? file.size() : 0;
+    file.close();
+    LittleFS.remove(path);
+    totalBytes -= size;
+    firstSegment++;
+  }
+}
+
+uint8_t SampleLog::getPendingCount() const {
+  return pending.magic == LOG_PENDING_MAGIC ? pending.count : 0;
+}
+
+SampleLog::Reader::Reader(const SampleLog& sampleLog)
+  : log(sampleLog), segment(sampleLog.firstSegment), done(!sampleLog.mounted || !sampleLog.hasSegments),
+    length(0), position(0) {
+}
+
+bool SampleLog::Reader::openSegment() {
+  // Segments deleted by trimming leave gaps in the numbering only at the front
+  while (segment <= log.lastSegment) {
+    char path[24];
+    segmentPath(segment++, path, sizeof(path));
+    file = LittleFS.open(path, FILE_READ);
+    if (file) {
+      return true;
+    }
+  }
+  done = true;
+  return false;
+}
+
+bool SampleLog::Reader::next(LogRecord& record) {
+  while (!done) {
+    if (position == length) {
+      length = file ? file.read(buffer, sizeof(buffer)) : 0;
+      position = 0;
+      if (length == 0) {
+        if (file) {
+          file.close();
+        }
+        openSegment();
+        continue;
+      }
+    }
+    
+    bool complete;
+    position += parser.feed(buffer + position, length - position, record, complete);
+    if (complete) {
+      return true;
+    }
+  }
+  return false;
+}
+
+SampleLog::RawReader::RawReader(const SampleLog& sampleLog)
+  : log(sampleLog), segment(sampleLog.firstSegment), done(!sampleLog.mounted || !sampleLog.hasSegments) {
+}
+
+size_t SampleLog::RawReader::read(uint8_t* buffer, size_t size) {
+  while (!done) {
+    if (file) {
+      size_t length = file.read(buffer, size);
+      if (length > 0) {
+        return length;
+      }
+      file.close();
+    }
+    
+    if (segment > log.lastSegment) {
+      done = true;
+      break;
+    }
+    char path[24];
+    segmentPath(segment++, path, sizeof(path));
+    file = LittleFS.open(path, FILE_READ);
+  }
+  return 0;
+}
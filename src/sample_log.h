@@ -0,0 +1,89 @@
+#ifndef SAMPLE_LOG_H
+#define SAMPLE_LOG_H
+
+#include <Arduino.h>
+#include <LittleFS.h>
+#include "config.h"
+#include "display.h"
+#include "log_format.h"
+
+// Append-only log of samples on the LittleFS data partition, kept across
+// reboots and deep sleep. Records are framed and CRC-checked (log_format.h)
+// and collected in a batch that lives in RTC memory, so flash is written
+// LOG_BATCH_RECORDS at a time and a batch survives deep sleep unwritten.
+//
+// The log is a run of numbered segment files of up to LOG_SEGMENT_BYTES.
+// Only the newest segment is appended to; once the log exceeds
+// LOG_MAX_BYTES the oldest segment is deleted. Nothing is ever rewritten,
+// which leaves wear levelling to the filesystem.
+class SampleLog {
+private:
+  bool mounted;
+  uint32_t firstSegment;     // Oldest segment number on flash
+  uint32_t lastSegment;      // Segment being appended to
+  bool hasSegments;
+  uint32_t lastSegmentBytes;
+  uint32_t totalBytes;
+  
+  // Statistics since boot
+  uint32_t flushCount;
+  uint32_t droppedRecords;
+  
+  bool mount();
+  void scanSegments();
+  bool readLastRecord(LogRecord& record);
+  void trimToLimit();
+  static void segmentPath(uint32_t segment, char* path, size_t size);
+
+public:
+  // Oldest to newest over the records on flash; the pending batch is not included
+  class Reader {
+  private:
+    const SampleLog& log;
+    uint32_t segment;
+    bool done;
+    File file;
+    LogFrameParser parser;
+    uint8_t buffer[512];
+    size_t length;
+    size_t position;
+    
+    bool openSegment();
+  
+  public:
+    explicit Reader(const SampleLog& sampleLog);
+    bool next(LogRecord& record);
+    uint32_t getSkippedBytes() const { return parser.getSkippedBytes(); }
+  };
+  
+  // Raw segment bytes, oldest first, for a binary download
+  class RawReader {
+  private:
+    const SampleLog& log;
+    uint32_t segment;
+    bool done;
+    File file;
+  
+  public:
+    explicit RawReader(const SampleLog& sampleLog);
+    size_t read(uint8_t* buffer, size_t size); // 0 at the end
+  };
+  
+  SampleLog();
+  
+  // On a cold start, mounts the filesystem and continues numbering after the
+  // last record on flash. After deep sleep the retained batch already knows,
+  // and the filesystem is left alone until the batch is written.
+  bool begin();
+  
+  void append(const BatteryData& data);
+  bool flush(); // Write the pending batch now
+  
+  uint8_t getPendingCount() const;
+  uint32_t getBytesOnFlash() const { return totalBytes; }
+  uint32_t getRecordEstimate() const { return totalBytes / LOG_FRAME_BYTES; }
+  uint32_t getFlushCount() const { return flushCount; }
+  uint32_t getDroppedRecords() const { return droppedRecords; }
+};
+
+#endif // SAMPLE_LOG_H
@@ -0,0 +1,154 @@
+#include "sampling_mode.h"
+#include "victron_ble.h"
+#include "display.h"
+#include "config_server.h"
+#include "main_events.h"
+#include "power_manager.h"
+#include "sample_log.h"
+#include "deferred_log.h"
+#include "esp_sleep.h"
+#include "driver/gpio.h"
+#include <new>
+
+#define RETAINED_MAGIC 0x53414D50UL  // "SAMP"
+
+// Survives deep sleep; reloaded from flash (and so invalid) on power-on
+//
+// BatteryData's default values and TimeEstimator's constructor make this a
+// type with a constructor, and a static object of it would be constructed on
+// every wake, wiping the readings and estimators the sleep kept. It lives in
+// raw storage instead: enter() constructs it, and a wake takes what is there
+// once isSampleWakeup() has checked the magic and size.
+struct RetainedState {
+  uint32_t magic;
+  uint16_t size;                   // Catches a layout change across firmware updates
+  uint8_t deviceCount;
+  int8_t view;
+  uint8_t misses;                  // Samples in a row without every device heard
+  uint32_t cycles;
+  DeviceConfig devices[MAX_VICTRON_DEVICES];
+  DecoderState decoders[MAX_VICTRON_DEVICES];
+  Display::Snapshot panel;
+};
+
+RTC_DATA_ATTR static uint8_t retainedStorage[sizeof(RetainedState)] __attribute__((aligned(alignof(RetainedState))));
+static RetainedState& retained = *reinterpret_cast<RetainedState*>(retainedStorage);
+
+static void sleepUntilNextSample() {
+  retained.magic = RETAINED_MAGIC;
+  retained.size = sizeof(retained);
+  
+  // Keep the sample period steady regardless of how long this wake took
+  uint64_t sleepMs = SAMPLE_INTERVAL_S * 1000UL;
+  unsigned long awakeMs = millis();
+  sleepMs = awakeMs + 1000 < sleepMs ? sleepMs - awakeMs : 1000;
+  
+  esp_sleep_enable_timer_wakeup(sleepMs * 1000ULL);
+  esp_sleep_enable_ext0_wakeup((gpio_num_t)CONFIG_BUTTON_PIN, 0);
+  
+  Serial.printf("Awake %lu ms, next sample in %lu ms\n", awakeMs, (unsigned long)sleepMs);
+  DeferredLog::flush();
+  Serial.flush();
+  esp_deep_sleep_start();
+}
+
+bool SamplingMode::isSampleWakeup() {
+  return esp_sleep_get_wakeup_cause() == ESP_SLEEP_WAKEUP_TIMER &&
+         retained.magic == RETAINED_MAGIC && retained.size == sizeof(retained) &&
+         retained.deviceCount > 0;
+}
+
+void SamplingMode::runCycle() {
+  retained.cycles++;
+  Serial.printf("=== Sample %u ===\n", retained.cycles);
+  
+  PowerManager::begin();
+  MainEvents::begin();
+  
+  VictronBLE* ble = new VictronBLE();
+  for (uint8_t i = 0; i < retained.deviceCount; i++) {
+    ble->addDevice(retained.devices[i].mac_address, retained.devices[i].encryption_key);
+  }
+  if (ble->getDeviceCount() == 0 || !ble->begin()) {
+    Serial.println("BLE failed to initialize");
+    sleepUntilNextSample();
+  }
+  ble->restoreState(retained.decoders, retained.deviceCount);
+  ble->setDecodeNotify(true);
+  ble->startScanning();
+  
+  // Scan until every device has reported once; a repeated packet counts
+  unsigned long scanStart = millis();
+  bool sampled;
+  while (!(sampled = ble->allDevicesUpdatedSince(scanStart))) {
+    unsigned long elapsed = millis() - scanStart;
+    if (elapsed >= SAMPLE_SCAN_TIMEOUT_MS) {
+      break;
+    }
+    MainEvents::wait(SAMPLE_SCAN_TIMEOUT_MS - elapsed);
+  }
+  ble->stopScanning();
+  ble->saveState(retained.decoders);
+  Serial.printf("Scan %s after %lu ms\n", sampled ? "complete" : "timed out", millis() - scanStart);
+  
+  // Batched in RTC memory; flash is only touched when a batch fills up
+  if (sampled) {
+    SampleLog log;
+    if (log.begin()) {
+      log.append(ble->getCombinedData());
+    }
+  }
+  
+  // A missed sample leaves the last reading up; only a run of them replaces it with NO DATA
+  if (sampled) {
+    retained.misses = 0;
+  } else if (retained.misses < UINT8_MAX) {
+    retained.misses++;
+  }
+  
+  if (sampled || retained.misses == SAMPLE_MAX_MISSES) {
+    Display* display = new Display();
+    
+    // The ghosting budget comes back with the snapshot; refresh() goes
+    // full by itself once the partial updates have used it up
+    bool ready = display->resume(retained.panel);
+    if (!ready) {
+      ready = display->begin(false);
+    }
+    
+    if (ready) {
+      ble->setDisplay(display);
+      ble->setView(retained.view);
+      display->requestRedraw();
+      display->refresh();
+      display->saveSnapshot(retained.panel);
+    } else {
+      retained.panel.valid = false;
+    }
+    display->powerOff();
+  }
+  
+  sleepUntilNextSample();
+}
+
+void SamplingMode::enter(VictronBLE* ble, Display* display, ConfigServer* config) {
+  new (retainedStorage) RetainedState();
+  
+  retained.deviceCount = config->getDeviceCount();
+  for (uint8_t i = 0; i < retained.deviceCount; i++) {
+    retained.devices[i] = config->getDevice(i);
+  }
+  
+  if (ble) {
+    ble->stopScanning();
+    ble->saveState(retained.decoders);
+    retained.view = ble->getView();
+  }
+  
+  if (display) {
+    display->saveSnapshot(retained.panel);
+    display->powerOff();
+  }
+  
+  sleepUntilNextSample();
+}
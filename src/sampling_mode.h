@@ -0,0 +1,29 @@
+#ifndef SAMPLING_MODE_H
+#define SAMPLING_MODE_H
+
+#include <Arduino.h>
+#include "config.h"
+
+class VictronBLE;
+class Display;
+class ConfigServer;
+
+// Timer-driven deep-sleep sampling. The chip sleeps between samples; each
+// timer wakeup scans until every configured device has been heard (or
+// SAMPLE_SCAN_TIMEOUT_MS passes), updates the panel if the rendered frame
+// changed and sleeps again. Device config, decoder state, the last readings
+// and what the panel shows are kept in RTC memory, so a sample skips NVS,
+// the test screen and the full refresh of a cold boot. A button press wakes
+// into the normal interactive mode.
+namespace SamplingMode {
+  // This boot is a sample timer wakeup with retained state to resume from
+  bool isSampleWakeup();
+
+  // Take one sample and sleep again; does not return
+  void runCycle();
+
+  // Retain the interactive session's state and sleep until the first sample; does not return
+  void enter(VictronBLE* ble, Display* display, ConfigServer* config);
+}
+
+#endif // SAMPLING_MODE_H
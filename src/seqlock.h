@@ -0,0 +1,85 @@
+#ifndef SEQLOCK_H
+#define SEQLOCK_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <atomic>
+#include <type_traits>
+
+// Lock-free snapshot of a small trivially copyable value for one writer task
+// and any number of reader tasks. The writer never waits: it bumps the
+// sequence to odd, stores the words and bumps it to even again. A reader
+// copies the words and keeps the copy only if the sequence was even and
+// unchanged across it, so it never sees half of one write and half of
+// another. Words are relaxed atomics, which compile to plain loads and stores
+// on the ESP32, so there is no data race for the compiler to exploit either.
+//
+// A reader retries while a write is in progress. The writer must not be
+// preempted by a reader on its own core mid-write, or the reader would spin
+// until the writer is scheduled again, which at a higher priority is never.
+// A writer that runs below any of its readers' priorities writes inside a
+// critical section.
+template <typename T>
+class SeqLock {
+  static_assert(std::is_trivially_copyable<T>::value, "SeqLock needs a trivially copyable type");
+
+private:
+  static const size_t WORDS = (sizeof(T) + sizeof(uint32_t) - 1) / sizeof(uint32_t);
+
+  std::atomic<uint32_t> sequence;     // Odd while a write is in progress
+  std::atomic<uint32_t> words[WORDS];
+
+public:
+  SeqLock() : sequence(0) {
+    for (size_t i = 0; i < WORDS; i++) {
+      words[i].store(0, std::memory_order_relaxed);
+    }
+  }
+
+  // Writer only
+  void write(const T& value) {
+    uint32_t buffer[WORDS];
+    buffer[WORDS - 1] = 0;
+    memcpy(buffer, &value, sizeof(T));
+
+    uint32_t seq = sequence.load(std::memory_order_relaxed);
+    sequence.store(seq + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    for (size_t i = 0; i < WORDS; i++) {
+      words[i].store(buffer[i], std::memory_order_relaxed);
+    }
+    sequence.store(seq + 2, std::memory_order_release);
+  }
+
+  // One attempt; false if a write overlapped it and out is unchanged
+  bool tryRead(T& out) const {
+    uint32_t before = sequence.load(std::memory_order_acquire);
+    if (before & 1) {
+      return false;
+    }
+    uint32_t buffer[WORDS];
+    for (size_t i = 0; i < WORDS; i++) {
+      buffer[i] = words[i].load(std::memory_order_relaxed);
+    }
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (sequence.load(std::memory_order_relaxed) != before) {
+      return false;
+    }
+    memcpy(&out, buffer, sizeof(T));
+    return true;
+  }
+
+  void read(T& out) const {
+    while (!tryRead(out)) {
+    }
+  }
+
+  T read() const {
+    T value;
+    read(value);
+    return value;
+  }
+};
+
+#endif // SEQLOCK_H
@@ -0,0 +1,67 @@
+#ifndef SPSC_RING_H
+#define SPSC_RING_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <atomic>
+
+// Fixed-size lock-free ring for exactly one producer and one consumer task.
+// Slots are filled in place (reserve/commit) and drained in place
+// (peek/release) so each element is copied only once. A full ring drops the
+// new element and counts it rather than blocking the producer.
+template <typename T, size_t Capacity>
+class SpscRing {
+  static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0,
+                "ring capacity must be a power of two");
+
+private:
+  T slots[Capacity];
+  std::atomic<uint32_t> head;  // written by producer only
+  std::atomic<uint32_t> tail;  // written by consumer only
+  std::atomic<uint32_t> dropped;
+  std::atomic<uint32_t> highWater;
+
+public:
+  SpscRing() : head(0), tail(0), dropped(0), highWater(0) {}
+
+  // Producer: slot to fill, or nullptr (and a counted drop) when full
+  T* reserve() {
+    uint32_t h = head.load(std::memory_order_relaxed);
+    if (h - tail.load(std::memory_order_acquire) >= Capacity) {
+      dropped.fetch_add(1, std::memory_order_relaxed);
+      return nullptr;
+    }
+    return &slots[h & (Capacity - 1)];
+  }
+
+  // Producer: publish the slot returned by reserve()
+  void commit() {
+    uint32_t h = head.load(std::memory_order_relaxed) + 1;
+    head.store(h, std::memory_order_release);
+
+    uint32_t depth = h - tail.load(std::memory_order_acquire);
+    if (depth > highWater.load(std::memory_order_relaxed)) {
+      highWater.store(depth, std::memory_order_relaxed);
+    }
+  }
+
+  // Consumer: oldest element, or nullptr when empty
+  const T* peek() const {
+    uint32_t t = tail.load(std::memory_order_relaxed);
+    if (t == head.load(std::memory_order_acquire)) {
+      return nullptr;
+    }
+    return &slots[t & (Capacity - 1)];
+  }
+
+  // Consumer: hand the slot returned by peek() back to the producer
+  void release() {
+    tail.store(tail.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+  }
+
+  size_t capacity() const { return Capacity; }
+  uint32_t getDropped() const { return dropped.load(std::memory_order_relaxed); }
+  uint32_t getHighWater() const { return highWater.load(std::memory_order_relaxed); }
+};
+
+#endif // SPSC_RING_H
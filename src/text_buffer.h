@@ -0,0 +1,78 @@
+#ifndef TEXT_BUFFER_H
+#define TEXT_BUFFER_H
+
+#include <Arduino.h>
+
+// Builds a NUL-terminated string in a caller-owned buffer without touching
+// the heap. Numbers are formatted with integer arithmetic only; output that
+// does not fit is truncated.
+class TextBuffer {
+private:
+  char* buffer;
+  size_t size;
+  size_t length;
+
+public:
+  TextBuffer(char* buf, size_t bufSize) : buffer(buf), size(bufSize), length(0) {
+    if (size > 0) {
+      buffer[0] = '\0';
+    }
+  }
+
+  TextBuffer& text(const char* str) {
+    while (*str) {
+      character(*str++);
+    }
+    return *this;
+  }
+
+  TextBuffer& character(char c) {
+    if (length + 1 < size) {
+      buffer[length++] = c;
+      buffer[length] = '\0';
+    }
+    return *this;
+  }
+
+  TextBuffer& number(long value) {
+    if (value < 0) {
+      character('-');
+      return number((unsigned long)(-(value + 1)) + 1);
+    }
+    return number((unsigned long)value);
+  }
+
+  TextBuffer& number(unsigned long value) {
+    char digits[10];
+    uint8_t count = 0;
+    do {
+      digits[count++] = '0' + value % 10;
+      value /= 10;
+    } while (value > 0);
+    while (count > 0) {
+      character(digits[--count]);
+    }
+    return *this;
+  }
+
+  TextBuffer& number(int value) { return number((long)value); }
+  TextBuffer& number(unsigned int value) { return number((unsigned long)value); }
+
+  // One decimal place, rounded half away from zero; the sign follows the
+  // value itself as String(value, 1) does ("-0.0" for -0.04)
+  TextBuffer& tenths(float value) {
+    bool negative = value < 0;
+    unsigned long scaled = (unsigned long)((negative ? -value : value) * 10.0f + 0.5f);
+    if (negative) {
+      character('-');
+    }
+    number(scaled / 10);
+    character('.');
+    return character('0' + scaled % 10);
+  }
+
+  const char* c_str() const { return buffer; }
+  size_t len() const { return length; }
+};
+
+#endif // TEXT_BUFFER_H
@@ -0,0 +1,117 @@
+#include "time_estimator.h"
+#include "deferred_log.h"
+
+// SmartShunt SOC resolution is 0.1 %
+#define SOC_RESOLUTION_PERCENT 0.1f
+
+void TimeEstimator::reset() {
+  filteredCurrent = 0.0f;
+  variance = 0.0f;
+  lastCurrent = 0.0f;
+  remainingAh = 0.0f;
+  lastTimestamp = 0;
+  startTimestamp = 0;
+  started = false;
+}
+
+void TimeEstimator::update(float current, float soc, float capacityAh, unsigned long timestamp) {
+  unsigned long elapsedMs = timestamp - lastTimestamp;
+  
+  // Start over after a gap; what was averaged before says little about now
+  if (!started || elapsedMs > TTG_RESET_GAP_MS) {
+    if (soc <= 0.0f) {
+      return; // Nothing to count from yet
+    }
+    filteredCurrent = current;
+    variance = 0.0f;
+    lastCurrent = current;
+    remainingAh = soc / 100.0f * capacityAh;
+    lastTimestamp = timestamp;
+    startTimestamp = timestamp;
+    started = true;
+    return;
+  }
+  
+  float dt = elapsedMs / 1000.0f;
+  
+  // Coulomb counting between readings (trapezoid over the interval)
+  remainingAh += (current + lastCurrent) * 0.5f * dt / 3600.0f;
+  remainingAh = max(0.0f, min(remainingAh, capacityAh));
+  lastCurrent = current;
+  lastTimestamp = timestamp;
+  
+  if (soc > 0.0f) {
+    float reportedAh = soc / 100.0f * capacityAh;
+    if (fabsf(reportedAh - remainingAh) > SOC_RESOLUTION_PERCENT / 100.0f * capacityAh) {
+      remainingAh = reportedAh;
+    }
+  }
+  
+  // Time-based EWMA of the current and of its spread around the average
+  float alpha = 1.0f - expf(-dt / TTG_SMOOTHING_S);
+  float residual = current - filteredCurrent;
+  filteredCurrent += alpha * residual;
+  variance = (1.0f - alpha) * (variance + alpha * residual * residual);
+}
+
+void TimeEstimator::rebase(unsigned long timestamp) {
+  startTimestamp = timestamp - (lastTimestamp - startTimestamp);
+  lastTimestamp = timestamp;
+}
+
+TimeEstimate TimeEstimator::estimate(float capacityAh) const {
+  TimeEstimate result;
+  result.current = filteredCurrent;
+  result.remainingAh = remainingAh;
+  result.capacityAh = capacityAh;
+  result.confidence = 0;
+  result.valid = started;
+  
+  if (!started) {
+    return result;
+  }
+  
+  // Confidence grows over the first time constant and drops with the
+  // spread of the current relative to its average
+  float warmUp = min(1.0f, (lastTimestamp - startTimestamp) / 1000.0f / TTG_SMOOTHING_S);
+  float spread = sqrtf(variance) / max(fabsf(filteredCurrent), MIN_CURRENT_THRESHOLD);
+  result.confidence = (uint8_t)(100.0f * warmUp / (1.0f + spread * spread) + 0.5f);
+  
+  return result;
+}
+
+void applyTimeEstimate(BatteryData& batteryData, const TimeEstimate& estimate) {
+  batteryData.calculated_time_remaining_minutes = 0;
+  batteryData.calculated_time_to_full_minutes = 0;
+  batteryData.time_calculation_valid = false;
+  batteryData.time_confidence = 0;
+  
+  if (!batteryData.data_valid || !estimate.valid || estimate.remainingAh <= 0.0f) {
+    return;
+  }
+  
+  float current_abs = fabsf(estimate.current);
+  
+  if (current_abs < MIN_CURRENT_THRESHOLD) {
+    return;
+  }
+  
+  if (estimate.current < -MIN_CURRENT_THRESHOLD) {
+    float time_hours = estimate.remainingAh / current_abs;
+    batteryData.calculated_time_remaining_minutes = (uint16_t)min(time_hours * 60.0f, 65535.0f);
+    batteryData.time_calculation_valid = true;
+    
+    LOG_DEBUG("Discharging: %.1fAh remaining, %.1fA draw, %.1fh remaining (confidence %u%%)\n",
+              estimate.remainingAh, current_abs, time_hours, estimate.confidence);
+                  
+  } else {
+    float capacity_needed_ah = max(estimate.capacityAh - estimate.remainingAh, 0.0f);
+    float time_hours = capacity_needed_ah / current_abs;
+    batteryData.calculated_time_to_full_minutes = (uint16_t)min(time_hours * 60.0f, 65535.0f);
+    batteryData.time_calculation_valid = true;
+    
+    LOG_DEBUG("Charging: %.1fAh needed, %.1fA charge, %.1fh to full (confidence %u%%)\n",
+              capacity_needed_ah, current_abs, time_hours, estimate.confidence);
+  }
+  batteryData.time_confidence = estimate.confidence;
+}
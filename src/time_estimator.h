@@ -0,0 +1,53 @@
+#ifndef TIME_ESTIMATOR_H
+#define TIME_ESTIMATOR_H
+
+#include <Arduino.h>
+#include "config.h"
+#include "display.h"
+
+// What the time-to-go / time-to-full figures are computed from
+struct TimeEstimate {
+  float current;       // Smoothed battery current, negative when discharging
+  float remainingAh;   // Charge left in the battery
+  float capacityAh;
+  uint8_t confidence;  // 0-100: how settled the smoothed current is
+  bool valid;
+};
+
+// Smooths the battery current for the time estimates, one O(1) step per
+// reading. The current is averaged with a time-based EWMA (TTG_SMOOTHING_S),
+// so load spikes no longer swing TTG/TTC and readings that arrive in bursts
+// weigh no more than evenly spaced ones. Its exponentially weighted variance
+// and the time since the estimate (re)started give the confidence value.
+//
+// Between SOC steps, and across records that carry no SOC, the remaining
+// charge is carried forward by counting the measured current; it is pulled
+// back to the reported SOC as soon as the two differ by more than the SOC
+// resolution.
+class TimeEstimator {
+private:
+  float filteredCurrent;
+  float variance;
+  float lastCurrent;
+  float remainingAh;
+  unsigned long lastTimestamp;
+  unsigned long startTimestamp;
+  bool started;
+
+public:
+  TimeEstimator() { reset(); }
+  void reset();
+  
+  // soc <= 0 means the reading carried no state of charge
+  void update(float current, float soc, float capacityAh, unsigned long timestamp);
+  TimeEstimate estimate(float capacityAh) const;
+  
+  // Move the last reading to this timestamp, keeping the time since the start
+  void rebase(unsigned long timestamp);
+  bool isStarted() const { return started; }
+};
+
+// Fill BatteryData's calculated time fields from an estimate
+void applyTimeEstimate(BatteryData& batteryData, const TimeEstimate& estimate);
+
+#endif // TIME_ESTIMATOR_H
@@ -1,27 +1,65 @@
 #include "victron_ble.h"
-#include <mbedtls/aes.h>
+#include "main_events.h"
+#include "power_manager.h"
+#include "boot_profiler.h"
+#include "victron_record.h"
+#include "adv_capture.h"
+#include "energy_meter.h"
+#include "deferred_log.h"
 
-VictronBLE::VictronBLE(const char* macAddress, const char* encryptionKeyStr) {
-  targetAddress = macStringToAddress(macAddress);
-  hexStringToBytes(encryptionKeyStr, encryptionKey, 16);
+VictronBLE::VictronBLE() {
   pBLEScan = nullptr;
   display = nullptr;
+  currentView = 0;
+  decodeTask = nullptr;
+  callbackCount = 0;
+  decodeNotify = false;
+}
+
+VictronBLE::~VictronBLE() {
+#if VICTRON_RAW_SCAN
+  ble_gap_disc_cancel();
+#endif
+  if (pBLEScan) {
+    pBLEScan->stop();
+  }
+  if (decodeTask) {
+    vTaskDelete(decodeTask);
+  }
+  EnergyMeter::setScanning(false);
+}
+
+bool VictronBLE::addDevice(const char* macAddress, const char* encryptionKey) {
+  if (devices.add(macAddress, encryptionKey) < 0) {
+    Serial.printf("Cannot add device %s\n", macAddress);
+    return false;
+  }
+  return true;
 }
 
 bool VictronBLE::begin() {
   NimBLEDevice::init("Victron_Reader");
   NimBLEDevice::setPower(ESP_PWR_LVL_P9);
   
+#if !VICTRON_RAW_SCAN
   pBLEScan = NimBLEDevice::getScan();
   if (!pBLEScan) {
     return false;
   }
   
   pBLEScan->setAdvertisedDeviceCallbacks(new VictronAdvertisingCallback(this));
-  pBLEScan->setInterval(100);
-  pBLEScan->setWindow(50);
+  pBLEScan->setInterval(BLE_SCAN_INTERVAL_MS);
+  pBLEScan->setWindow(BLE_SCAN_WINDOW_MS);
   pBLEScan->setActiveScan(false);
   pBLEScan->setDuplicateFilter(false);
+#endif
+  
+  // Decrypt, parse and display updates run here, off the NimBLE host task
+  if (xTaskCreatePinnedToCore(decodeTaskEntry, "victron_decode", DECODE_TASK_STACK_SIZE,
+                              this, DECODE_TASK_PRIORITY, &decodeTask, DECODE_TASK_CORE) != pdPASS) {
+    decodeTask = nullptr;
+    return false;
+  }
   
   return true;
 }
@@ -31,13 +69,128 @@ void VictronBLE::setDisplay(Display* disp) {
 }
 
 void VictronBLE::startScanning() {
+#if VICTRON_RAW_SCAN
+  bool started = startRawScan();
+#else
+  bool started = pBLEScan && pBLEScan->start(0, nullptr, false);
+#endif
+  if (started) {
+    EnergyMeter::setScanning(true);
+  }
+}
+
+void VictronBLE::stopScanning() {
+#if VICTRON_RAW_SCAN
+  ble_gap_disc_cancel();
+#else
   if (pBLEScan) {
-    pBLEScan->start(0, nullptr, false);
+    pBLEScan->stop();
+  }
+#endif
+  EnergyMeter::setScanning(false);
+}
+
+#if VICTRON_RAW_SCAN
+bool VictronBLE::startRawScan() {
+  // Let the controller drop everything not sent by a configured device. The
+  // address type of a Victron product is not part of its config, so each MAC
+  // is listed as both public and random static.
+  ble_addr_t whitelist[MAX_VICTRON_DEVICES * 2];
+  uint8_t whitelistCount = 0;
+  for (uint8_t i = 0; i < devices.size(); i++) {
+    uint64_t mac = devices[i].mac;
+    for (uint8_t type = BLE_ADDR_PUBLIC; type <= BLE_ADDR_RANDOM; type++) {
+      ble_addr_t& entry = whitelist[whitelistCount++];
+      entry.type = type;
+      for (int b = 0; b < 6; b++) {
+        entry.val[b] = (mac >> (8 * b)) & 0xFF;
+      }
+    }
+  }
+  
+  int rc = ble_gap_wl_set(whitelist, whitelistCount);
+  if (rc != 0) {
+    Serial.printf("Scan whitelist failed (%d), scanning unfiltered\n", rc);
+  }
+  
+  struct ble_gap_disc_params params;
+  memset(&params, 0, sizeof(params));
+  params.itvl = (BLE_SCAN_INTERVAL_MS * 16) / 10;  // 0.625 ms units
+  params.window = (BLE_SCAN_WINDOW_MS * 16) / 10;
+  params.filter_policy = rc == 0 ? BLE_HCI_SCAN_FILT_USE_WL : BLE_HCI_SCAN_FILT_NO_WL;
+  params.passive = 1;
+  params.filter_duplicates = 0;
+  
+  rc = ble_gap_disc(BLE_OWN_ADDR_PUBLIC, BLE_HS_FOREVER, &params, gapEventHandler, this);
+  if (rc != 0) {
+    Serial.printf("Raw scan start failed: %d\n", rc);
+    return false;
+  }
+  return true;
+}
+
+int VictronBLE::gapEventHandler(struct ble_gap_event* event, void* arg) {
+  VictronBLE* self = static_cast<VictronBLE*>(arg);
+  
+  switch (event->type) {
+    case BLE_GAP_EVENT_DISC: {
+      PowerLock lock(POWER_ACTIVITY_SCAN);
+      self->handleRawAdvertisement(event->disc.addr.val, event->disc.data,
+                                   event->disc.length_data, event->disc.rssi);
+      break;
+    }
+    case BLE_GAP_EVENT_DISC_COMPLETE:
+      // Scanning runs forever; only a host reset or cancel ends it
+      LOG_WARN("Raw scan ended: %d\n", event->disc_complete.reason);
+      break;
+    default:
+      break;
+  }
+  return 0;
+}
+
+void VictronBLE::handleRawAdvertisement(const uint8_t* addr, const uint8_t* data, uint8_t length, int8_t rssi) {
+  // Runs in the NimBLE host task on the controller's buffer: no allocation,
+  // no NimBLEAdvertisedDevice, no std::string
+  StageTimer timer(STAGE_SCAN_CALLBACK);
+  callbackCount.fetch_add(1, std::memory_order_relaxed);
+  
+  int deviceIndex = devices.find(DeviceTable::macFromBytes(addr));
+  if (deviceIndex < 0) {
+    return;
+  }
+  
+  // Walk the AD structures: [length][type][length - 1 bytes of data]
+  uint8_t pos = 0;
+  while (pos + 1 < length) {
+    uint8_t fieldLen = data[pos];
+    if (fieldLen == 0 || pos + 1 + fieldLen > length) {
+      return;
+    }
+    
+    const uint8_t* field = data + pos + 2;
+    uint8_t fieldDataLen = fieldLen - 1;
+    
+    if (data[pos + 1] == BLE_HS_ADV_TYPE_MFG_DATA && fieldDataLen >= 4) {
+      uint16_t manufacturerId = field[0] | (field[1] << 8);
+      if (manufacturerId == 0x02E1) {
+        enqueueAdvertisement(deviceIndex, field + 2, fieldDataLen - 2, rssi);
+      }
+      return;
+    }
+    pos += fieldLen + 1;
   }
 }
+#endif
 
 void VictronBLE::handleAdvertisement(NimBLEAdvertisedDevice* advertisedDevice) {
-  if (advertisedDevice->getAddress() != targetAddress) {
+  // Runs in the NimBLE host task: filter and copy the raw payload, nothing else
+  PowerLock lock(POWER_ACTIVITY_SCAN);
+  StageTimer timer(STAGE_SCAN_CALLBACK);
+  callbackCount.fetch_add(1, std::memory_order_relaxed);
+  
+  int deviceIndex = devices.find(DeviceTable::macFromBytes(advertisedDevice->getAddress().getNative()));
+  if (deviceIndex < 0) {
     return;
   }
   
@@ -57,62 +210,136 @@ void VictronBLE::handleAdvertisement(NimBLEAdvertisedDevice* advertisedDevice) {
     return;
   }
   
-  const uint8_t* encryptedPayload = (const uint8_t*)manufacturerData.data() + 2;
-  size_t payloadLen = manufacturerData.length() - 2;
+  enqueueAdvertisement(deviceIndex, (const uint8_t*)manufacturerData.data() + 2,
+                       manufacturerData.length() - 2, advertisedDevice->getRSSI());
+}
+
+void VictronBLE::enqueueAdvertisement(int deviceIndex, const uint8_t* payload, size_t payloadLen, int8_t rssi) {
+  BootProfiler::mark(BOOT_FIRST_ADV);
   
-  uint8_t decryptedData[64];
-  if (decryptVictronData(encryptedPayload, payloadLen, encryptionKey, decryptedData)) {
-    parseSmartShuntData(decryptedData, payloadLen, advertisedDevice->getRSSI());
+  if (payloadLen > ADV_PAYLOAD_MAX) {
+    return;
+  }
+  
+  RawAdvertisement* slot = advRing.reserve();
+  if (!slot) {
+    return; // Ring full - counted as a drop
+  }
+  
+  slot->timestamp = millis();
+#if PIPELINE_METRICS
+  slot->receivedUs = PipelineMetrics::timestampUs();
+#endif
+  slot->rssi = rssi;
+  slot->device = deviceIndex;
+  slot->length = payloadLen;
+  memcpy(slot->payload, payload, payloadLen);
+  advRing.commit();
+  
+  if (decodeTask) {
+    xTaskNotifyGive(decodeTask);
   }
 }
 
-void VictronBLE::hexStringToBytes(const char* hexString, uint8_t* byteArray, size_t byteArraySize) {
-  size_t hexLen = strlen(hexString);
-  for (size_t i = 0; i < byteArraySize && i * 2 < hexLen; i++) {
-    char hexByte[3] = {hexString[i * 2], hexString[i * 2 + 1], '\0'};
-    byteArray[i] = (uint8_t)strtol(hexByte, NULL, 16);
+void VictronBLE::decodeTaskEntry(void* param) {
+  VictronBLE* self = static_cast<VictronBLE*>(param);
+  
+  while (true) {
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    self->processPendingAdvertisements();
   }
 }
 
-NimBLEAddress VictronBLE::macStringToAddress(const char* macString) {
-  char formattedMac[18];
-  snprintf(formattedMac, sizeof(formattedMac), "%c%c:%c%c:%c%c:%c%c:%c%c:%c%c",
-           macString[0], macString[1], macString[2], macString[3],
-           macString[4], macString[5], macString[6], macString[7],
-           macString[8], macString[9], macString[10], macString[11]);
-  return NimBLEAddress(formattedMac);
+void VictronBLE::processPendingAdvertisements() {
+  const RawAdvertisement* adv;
+  while ((adv = advRing.peek()) != nullptr) {
+    {
+      PowerLock lock(POWER_ACTIVITY_DECODE);
+      decodeAdvertisement(*adv);
+    }
+    advRing.release();
+  }
+}
+
+void VictronBLE::decodeAdvertisement(const RawAdvertisement& adv) {
+  VictronDevice& device = devices[adv.device];
+  const uint8_t* encryptedPayload = adv.payload;
+  size_t payloadLen = adv.length;
+#if PIPELINE_METRICS
+  PipelineMetrics::recordMicros(STAGE_QUEUE, PipelineMetrics::timestampUs() - adv.receivedUs);
+#endif
+  AdvCapture::record(device.mac, encryptedPayload, payloadLen, adv.rssi, adv.timestamp);
+  
+  // With duplicate filtering off the same packet arrives many times per second.
+  // Same nonce and ciphertext means the same reading, so skip decrypt and parse.
+  if (payloadLen == device.lastPayloadLen && memcmp(encryptedPayload, device.lastPayload, payloadLen) == 0) {
+    device.skippedCount++;
+    BatteryData latest;
+    device.latest.read(latest); // This task is the only writer, so this never retries
+    latest.last_update = adv.timestamp;
+    device.latest.write(latest);
+    if (display && (currentView == adv.device || currentView == VIEW_AGGREGATE)) {
+      display->markDataFresh(adv.timestamp);
+    }
+    if (decodeNotify) {
+      MainEvents::post(MAIN_EVENT_DECODED);
+    }
+    return;
+  }
+  
+  uint8_t decryptedData[64];
+  uint32_t decryptStart = PipelineMetrics::cycles();
+  bool decrypted = decryptVictronData(device, encryptedPayload, payloadLen, decryptedData);
+  PipelineMetrics::recordCycles(STAGE_DECRYPT, decryptStart);
+  if (decrypted) {
+    device.decryptCount++;
+    memcpy(device.lastPayload, encryptedPayload, payloadLen);
+    device.lastPayloadLen = payloadLen;
+    
+    // The sample is complete, derived time fields included, before anything sees it
+    BatteryData sample;
+    if (parseSmartShuntData(decryptedData, payloadLen, adv.rssi, adv.timestamp, sample)) {
+      device.timeEstimator.update(sample.current, sample.soc, BATTERY_CAPACITY_AH, adv.timestamp);
+      TimeEstimate estimate = device.timeEstimator.estimate(BATTERY_CAPACITY_AH);
+      device.estimate.write(estimate);
+      applyTimeEstimate(sample, estimate);
+      publish(adv.device, sample);
+      LOG_DEBUG("[%s] V:%.2f I:%.3f P:%.1f SOC:%.1f%% RSSI:%d\n", device.macString,
+                sample.voltage, sample.current, sample.power, sample.soc, sample.rssi);
+    }
+    BootProfiler::mark(BOOT_FIRST_SAMPLE);
+    if (decodeNotify) {
+      MainEvents::post(MAIN_EVENT_DECODED);
+    }
+  }
 }
 
-bool VictronBLE::decryptVictronData(const uint8_t* encryptedData, size_t dataLen, 
-                                   const uint8_t* key, uint8_t* decryptedData) {
-  if (dataLen < 8) return false;
+bool VictronBLE::decryptVictronData(VictronDevice& device, const uint8_t* encryptedData, size_t dataLen, 
+                                   uint8_t* decryptedData) {
+  if (dataLen < 8 || !device.aesReady) return false;
   
   if (encryptedData[0] != 0x10) {
-    Serial.printf("Invalid record type: 0x%02X\n", encryptedData[0]);
+    LOG_DEBUG("Invalid record type: 0x%02X\n", encryptedData[0]);
+    return false;
+  }
+  
+  // Only battery monitor records are decoded; other Victron products are ignored
+  if (encryptedData[4] != VICTRON_RECORD_BATTERY_MONITOR) {
     return false;
   }
   
   uint16_t nonce = encryptedData[5] | (encryptedData[6] << 8);
   uint8_t key_byte = encryptedData[7];
   
-  if (key_byte != key[0]) {
-    Serial.printf("Key mismatch. Expected: 0x%02X, Got: 0x%02X\n", key[0], key_byte);
+  if (key_byte != device.encryptionKey[0]) {
+    LOG_WARN("Key mismatch. Expected: 0x%02X, Got: 0x%02X\n", device.encryptionKey[0], key_byte);
     return false;
   }
   
   const uint8_t* encrypted_payload = encryptedData + 8;
   size_t encrypted_len = dataLen - 8;
   
-  // Setup AES-CTR decryption
-  mbedtls_aes_context aes;
-  mbedtls_aes_init(&aes);
-  
-  int ret = mbedtls_aes_setkey_enc(&aes, key, 128);
-  if (ret != 0) {
-    mbedtls_aes_free(&aes);
-    return false;
-  }
-  
+  // AES-CTR decryption with the device's key schedule expanded once in the table
   size_t nc_off = 0;
   unsigned char nonce_counter[16];
   unsigned char stream_block[16];
@@ -121,88 +348,58 @@ bool VictronBLE::decryptVictronData(const uint8_t* encryptedData, size_t dataLen
   nonce_counter[0] = nonce & 0xFF;
   nonce_counter[1] = (nonce >> 8) & 0xFF;
   
-  ret = mbedtls_aes_crypt_ctr(&aes, encrypted_len, &nc_off, nonce_counter, stream_block, 
-                              encrypted_payload, decryptedData);
-  
-  mbedtls_aes_free(&aes);
+  int ret = mbedtls_aes_crypt_ctr(&device.aesContext, encrypted_len, &nc_off, nonce_counter, stream_block, 
+                                  encrypted_payload, decryptedData);
   
   return ret == 0;
 }
 
-uint32_t VictronBLE::extractBits(const uint8_t* data, int startBit, int numBits) {
-  uint32_t result = 0;
-  int currentBit = startBit;
+bool VictronBLE::parseSmartShuntData(const uint8_t* data, size_t len, int8_t rssi, unsigned long timestamp,
+                                     BatteryData& batteryData) {
+  if (len < 8) return false;
   
-  for (int i = 0; i < numBits; i++) {
-    int byteIndex = currentBit / 8;
-    int bitIndex = currentBit % 8;
-    
-    if (data[byteIndex] & (1 << bitIndex)) {
-      result |= (1 << i);
-    }
-    currentBit++;
-  }
-  
-  return result;
-}
-
-int32_t VictronBLE::signExtend(uint32_t value, int bits) {
-  if (value & (1 << (bits - 1))) {
-    return value | (0xFFFFFFFF << bits);
-  }
-  return value;
-}
-
-void VictronBLE::parseSmartShuntData(const uint8_t* data, size_t len, int8_t rssi) {
-  if (len < 8) return;
-  
-  BatteryData batteryData;
-  memset(&batteryData, 0, sizeof(batteryData)); // Initialize all fields
+  uint32_t parseStart = PipelineMetrics::cycles();
+  batteryData = BatteryData(); // Initialize all fields
   batteryData.rssi = rssi;
   batteryData.data_valid = true;
+  batteryData.last_update = timestamp;
+  
+  int32_t value;
   
   // Time To Go
-  uint32_t ttg_raw = extractBits(data, 0, 16);
-  if (ttg_raw != 0xFFFF) {
-    batteryData.ttg_minutes = ttg_raw;
+  if (SmartShuntRecord::TimeToGo::read(data, value)) {
+    batteryData.ttg_minutes = value;
   }
   
   // Battery Voltage
-  uint32_t voltage_raw = extractBits(data, 16, 16);
-  if (voltage_raw != 0x7FFF) {
-    int16_t voltage_signed = signExtend(voltage_raw, 16);
-    batteryData.voltage = voltage_signed * 0.01f;
+  if (SmartShuntRecord::BatteryVoltage::read(data, value)) {
+    batteryData.voltage = value * 0.01f;
   }
   
   // Alarm Reason
-  uint32_t alarm_raw = extractBits(data, 32, 16);
-  batteryData.alarms = alarm_raw;
+  batteryData.alarms = SmartShuntRecord::AlarmReason::raw(data);
   
   // Aux Input
-  uint32_t aux_raw = extractBits(data, 48, 16);
-  uint32_t aux_input = extractBits(data, 64, 2);
+  uint32_t aux_input = SmartShuntRecord::AuxInputType::raw(data);
   batteryData.aux_type = aux_input;
   
-  if (aux_raw != 0x7FFF && aux_input != 1) {
-    int16_t aux_signed = signExtend(aux_raw, 16);
+  if (aux_input != 1 && SmartShuntRecord::AuxInput::read(data, value)) {
     switch (aux_input) {
       case 0: // Voltage
-        batteryData.aux_value = aux_signed * 0.01f;
+        batteryData.aux_value = value * 0.01f;
         break;
       case 2: // Temperature
-        batteryData.aux_value = aux_signed * 0.01f - 273.15f;
+        batteryData.aux_value = value * 0.01f - 273.15f;
         break;
       case 3: // Mid-point
-        batteryData.aux_value = aux_signed * 0.01f;
+        batteryData.aux_value = value * 0.01f;
         break;
     }
   }
   
   // Battery Current
-  uint32_t current_raw = extractBits(data, 66, 22);
-  if (current_raw != 0x3FFFFF) {
-    int32_t current_signed = signExtend(current_raw, 22);
-    batteryData.current = current_signed * 0.001f;
+  if (SmartShuntRecord::BatteryCurrent::read(data, value)) {
+    batteryData.current = value * 0.001f;
     
     // Calculate power
     if (batteryData.voltage != 0.0f) {
@@ -210,71 +407,205 @@ void VictronBLE::parseSmartShuntData(const uint8_t* data, size_t len, int8_t rss
     }
   }
   
-  if (len >= 16) {
+  if (len >= SmartShuntRecord::LONG_RECORD_LENGTH) {
     // Consumed Ah
-    uint32_t consumed_raw = extractBits(data, 88, 20);
-    if (consumed_raw != 0xFFFFF) {
-      int32_t consumed_signed = signExtend(consumed_raw, 20);
-      batteryData.consumed_ah = -consumed_signed * 0.1f;
+    if (SmartShuntRecord::ConsumedAh::read(data, value)) {
+      batteryData.consumed_ah = -value * 0.1f;
     }
     
     // SOC
-    uint32_t soc_raw = extractBits(data, 108, 10);
-    if (soc_raw != 0x3FF) {
-      batteryData.soc = soc_raw * 0.1f;
+    if (SmartShuntRecord::StateOfCharge::read(data, value)) {
+      batteryData.soc = value * 0.1f;
     }
   }
   
-  if (display) {
-    display->updateData(batteryData);
+  PipelineMetrics::recordCycles(STAGE_PARSE, parseStart);
+  return true;
+}
+
+// The one place a new reading reaches the device table and the display
+void VictronBLE::publish(uint8_t deviceIndex, const BatteryData& batteryData) {
+  devices[deviceIndex].latest.write(batteryData);
+  devices[deviceIndex].publishCount++;
+  
+  if (!display) {
+    return;
   }
   
-  calculateBatteryTime(batteryData);
+  if (currentView == deviceIndex) {
+    display->updateData(batteryData);
+  } else if (currentView == VIEW_AGGREGATE) {
+    display->updateData(buildAggregate());
+  }
   
-  Serial.printf("[%s] V:%.2f I:%.3f P:%.1f SOC:%.1f%% RSSI:%d\n",
-                targetAddress.toString().c_str(),
-                batteryData.voltage, batteryData.current, batteryData.power,
-                batteryData.soc, batteryData.rssi);
+  // Only wake the main loop when there is something new to draw
+  if (display->isUpdatePending()) {
+    MainEvents::post(MAIN_EVENT_SAMPLE);
+  }
 }
 
-void VictronBLE::calculateBatteryTime(BatteryData& batteryData) {
-  batteryData.calculated_time_remaining_minutes = 0;
-  batteryData.calculated_time_to_full_minutes = 0;
-  batteryData.time_calculation_valid = false;
+BatteryData VictronBLE::buildAggregate() {
+  BatteryData aggregate;
+  
+  unsigned long now = millis();
+  int included = 0;
+  
+  // Time estimates combine the banks' smoothed currents and counted charge
+  TimeEstimate time;
+  memset(&time, 0, sizeof(time));
+  time.confidence = 100;
+  time.valid = true;
+  
+  for (uint8_t i = 0; i < devices.size(); i++) {
+    BatteryData data;
+    devices[i].latest.read(data);
+    if (!data.data_valid || now - data.last_update > DATA_STALE_TIMEOUT) {
+      continue;
+    }
+    
+    // Banks are combined: currents, power and consumed Ah add up,
+    // voltage and SOC are averaged, the weakest signal is reported
+    aggregate.voltage += data.voltage;
+    aggregate.soc += data.soc;
+    aggregate.current += data.current;
+    aggregate.power += data.power;
+    aggregate.consumed_ah += data.consumed_ah;
+    aggregate.alarms |= data.alarms;
+    if (included == 0 || data.rssi < aggregate.rssi) {
+      aggregate.rssi = data.rssi;
+    }
+    if (data.last_update > aggregate.last_update) {
+      aggregate.last_update = data.last_update;
+    }
+    
+    TimeEstimate bank = devices[i].estimate.read();
+    time.current += bank.current;
+    time.remainingAh += bank.remainingAh;
+    time.capacityAh += bank.capacityAh;
+    time.confidence = min(time.confidence, bank.confidence);
+    time.valid = time.valid && bank.valid;
+    included++;
+  }
   
-  if (!batteryData.data_valid || batteryData.soc <= 0.0f) {
-    return;
+  if (included == 0) {
+    return aggregate;
   }
   
-  float current_abs = abs(batteryData.current);
+  aggregate.voltage /= included;
+  aggregate.soc /= included;
+  aggregate.data_valid = true;
+  applyTimeEstimate(aggregate, time);
   
-  if (current_abs < MIN_CURRENT_THRESHOLD) {
+  return aggregate;
+}
+
+BatteryData VictronBLE::currentViewData() {
+  if (currentView == VIEW_AGGREGATE) {
+    return buildAggregate();
+  }
+  return devices[currentView].latest.read();
+}
+
+void VictronBLE::setView(int view) {
+  if (view != VIEW_AGGREGATE && (view < 0 || view >= devices.size())) {
+    return;
+  }
+  currentView = view;
+  
+  if (!display) {
     return;
   }
   
-  if (batteryData.current < -MIN_CURRENT_THRESHOLD) {
-    float remaining_capacity_ah = (batteryData.soc / 100.0f) * BATTERY_CAPACITY_AH;
-    float time_hours = remaining_capacity_ah / current_abs;
-    batteryData.calculated_time_remaining_minutes = (uint16_t)(time_hours * 60.0f);
-    batteryData.time_calculation_valid = true;
+  // Label the screen only when there is more than one device to tell apart
+  char label[sizeof("255/255")] = "";
+  if (devices.size() > 1) {
+    if (view == VIEW_AGGREGATE) {
+      strcpy(label, "ALL");
+    } else {
+      snprintf(label, sizeof(label), "%u/%u", (unsigned)(uint8_t)(view + 1), (unsigned)devices.size());
+    }
+  }
+  display->setViewLabel(label);
+  display->updateData(currentViewData());
+}
+
+int VictronBLE::nextView() {
+  int view;
+  if (currentView == VIEW_AGGREGATE) {
+    view = 0;
+  } else if (currentView + 1 < devices.size()) {
+    view = currentView + 1;
+  } else {
+    view = devices.size() > 1 ? VIEW_AGGREGATE : 0;
+  }
+  setView(view);
+  return view;
+}
+
+void VictronBLE::saveState(DecoderState* states) const {
+  for (uint8_t i = 0; i < devices.size(); i++) {
+    memcpy(states[i].lastPayload, devices[i].lastPayload, sizeof(states[i].lastPayload));
+    states[i].lastPayloadLen = devices[i].lastPayloadLen;
+    devices[i].latest.read(states[i].latest);
+    states[i].timeEstimator = devices[i].timeEstimator;
+  }
+}
+
+void VictronBLE::restoreState(const DecoderState* states, uint8_t count) {
+  unsigned long now = millis();
+  for (uint8_t i = 0; i < devices.size() && i < count; i++) {
+    VictronDevice& device = devices[i];
+    memcpy(device.lastPayload, states[i].lastPayload, sizeof(device.lastPayload));
+    device.lastPayloadLen = states[i].lastPayloadLen;
+    device.timeEstimator = states[i].timeEstimator;
     
-    Serial.printf("Discharging: %.1fAh remaining, %.1fA draw, %.1fh remaining\n",
-                  remaining_capacity_ah, current_abs, time_hours);
-                  
-  } else if (batteryData.current > MIN_CURRENT_THRESHOLD) {
-    float current_capacity_ah = (batteryData.soc / 100.0f) * BATTERY_CAPACITY_AH;
-    float capacity_needed_ah = BATTERY_CAPACITY_AH - current_capacity_ah;
-    float time_hours = capacity_needed_ah / current_abs;
-    batteryData.calculated_time_to_full_minutes = (uint16_t)(time_hours * 60.0f);
-    batteryData.time_calculation_valid = true;
+    // Timestamps are from before the sleep; count the readings as stale until
+    // the device is heard again (a repeated packet refreshes them)
+    BatteryData latest = states[i].latest;
+    latest.last_update = now - DATA_STALE_TIMEOUT - 1;
+    device.latest.write(latest);
     
-    Serial.printf("Charging: %.1fAh needed, %.1fA charge, %.1fh to full\n",
-                  capacity_needed_ah, current_abs, time_hours);
+    // millis() restarted with the wakeup; take the last reading to be one
+    // sample interval ago so the current average carries on
+    device.timeEstimator.rebase(now - SAMPLE_INTERVAL_S * 1000UL);
+    device.estimate.write(device.timeEstimator.estimate(BATTERY_CAPACITY_AH));
   }
-  
-  if (display) {
-    display->updateData(batteryData);
+}
+
+bool VictronBLE::allDevicesUpdatedSince(unsigned long since) const {
+  unsigned long now = millis();
+  for (uint8_t i = 0; i < devices.size(); i++) {
+    BatteryData data;
+    devices[i].latest.read(data);
+    if (!data.data_valid || now - data.last_update > now - since) {
+      return false;
+    }
+  }
+  return devices.size() > 0;
+}
+
+uint32_t VictronBLE::getDecryptCount() const {
+  uint32_t total = 0;
+  for (uint8_t i = 0; i < devices.size(); i++) {
+    total += devices[i].decryptCount;
+  }
+  return total;
+}
+
+uint32_t VictronBLE::getPublishCount() const {
+  uint32_t total = 0;
+  for (uint8_t i = 0; i < devices.size(); i++) {
+    total += devices[i].publishCount;
+  }
+  return total;
+}
+
+uint32_t VictronBLE::getSkippedCount() const {
+  uint32_t total = 0;
+  for (uint8_t i = 0; i < devices.size(); i++) {
+    total += devices[i].skippedCount;
   }
+  return total;
 }
 
 // Callback implementation
@@ -5,40 +5,110 @@
 #include "NimBLEDevice.h"
 #include "display.h"
 #include "config.h"
+#include "device_table.h"
+#include "spsc_ring.h"
+#include "pipeline_metrics.h"
+
+// Raw advertisement handed from the NimBLE host task to the decode task
+struct RawAdvertisement {
+  unsigned long timestamp;
+#if PIPELINE_METRICS
+  uint32_t receivedUs;  // Finer timestamp for the queue stage
+#endif
+  int8_t rssi;
+  uint8_t device;   // Index into the device table, resolved once in the scan callback
+  uint8_t length;
+  uint8_t payload[ADV_PAYLOAD_MAX];
+};
 
 class VictronBLE {
 private:
-  NimBLEAddress targetAddress;
-  uint8_t encryptionKey[16];
+  DeviceTable devices;
   NimBLEScan* pBLEScan;
   Display* display;
   
+  // Device shown on the display, or VIEW_AGGREGATE
+  volatile int currentView;
+  
+  // Scan callback -> decode task hand-off
+  SpscRing<RawAdvertisement, ADV_RING_SIZE> advRing;
+  TaskHandle_t decodeTask;
+  
+  // Scan callbacks seen, matching or not
+  std::atomic<uint32_t> callbackCount;
+  
+  // Post MAIN_EVENT_DECODED for every valid packet, duplicates included
+  volatile bool decodeNotify;
+  
   // Helper functions
-  void hexStringToBytes(const char* hexString, uint8_t* byteArray, size_t byteArraySize);
-  NimBLEAddress macStringToAddress(const char* macString);
-  bool decryptVictronData(const uint8_t* encryptedData, size_t dataLen, 
-                         const uint8_t* key, uint8_t* decryptedData);
-  uint32_t extractBits(const uint8_t* data, int startBit, int numBits);
-  int32_t signExtend(uint32_t value, int bits);
-  void parseSmartShuntData(const uint8_t* data, size_t len, int8_t rssi);
-  void calculateBatteryTime(BatteryData& batteryData);
+  bool decryptVictronData(VictronDevice& device, const uint8_t* encryptedData, size_t dataLen,
+                         uint8_t* decryptedData);
+  void enqueueAdvertisement(int deviceIndex, const uint8_t* payload, size_t payloadLen, int8_t rssi);
+#if VICTRON_RAW_SCAN
+  bool startRawScan();
+  static int gapEventHandler(struct ble_gap_event* event, void* arg);
+  void handleRawAdvertisement(const uint8_t* addr, const uint8_t* data, uint8_t length, int8_t rssi);
+#endif
+  static void decodeTaskEntry(void* param);
+  void decodeAdvertisement(const RawAdvertisement& adv);
+  // Decrypted record to a reading without the derived time fields; no side effects
+  static bool parseSmartShuntData(const uint8_t* data, size_t len, int8_t rssi, unsigned long timestamp,
+                                  BatteryData& batteryData);
+  void publish(uint8_t deviceIndex, const BatteryData& batteryData);
+  BatteryData buildAggregate();
+  BatteryData currentViewData();
 
 public:
-  VictronBLE(const char* macAddress, const char* encryptionKey);
+  static const int VIEW_AGGREGATE = -1;
+  
+  VictronBLE();
+  ~VictronBLE();
+  bool addDevice(const char* macAddress, const char* encryptionKey);
+  uint8_t getDeviceCount() const { return devices.size(); }
+  BatteryData getDeviceData(uint8_t index) const { return devices[index].latest.read(); } // Any task
+  uint32_t getDevicePublishCount(uint8_t index) const { return devices[index].publishCount; } // Changes with each new reading
+  BatteryData getCombinedData() { return buildAggregate(); } // All fresh devices, as in the ALL view
+  
   bool begin();
   void setDisplay(Display* disp);
   void startScanning();
+  void stopScanning();
   void handleAdvertisement(NimBLEAdvertisedDevice* advertisedDevice);
+  void processPendingAdvertisements();
+  
+  // Display views: one device at a time, or all devices combined
+  void setView(int view);
+  int getView() const { return currentView; }
+  int nextView();
+  
+  // Deep-sleep sampling: restore before scanning, save after stopScanning()
+  void saveState(DecoderState* states) const;
+  void restoreState(const DecoderState* states, uint8_t count);
+  void setDecodeNotify(bool enabled) { decodeNotify = enabled; }
+  bool allDevicesUpdatedSince(unsigned long since) const;
+  
+  // Decrypt statistics, summed over all devices
+  uint32_t getDecryptCount() const;
+  uint32_t getSkippedCount() const;
+  uint32_t getPublishCount() const;  // Readings handed to the display, one per decoded packet
+  
+  // Scan callback statistics
+  uint32_t getCallbackCount() const { return callbackCount.load(std::memory_order_relaxed); }
+  
+  // Advertisement ring statistics
+  uint32_t getRingDropped() const { return advRing.getDropped(); }
+  uint32_t getRingHighWater() const { return advRing.getHighWater(); }
+  size_t getRingCapacity() const { return advRing.capacity(); }
 };
 
 // Callback class that forwards to VictronBLE instance
 class VictronAdvertisingCallback: public NimBLEAdvertisedDeviceCallbacks {
 private:
   VictronBLE* victronBLE;
-  
+
 public:
   VictronAdvertisingCallback(VictronBLE* ble) : victronBLE(ble) {}
   void onResult(NimBLEAdvertisedDevice* advertisedDevice) override;
 };
 
-#endif // VICTRON_BLE_H 
\ No newline at end of file
+#endif // VICTRON_BLE_H
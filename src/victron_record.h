@@ -0,0 +1,80 @@
+#ifndef VICTRON_RECORD_H
+#define VICTRON_RECORD_H
+
+#include <stdint.h>
+#include <string.h>
+
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ != __ORDER_LITTLE_ENDIAN__
+#error "victron_record.h assumes a little-endian target"
+#endif
+
+// Compile-time description of the bit-packed Victron instant readout records.
+// Each field is a type carrying its bit offset, width, signedness and the
+// "not available" sentinel, so extraction compiles down to one small load,
+// a shift and a mask instead of walking the record bit by bit.
+
+#define VICTRON_FIELD_NO_SENTINEL 0xFFFFFFFFu
+
+template <uint16_t Offset, uint8_t Width, bool Signed = false,
+          uint32_t NotAvailable = VICTRON_FIELD_NO_SENTINEL>
+struct BitField {
+  static_assert(Width >= 1 && Width <= 32, "field width must be 1..32 bits");
+
+  static const uint16_t offset = Offset;
+  static const uint8_t width = Width;
+  static const uint32_t mask = Width == 32 ? 0xFFFFFFFFu : ((1u << (Width % 32)) - 1u);
+
+  // Bytes touched by the field, at most 5 (7-bit shift + 32-bit field)
+  static const size_t firstByte = Offset / 8;
+  static const uint8_t shift = Offset % 8;
+  static const size_t spanBytes = (shift + Width + 7) / 8;
+
+  // Raw little-endian bits of the field, zero-extended
+  static uint32_t raw(const uint8_t* data) {
+    uint64_t word = 0;
+    memcpy(&word, data + firstByte, spanBytes);
+    return (uint32_t)(word >> shift) & mask;
+  }
+
+  static bool available(uint32_t rawValue) {
+    return rawValue != NotAvailable;
+  }
+
+  // Two's complement sign extension from Width bits (no-op for unsigned fields)
+  static int32_t extend(uint32_t rawValue) {
+    if (!Signed || Width == 32) {
+      return (int32_t)rawValue;
+    }
+    return (int32_t)(rawValue << (32 - Width)) >> (32 - Width);
+  }
+
+  // Reads the field into value; returns false when it holds the sentinel
+  static bool read(const uint8_t* data, int32_t& value) {
+    uint32_t rawValue = raw(data);
+    if (!available(rawValue)) {
+      return false;
+    }
+    value = extend(rawValue);
+    return true;
+  }
+};
+
+// Record type byte in the advertisement header
+#define VICTRON_RECORD_BATTERY_MONITOR 0x02
+
+// SmartShunt / battery monitor record (record type 0x02), decrypted payload
+namespace SmartShuntRecord {
+  typedef BitField<0, 16, false, 0xFFFF>       TimeToGo;        // 1 min
+  typedef BitField<16, 16, true, 0x7FFF>       BatteryVoltage;  // 10 mV
+  typedef BitField<32, 16>                     AlarmReason;
+  typedef BitField<48, 16, true, 0x7FFF>       AuxInput;        // 10 mV or 0.01 K
+  typedef BitField<64, 2>                      AuxInputType;    // 0=voltage, 1=none, 2=temp, 3=midpoint
+  typedef BitField<66, 22, true, 0x3FFFFF>     BatteryCurrent;  // 1 mA
+  typedef BitField<88, 20, true, 0xFFFFF>      ConsumedAh;      // 0.1 Ah
+  typedef BitField<108, 10, false, 0x3FF>      StateOfCharge;   // 0.1 %
+
+  // Consumed Ah and SOC are only present in the long form of the record
+  static const size_t LONG_RECORD_LENGTH = 16;
+}
+
+#endif // VICTRON_RECORD_H
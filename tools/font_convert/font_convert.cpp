@@ -0,0 +1,137 @@
+// Converts a TrueType or OpenType font to an Adafruit GFX font header, the
+// way the library's fontconvert does: printable ASCII rendered monochrome at
+// 141 dpi, each glyph's rows packed into one bit stream padded to a byte.
+//
+//   font_convert font.ttf points name > name.h
+//
+// The host builds draw with the SimMonoBold headers in sim/stubs/Fonts made
+// by this, so the golden images do not depend on a library download. Made
+// from GNU FreeFont's FreeMonoBold.ttf it reproduces the library's own headers.
+//
+// Build: g++ -O2 -std=gnu++11 $(pkg-config --cflags freetype2) tools/font_convert/font_convert.cpp
+//        $(pkg-config --libs freetype2) -o font_convert
+// (or pio run -e font-convert)
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <vector>
+#include <ft2build.h>
+#include FT_FREETYPE_H
+
+#define FONT_DPI 141
+#define FIRST_CHAR 0x20
+#define LAST_CHAR 0x7E
+
+struct Glyph {
+  unsigned bitmapOffset;
+  unsigned width;
+  unsigned height;
+  int xAdvance;
+  int xOffset;
+  int yOffset;
+};
+
+class BitWriter {
+private:
+  std::vector<uint8_t>& bytes;
+  uint8_t bit;
+
+public:
+  explicit BitWriter(std::vector<uint8_t>& out) : bytes(out), bit(0) {}
+
+  void put(bool set) {
+    if (bit == 0) {
+      bytes.push_back(0);
+      bit = 0x80;
+    }
+    if (set) {
+      bytes.back() |= bit;
+    }
+    bit >>= 1;
+  }
+
+  // Each glyph starts on a byte boundary
+  void flush() { bit = 0; }
+};
+
+int main(int argc, char** argv) {
+  if (argc != 4) {
+    fprintf(stderr, "usage: %s font.ttf points name > name.h\n", argv[0]);
+    return 2;
+  }
+  const char* path = argv[1];
+  int points = atoi(argv[2]);
+  const char* name = argv[3];
+
+  FT_Library library;
+  FT_Face face;
+  if (FT_Init_FreeType(&library) != 0 || FT_New_Face(library, path, 0, &face) != 0) {
+    fprintf(stderr, "cannot open %s\n", path);
+    return 1;
+  }
+  if (points <= 0 || FT_Set_Char_Size(face, points << 6, 0, FONT_DPI, 0) != 0) {
+    fprintf(stderr, "cannot set %s to %d pt\n", path, points);
+    return 1;
+  }
+
+  std::vector<uint8_t> bitmaps;
+  std::vector<Glyph> glyphs;
+  BitWriter writer(bitmaps);
+  for (int c = FIRST_CHAR; c <= LAST_CHAR; c++) {
+    if (FT_Load_Char(face, c, FT_LOAD_TARGET_MONO) != 0 ||
+        FT_Render_Glyph(face->glyph, FT_RENDER_MODE_MONO) != 0) {
+      fprintf(stderr, "cannot render character 0x%02X\n", c);
+      return 1;
+    }
+    const FT_GlyphSlot slot = face->glyph;
+    const FT_Bitmap& bitmap = slot->bitmap;
+
+    Glyph glyph;
+    glyph.bitmapOffset = bitmaps.size();
+    glyph.width = bitmap.width;
+    glyph.height = bitmap.rows;
+    glyph.xAdvance = slot->advance.x >> 6;
+    glyph.xOffset = slot->bitmap_left;
+    glyph.yOffset = 1 - slot->bitmap_top;
+    glyphs.push_back(glyph);
+
+    for (unsigned y = 0; y < bitmap.rows; y++) {
+      const uint8_t* row = bitmap.buffer + y * bitmap.pitch;
+      for (unsigned x = 0; x < bitmap.width; x++) {
+        writer.put(row[x / 8] & (0x80 >> (x & 7)));
+      }
+    }
+    writer.flush();
+  }
+
+  printf("// %s converted at %d pt by tools/font_convert\n\n", face->family_name ? face->family_name : path, points);
+  printf("const uint8_t %sBitmaps[] PROGMEM = {", name);
+  for (size_t i = 0; i < bitmaps.size(); i++) {
+    printf("%s0x%02X", i == 0 ? "\n  " : (i % 12 == 0 ? ",\n  " : ", "), bitmaps[i]);
+  }
+  printf(" };\n\n");
+
+  printf("const GFXglyph %sGlyphs[] PROGMEM = {\n", name);
+  for (size_t i = 0; i < glyphs.size(); i++) {
+    const Glyph& g = glyphs[i];
+    int c = FIRST_CHAR + (int)i;
+    printf("  { %5u, %3u, %3u, %3d, %4d, %4d }%s   // 0x%02X", g.bitmapOffset, g.width, g.height, g.xAdvance,
+           g.xOffset, g.yOffset, i + 1 < glyphs.size() ? "," : " ", c);
+    if (c != '\\') {
+      printf(" '%c'", c);
+    }
+    printf("\n");
+  }
+  printf("};\n\n");
+
+  printf("const GFXfont %s PROGMEM = {\n", name);
+  printf("  (uint8_t  *)%sBitmaps,\n", name);
+  printf("  (GFXglyph *)%sGlyphs,\n", name);
+  printf("  0x%02X, 0x%02X, %ld };\n\n", FIRST_CHAR, LAST_CHAR, (long)(face->size->metrics.height >> 6));
+  printf("// Approx. %zu bytes\n", bitmaps.size() + glyphs.size() * 7 + 7);
+
+  FT_Done_Face(face);
+  FT_Done_FreeType(library);
+  return 0;
+}